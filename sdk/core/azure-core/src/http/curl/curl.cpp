@@ -18,6 +18,7 @@
 #include <curl/curl.h>
 #include <string>
 #include <thread>
+#include <vector>
 
 namespace {
 // Can be used from anywhere a little simpler
@@ -388,17 +389,27 @@ CURLcode CurlSession::UploadBody(Context const& context)
     // use default size
     uploadChunkSize = Details::c_DefaultUploadChunkSize;
   }
-  auto unique_buffer = std::make_unique<uint8_t[]>(static_cast<size_t>(uploadChunkSize));
+
+  // Every request sent from a thread reuses the same bounce buffer, unless the chunk size is too
+  // large to keep around.
+  constexpr int64_t maxReusedBufferSize = 4 * 1024 * 1024;
+  thread_local std::vector<uint8_t> reusedBuffer;
+  std::vector<uint8_t> ownBuffer;
+  std::vector<uint8_t>& buffer = uploadChunkSize <= maxReusedBufferSize ? reusedBuffer : ownBuffer;
+  if (static_cast<int64_t>(buffer.size()) < uploadChunkSize)
+  {
+    buffer.resize(static_cast<size_t>(uploadChunkSize));
+  }
 
   while (true)
   {
-    auto rawRequestLen = streamBody->Read(context, unique_buffer.get(), uploadChunkSize);
+    auto rawRequestLen = streamBody->Read(context, buffer.data(), uploadChunkSize);
     if (rawRequestLen == 0)
     {
       break;
     }
-    sendResult = m_connection->SendBuffer(
-        context, unique_buffer.get(), static_cast<size_t>(rawRequestLen));
+    sendResult
+        = m_connection->SendBuffer(context, buffer.data(), static_cast<size_t>(rawRequestLen));
     if (sendResult != CURLE_OK)
     {
       return sendResult;
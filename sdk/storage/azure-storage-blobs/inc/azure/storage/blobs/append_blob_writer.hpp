@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "azure/storage/blobs/append_blob_client.hpp"
+#include "azure/storage/blobs/blob_options.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <exception>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  /**
+   * @brief Appends the data written by any number of threads to an existing append blob, grouping
+   * small writes into few AppendBlock requests. Written data is buffered into blocks, and a block
+   * is appended once it's full, once AppendBlobWriterOptions::FlushInterval has passed since its
+   * first write or when it's flushed. While a block is being appended, further writes are grouped
+   * into the next one.
+   *
+   * Every block is appended at the position the writer expects with the AppendPosition condition,
+   * so the content of the blob is never interleaved with other writers or duplicated by retries.
+   * The data of a single write is never split across blocks, unless it's bigger than a block.
+   */
+  class AppendBlobWriter {
+  public:
+    /**
+     * @brief Constructs a writer that appends to the blob of \p client.
+     *
+     * @param client The append blob to append to, which must exist.
+     * @param options Optional parameters of the writer.
+     */
+    explicit AppendBlobWriter(
+        AppendBlobClient client,
+        const AppendBlobWriterOptions& options = AppendBlobWriterOptions());
+
+    /**
+     * @brief Appends the data that's still buffered. Errors are ignored, use Close to observe
+     * them.
+     */
+    ~AppendBlobWriter();
+
+    AppendBlobWriter(const AppendBlobWriter&) = delete;
+    AppendBlobWriter& operator=(const AppendBlobWriter&) = delete;
+
+    /**
+     * @brief Buffers \p size bytes to be appended after everything written before. Safe to call
+     * from several threads. Blocks while AppendBlobWriterOptions::MaxBufferedSize is exceeded.
+     * Throws the error of a failed append, after which nothing more is appended.
+     */
+    void Write(const uint8_t* data, std::size_t size);
+
+    /**
+     * @brief Appends the buffered data without waiting for the flush interval.
+     *
+     * @return A future that's ready once everything written before the call is appended, or that
+     * holds the error of the failed append.
+     */
+    std::shared_future<void> Flush();
+
+    /**
+     * @brief Appends everything written and waits for it. Throws the error of a failed append.
+     * Nothing can be written afterwards.
+     */
+    void Close();
+
+  private:
+    struct Block;
+
+    void AppendLoop();
+    void AppendBlock(const Block& block);
+    bool IsAppended(const Block& block) const;
+
+    const AppendBlobClient m_client;
+    const AppendBlobWriterOptions m_options;
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    // Blocks in the order they're appended, only the last one is written to.
+    std::deque<std::shared_ptr<Block>> m_blocks;
+    std::shared_ptr<Block> m_appendingBlock;
+    int64_t m_bufferedSize = 0;
+    std::exception_ptr m_error;
+    bool m_closed = false;
+    // Only used by the append thread.
+    int64_t m_appendPosition = -1;
+    std::thread m_thread;
+  };
+
+}}} // namespace Azure::Storage::Blobs
@@ -225,6 +225,19 @@ namespace Azure { namespace Storage { namespace Blobs {
     Azure::Core::Response<Models::DownloadBlobResult> Download(
         const DownloadBlobOptions& options = DownloadBlobOptions()) const;
 
+    /**
+     * @brief Downloads a blob or a blob range from the service, including its metadata and
+     * properties, as a stream that's downloaded ahead of the read position with parallel range
+     * requests.
+     *
+     * @param options Optional parameters to execute this function.
+     * @return A DownloadBlobResult describing the downloaded blob.
+     * BlobDownloadResponse.BodyStream contains the blob's data. The downloads are canceled when
+     * it's destroyed.
+     */
+    Azure::Core::Response<Models::DownloadBlobResult> ParallelDownload(
+        const ParallelDownloadBlobOptions& options = ParallelDownloadBlobOptions()) const;
+
     /**
      * @brief Downloads a blob or a blob range from the service to a memory buffer using parallel
      * requests.
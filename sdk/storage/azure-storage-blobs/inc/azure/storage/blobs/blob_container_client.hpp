@@ -9,6 +9,7 @@
 #include "azure/storage/blobs/protocol/blob_rest_client.hpp"
 #include "azure/storage/common/storage_credential.hpp"
 
+#include <functional>
 #include <map>
 #include <memory>
 #include <string>
@@ -195,6 +196,20 @@ namespace Azure { namespace Storage { namespace Blobs {
     Azure::Core::Response<Models::ListBlobsFlatSegmentResult> ListBlobsFlatSegment(
         const ListBlobsSegmentOptions& options = ListBlobsSegmentOptions()) const;
 
+    /**
+     * @brief Returns a single segment of blobs in this container like ListBlobsFlatSegment, but
+     * passes each blob to \p onItem as soon as it's received instead of waiting for the whole
+     * segment. The Items of the returned result are left empty.
+     *
+     * @param onItem Called with each blob, in order, on the calling thread. If empty, the blobs
+     * are returned in Items.
+     * @param options Optional parameters to execute this function.
+     * @return A ListBlobsFlatSegmentResult describing a segment of the blobs in the container.
+     */
+    Azure::Core::Response<Models::ListBlobsFlatSegmentResult> ListBlobsFlatSegment(
+        const std::function<void(Models::BlobItem)>& onItem,
+        const ListBlobsSegmentOptions& options = ListBlobsSegmentOptions()) const;
+
     /**
      * @brief Returns a single segment of blobs in this container, starting from the
      * specified Marker, Use an empty Marker to start enumeration from the beginning and the
@@ -213,6 +228,28 @@ namespace Azure { namespace Storage { namespace Blobs {
         const std::string& delimiter,
         const ListBlobsSegmentOptions& options = ListBlobsSegmentOptions()) const;
 
+    /**
+     * @brief Returns a single segment of blobs in this container like
+     * ListBlobsByHierarchySegment, but passes each blob and blob prefix to the callbacks as soon
+     * as it's received instead of waiting for the whole segment. The Items and BlobPrefixes of
+     * the returned result are left empty.
+     *
+     * @param delimiter This can be used to to traverse a virtual hierarchy of blobs as though it
+     * were a file system. The delimiter may be a single character or a string.
+     * @param onItem Called with each blob, in order, on the calling thread. If empty, the blobs
+     * are returned in Items.
+     * @param onBlobPrefix Called with each blob prefix, in order, on the calling thread. If empty,
+     * the blob prefixes are returned in BlobPrefixes.
+     * @param options Optional parameters to execute this function.
+     * @return A ListBlobsByHierarchySegmentResult describing a segment of the blobs in the
+     * container.
+     */
+    Azure::Core::Response<Models::ListBlobsByHierarchySegmentResult> ListBlobsByHierarchySegment(
+        const std::string& delimiter,
+        const std::function<void(Models::BlobItem)>& onItem,
+        const std::function<void(Models::BlobPrefix)>& onBlobPrefix,
+        const ListBlobsSegmentOptions& options = ListBlobsSegmentOptions()) const;
+
     /**
      * @brief Gets the permissions for this container. The permissions indicate whether
      * container data may be accessed publicly.
@@ -6,8 +6,11 @@
 #include "azure/storage/blobs/protocol/blob_rest_client.hpp"
 #include "azure/storage/common/access_conditions.hpp"
 #include "azure/storage/common/storage_retry_policy.hpp"
+#include "azure/storage/common/transfer_manager.hpp"
 
+#include <chrono>
 #include <limits>
+#include <memory>
 #include <string>
 #include <utility>
 
@@ -714,6 +717,51 @@ namespace Azure { namespace Storage { namespace Blobs {
      */
     Azure::Core::Nullable<int64_t> Length;
 
+    /**
+     * @brief When this parameter is set to true and specified together with Offset and Length, the
+     * service returns the CRC64 hash for the range, as long as the range is less than or equal to
+     * 4 MB in size.
+     */
+    Azure::Core::Nullable<bool> GetRangeContentCrc64;
+
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
+     */
+    BlobAccessConditions AccessConditions;
+  };
+
+  /**
+   * @brief Optional parameters for BlobClient::ParallelDownload.
+   */
+  struct ParallelDownloadBlobOptions
+  {
+    /**
+     * @brief Context for cancelling long running operations.
+     */
+    Azure::Core::Context Context;
+
+    /**
+     * @brief Downloads only the bytes of the blob from this offset.
+     */
+    Azure::Core::Nullable<int64_t> Offset;
+
+    /**
+     * @brief Returns at most this number of bytes of the blob from the offset. Null means
+     * download until the end.
+     */
+    Azure::Core::Nullable<int64_t> Length;
+
+    /**
+     * @brief The maximum number of bytes in a single request.
+     */
+    Azure::Core::Nullable<int64_t> ChunkSize;
+
+    /**
+     * @brief The maximum number of requests ahead of the read position. Memory use is bounded by
+     * Concurrency times ChunkSize.
+     */
+    int Concurrency = 5;
+
     /**
      * @brief Optional conditions that must be met to perform this operation.
      */
@@ -757,6 +805,36 @@ namespace Azure { namespace Storage { namespace Blobs {
      * @brief The maximum number of threads that may be used in a parallel transfer.
      */
     int Concurrency = 5;
+
+    /**
+     * @brief If true, the service returns a CRC64 for every range, which is checked against the
+     * downloaded data. Ranges are limited to 4 MB. The CRC64 of the whole download is returned in
+     * the result.
+     */
+    bool UseTransactionalCrc64 = false;
+
+    /**
+     * @brief If true, the destination file is sized up front and memory-mapped, and every range is
+     * received straight into the mapping instead of going through a write buffer. Files that
+     * can't be mapped are written as usual. An interrupted download leaves a file of the full
+     * size.
+     */
+    bool UseMemoryMappedFile = false;
+
+    /**
+     * @brief If not empty, the chunks written to the destination file are recorded in this
+     * checkpoint file. If a download to a file fails, starting it again with the same options only
+     * downloads the missing chunks, as long as the blob hasn't changed and the destination file
+     * still holds the recorded chunks. The checkpoint file is deleted once the download completes.
+     * Not used when downloading to a memory buffer.
+     */
+    std::string CheckpointFileName;
+
+    /**
+     * @brief Schedules this transfer with a TransferManager, which can also pause, resume, cancel
+     * and report the progress of it. Null means the transfer is not managed.
+     */
+    std::shared_ptr<Storage::TransferHandle> TransferHandle;
   };
 
   /**
@@ -992,6 +1070,87 @@ namespace Azure { namespace Storage { namespace Blobs {
      * @brief The maximum number of threads that may be used in a parallel transfer.
      */
     int Concurrency = 5;
+
+    /**
+     * @brief If true, a CRC64 is computed for every block and sent to the service to validate it.
+     * The CRC64 of the whole content is returned in the result.
+     */
+    bool UseTransactionalCrc64 = false;
+
+    /**
+     * @brief If true, the file is memory-mapped and every chunk is sent straight from the mapping
+     * instead of being read into a transfer buffer. Files that can't be mapped are read as usual.
+     * The file must not be truncated during the upload.
+     */
+    bool UseMemoryMappedFile = false;
+
+    /**
+     * @brief If not empty, the blocks staged from a file are recorded in this checkpoint file. If
+     * an upload from a file fails, starting it again with the same options only stages the blocks
+     * that are missing from the blob's uncommitted block list. The checkpoint file is started
+     * over if the source file was modified in between. The checkpoint file is deleted once the
+     * upload completes. Not used when uploading from memory or a stream.
+     */
+    std::string CheckpointFileName;
+
+    /**
+     * @brief If true, an upload from a file derives the ID of every block from the CRC64 and
+     * length of its content, and only stages the blocks that the blob doesn't have yet, committed
+     * or uncommitted. The blocks it already has are reused when the block list is committed.
+     */
+    bool IncrementalUpload = false;
+
+    /**
+     * @brief If true, an incremental upload cuts blocks where a rolling hash of the content
+     * matches instead of every ChunkSize bytes, so that bytes inserted into or removed from the
+     * file only change the blocks around the edit. Blocks are about ChunkSize bytes long on
+     * average.
+     */
+    bool UseContentDefinedChunking = false;
+
+    /**
+     * @brief Schedules this transfer with a TransferManager, which can also pause, resume, cancel
+     * and report the progress of it. Null means the transfer is not managed.
+     */
+    std::shared_ptr<Storage::TransferHandle> TransferHandle;
+  };
+
+  /**
+   * @brief Optional parameters for BlockBlobClient::CopyFrom.
+   */
+  struct CopyBlockBlobFromOptions
+  {
+    /**
+     * @brief Context for cancelling long running operations.
+     */
+    Azure::Core::Context Context;
+
+    /**
+     * @brief The standard HTTP header system properties to set. Null means the properties of the
+     * source blob are copied.
+     */
+    Azure::Core::Nullable<Models::BlobHttpHeaders> HttpHeaders;
+
+    /**
+     * @brief Name-value pairs associated with the blob as metadata. Null means the metadata of the
+     * source blob is copied.
+     */
+    Azure::Core::Nullable<std::map<std::string, std::string>> Metadata;
+
+    /**
+     * @brief Indicates the tier to be set on blob.
+     */
+    Azure::Core::Nullable<Models::AccessTier> Tier;
+
+    /**
+     * @brief The maximum number of bytes copied by a single request.
+     */
+    Azure::Core::Nullable<int64_t> ChunkSize;
+
+    /**
+     * @brief The maximum number of requests that may run in parallel.
+     */
+    int Concurrency = 5;
   };
 
   /**
@@ -1183,6 +1342,39 @@ namespace Azure { namespace Storage { namespace Blobs {
     AppendBlobAccessConditions AccessConditions;
   };
 
+  /**
+   * @brief Optional parameters for AppendBlobWriter.
+   */
+  struct AppendBlobWriterOptions
+  {
+    /**
+     * @brief Context for cancelling the AppendBlock requests.
+     */
+    Azure::Core::Context Context;
+
+    /**
+     * @brief The maximum number of bytes appended by a single AppendBlock request, at most 4 MB.
+     * A block is appended as soon as it's full.
+     */
+    int64_t MaxBlockSize = 4 * 1024 * 1024;
+
+    /**
+     * @brief How long written data waits for more writes to group with before it's appended.
+     */
+    std::chrono::milliseconds FlushInterval = std::chrono::milliseconds(50);
+
+    /**
+     * @brief The maximum number of bytes waiting to be appended. Writes block while it's exceeded.
+     */
+    int64_t MaxBufferedSize = 16 * 1024 * 1024;
+
+    /**
+     * @brief Optional conditions that must be met by every AppendBlock request. AppendPosition is
+     * set by the writer.
+     */
+    AppendBlobAccessConditions AccessConditions;
+  };
+
   /**
    * @brief Optional parameters for AppendBlobClient::AppendBlockFromUri.
    */
@@ -1277,6 +1469,152 @@ namespace Azure { namespace Storage { namespace Blobs {
     BlobAccessConditions AccessConditions;
   };
 
+  /**
+   * @brief Optional parameters for PageBlobClient::CopyFrom.
+   */
+  struct CopyPageBlobFromOptions
+  {
+    /**
+     * @brief Context for cancelling long running operations.
+     */
+    Azure::Core::Context Context;
+
+    /**
+     * @brief The standard HTTP header system properties to set. Null means the properties of the
+     * source blob are copied.
+     */
+    Azure::Core::Nullable<Models::BlobHttpHeaders> HttpHeaders;
+
+    /**
+     * @brief Name-value pairs associated with the blob as metadata. Null means the metadata of the
+     * source blob is copied.
+     */
+    Azure::Core::Nullable<std::map<std::string, std::string>> Metadata;
+
+    /**
+     * @brief The maximum number of bytes copied by a single request, a multiple of 512 of at most
+     * 4 MB.
+     */
+    Azure::Core::Nullable<int64_t> ChunkSize;
+
+    /**
+     * @brief The maximum number of requests that may run in parallel.
+     */
+    int Concurrency = 5;
+  };
+
+  /**
+   * @brief Optional parameters for PageBlobClient::UploadFrom.
+   */
+  struct UploadPageBlobFromOptions
+  {
+    /**
+     * @brief Context for cancelling long running operations.
+     */
+    Azure::Core::Context Context;
+
+    /**
+     * @brief The standard HTTP header system properties to set.
+     */
+    Models::BlobHttpHeaders HttpHeaders;
+
+    /**
+     * @brief Name-value pairs associated with the blob as metadata.
+     */
+    std::map<std::string, std::string> Metadata;
+
+    /**
+     * @brief Indicates the tier to be set on the blob.
+     */
+    Azure::Core::Nullable<Models::AccessTier> Tier;
+
+    /**
+     * @brief The size of the ranges that are scanned for zeros and uploaded by one worker, a
+     * multiple of 512 of at most 4 MB.
+     */
+    Azure::Core::Nullable<int64_t> ChunkSize;
+
+    /**
+     * @brief The maximum number of requests that may run in parallel.
+     */
+    int Concurrency = 5;
+
+    /**
+     * @brief Schedules this transfer with a TransferManager, which can also pause, resume, cancel
+     * and report the progress of it. Null means the transfer is not managed.
+     */
+    std::shared_ptr<Storage::TransferHandle> TransferHandle;
+  };
+
+  /**
+   * @brief Optional parameters for PageBlobClient::DownloadPagesTo.
+   */
+  struct DownloadPageBlobToOptions
+  {
+    /**
+     * @brief Context for cancelling long running operations.
+     */
+    Azure::Core::Context Context;
+
+    /**
+     * @brief The maximum number of bytes downloaded by a single request.
+     */
+    Azure::Core::Nullable<int64_t> ChunkSize;
+
+    /**
+     * @brief The maximum number of requests that may run in parallel.
+     */
+    int Concurrency = 5;
+
+    /**
+     * @brief Optional conditions that must be met to perform this operation.
+     */
+    BlobAccessConditions AccessConditions;
+  };
+
+  /**
+   * @brief Optional parameters for PageBlobClient::SyncFromSnapshotDiff.
+   */
+  struct SyncPageBlobFromSnapshotDiffOptions
+  {
+    /**
+     * @brief Context for cancelling long running operations.
+     */
+    Azure::Core::Context Context;
+
+    /**
+     * @brief The maximum number of bytes downloaded by a single request.
+     */
+    Azure::Core::Nullable<int64_t> ChunkSize;
+
+    /**
+     * @brief The maximum number of requests that may run in parallel.
+     */
+    int Concurrency = 5;
+  };
+
+  /**
+   * @brief Optional parameters for PageBlobClient::SyncFromFileDiff.
+   */
+  struct SyncPageBlobFromFileDiffOptions
+  {
+    /**
+     * @brief Context for cancelling long running operations.
+     */
+    Azure::Core::Context Context;
+
+    /**
+     * @brief The number of bytes of the files compared by a single task, a multiple of 512 of at
+     * most 4 MB.
+     */
+    Azure::Core::Nullable<int64_t> ChunkSize;
+
+    /**
+     * @brief The maximum number of tasks that may run in parallel.
+     */
+    int Concurrency = 5;
+  };
+
   /**
    * @brief Optional parameters for PageBlobClient::UploadPages.
    */
@@ -24,9 +24,21 @@ namespace Azure { namespace Storage { namespace Blobs { namespace Models {
     Models::BlobType BlobType = Models::BlobType::Unknown;
     Azure::Core::Nullable<bool> ServerEncrypted;
     Azure::Core::Nullable<std::string> EncryptionKeySha256;
+    Azure::Core::Nullable<std::string> TransactionalContentCrc64;
   };
 
   using UploadBlockBlobFromResult = UploadBlockBlobResult;
+  using CopyBlockBlobFromResult = UploadBlockBlobResult;
+
+  struct CopyPageBlobFromResult
+  {
+    std::string ETag;
+    std::string LastModified;
+    int64_t ContentLength = 0;
+    Azure::Core::Nullable<int64_t> SequenceNumber;
+  };
+
+  using UploadPageBlobFromResult = CopyPageBlobFromResult;
 
   struct PageRange
   {
@@ -154,6 +154,21 @@ namespace Azure { namespace Storage { namespace Blobs {
         const std::string& fileName,
         const UploadBlockBlobFromOptions& options = UploadBlockBlobFromOptions()) const;
 
+    /**
+     * @brief Creates a new block blob, or updates the content of an existing block blob. Updating
+     * an existing block blob overwrites any existing metadata on the blob.
+     *
+     * The stream is read into at most Concurrency buffers of ChunkSize bytes, which are staged
+     * concurrently and committed in order. Reading pauses while all buffers wait to be staged.
+     *
+     * @param content A BodyStream containing the content to upload. It's read until its end.
+     * @param options Optional parameters to execute this function.
+     * @return A UploadBlockBlobFromResult describing the state of the updated block blob.
+     */
+    Azure::Core::Response<Models::UploadBlockBlobFromResult> UploadFrom(
+        Azure::Core::Http::BodyStream& content,
+        const UploadBlockBlobFromOptions& options = UploadBlockBlobFromOptions()) const;
+
     /**
      * @brief Creates a new block as part of a block blob's staging area to be eventually
      * committed via the CommitBlockList operation.
@@ -187,6 +202,21 @@ namespace Azure { namespace Storage { namespace Blobs {
         const std::string& sourceUri,
         const StageBlockFromUriOptions& options = StageBlockFromUriOptions()) const;
 
+    /**
+     * @brief Creates a new block blob, or updates the content of an existing block blob, with the
+     * content of the blob at sourceUri. The source is split into blocks that the service reads
+     * from the source with parallel StageBlockFromUri requests, which are then committed. The
+     * content doesn't pass through this client, and the copy is complete when this returns.
+     *
+     * @param sourceUri Specifies the uri of the source blob. The source blob must either be public
+     * or must be authenticated via a shared access signature. It must not change during the copy.
+     * @param options Optional parameters to execute this function.
+     * @return A CopyBlockBlobFromResult describing the state of the updated block blob.
+     */
+    Azure::Core::Response<Models::CopyBlockBlobFromResult> CopyFrom(
+        const std::string& sourceUri,
+        const CopyBlockBlobFromOptions& options = CopyBlockBlobFromOptions()) const;
+
     /**
      * @brief Writes a blob by specifying the list of block IDs that make up the blob. In order to
      * be written as part of a blob, a block must have been successfully written to the server in a
@@ -163,6 +163,99 @@ namespace Azure { namespace Storage { namespace Blobs {
         const UploadPageBlobPagesFromUriOptions& options
         = UploadPageBlobPagesFromUriOptions()) const;
 
+    /**
+     * @brief Creates a new page blob, or replaces an existing page blob, with the content of the
+     * blob at sourceUri. The service reads the source with parallel UploadPagesFromUri requests.
+     * The content doesn't pass through this client, and the copy is complete when this returns.
+     *
+     * @param sourceUri Specifies the uri of the source blob, whose size must be a multiple of 512.
+     * The source blob must either be public or must be authenticated via a shared access
+     * signature. It must not change during the copy.
+     * @param options Optional parameters to execute this function.
+     * @return A CopyPageBlobFromResult describing the state of the updated page blob.
+     */
+    Azure::Core::Response<Models::CopyPageBlobFromResult> CopyFrom(
+        const std::string& sourceUri,
+        const CopyPageBlobFromOptions& options = CopyPageBlobFromOptions()) const;
+
+    /**
+     * @brief Creates a new page blob, or replaces an existing page blob, with the content of a
+     * buffer, with parallel UploadPages requests. Pages that are all zeros are skipped, since a
+     * new page blob reads as zeros anyway.
+     *
+     * @param buffer A memory buffer containing the content to upload.
+     * @param bufferSize Size of the memory buffer, a multiple of 512.
+     * @param options Optional parameters to execute this function.
+     * @return A UploadPageBlobFromResult describing the state of the updated page blob.
+     */
+    Azure::Core::Response<Models::UploadPageBlobFromResult> UploadFrom(
+        const uint8_t* buffer,
+        std::size_t bufferSize,
+        const UploadPageBlobFromOptions& options = UploadPageBlobFromOptions()) const;
+
+    /**
+     * @brief Creates a new page blob, or replaces an existing page blob, with the content of a
+     * file, such as a disk image, with parallel UploadPages requests. Holes of a sparse file
+     * aren't read, and pages that are all zeros are skipped, since a new page blob reads as zeros
+     * anyway.
+     *
+     * @param fileName A file containing the content to upload, whose size is a multiple of 512.
+     * @param options Optional parameters to execute this function.
+     * @return A UploadPageBlobFromResult describing the state of the updated page blob.
+     */
+    Azure::Core::Response<Models::UploadPageBlobFromResult> UploadFrom(
+        const std::string& fileName,
+        const UploadPageBlobFromOptions& options = UploadPageBlobFromOptions()) const;
+
+    /**
+     * @brief Downloads the page ranges of the page blob that hold data into a sparse file, with
+     * parallel requests. The rest of the file is left as holes, which read as zeros.
+     *
+     * @param fileName A file path to write the downloaded content to.
+     * @param options Optional parameters to execute this function.
+     * @return A DownloadBlobToResult describing the downloaded blob.
+     */
+    Azure::Core::Response<Models::DownloadBlobToResult> DownloadPagesTo(
+        const std::string& fileName,
+        const DownloadPageBlobToOptions& options = DownloadPageBlobToOptions()) const;
+
+    /**
+     * @brief Brings a local copy of the page blob's \p baseSnapshot up to date with its
+     * \p newSnapshot, for example for an incremental backup of a disk. Only the pages that
+     * changed between the snapshots are downloaded, with parallel requests, and the pages that
+     * were cleared are zeroed in the file.
+     *
+     * @param fileName A file holding the content of the base snapshot, for example one written by
+     * DownloadPagesTo. It's resized to the size of the new snapshot.
+     * @param baseSnapshot The snapshot the file holds.
+     * @param newSnapshot The snapshot to bring the file up to date with.
+     * @param options Optional parameters to execute this function.
+     * @return A DownloadBlobToResult describing the new snapshot.
+     */
+    Azure::Core::Response<Models::DownloadBlobToResult> SyncFromSnapshotDiff(
+        const std::string& fileName,
+        const std::string& baseSnapshot,
+        const std::string& newSnapshot,
+        const SyncPageBlobFromSnapshotDiffOptions& options
+        = SyncPageBlobFromSnapshotDiffOptions()) const;
+
+    /**
+     * @brief Updates an existing page blob that holds the content of \p baseFileName to the
+     * content of \p fileName, for example to push the changes made to a local disk image. The
+     * files are compared page by page, changed pages are uploaded with parallel UploadPages
+     * requests and pages that became all zeros are cleared. The blob is resized if the size of the
+     * image changed.
+     *
+     * @param fileName The local image, whose size is a multiple of 512.
+     * @param baseFileName A copy of the image as it was when the blob was last updated.
+     * @param options Optional parameters to execute this function.
+     * @return A UploadPageBlobFromResult describing the state of the updated page blob.
+     */
+    Azure::Core::Response<Models::UploadPageBlobFromResult> SyncFromFileDiff(
+        const std::string& fileName,
+        const std::string& baseFileName,
+        const SyncPageBlobFromFileDiffOptions& options = SyncPageBlobFromFileDiffOptions()) const;
+
     /**
      * @brief Clears one or more pages from the page blob, as specificed by offset and length.
      *
@@ -14,7 +14,9 @@
 #include "azure/storage/common/storage_exception.hpp"
 #include "azure/storage/common/xml_wrapper.hpp"
 
+#include <algorithm>
 #include <cstring>
+#include <functional>
 #include <limits>
 #include <map>
 #include <set>
@@ -2082,30 +2084,43 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::k_EnumerationResults);
-              }
-              else if (std::strcmp(node.Name, "Where") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Where);
-              }
-              else if (std::strcmp(node.Name, "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::k_NextMarker);
-              }
-              else if (std::strcmp(node.Name, "Blobs") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Blobs);
-              }
-              else if (std::strcmp(node.Name, "Blob") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Blob);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("EnumerationResults"):
+                  if (std::strcmp(node.Name, "EnumerationResults") == 0)
+                  {
+                    tag = XmlTagName::k_EnumerationResults;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Where"):
+                  if (std::strcmp(node.Name, "Where") == 0)
+                  {
+                    tag = XmlTagName::k_Where;
+                  }
+                  break;
+                case Storage::Details::StaticHash("NextMarker"):
+                  if (std::strcmp(node.Name, "NextMarker") == 0)
+                  {
+                    tag = XmlTagName::k_NextMarker;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Blobs"):
+                  if (std::strcmp(node.Name, "Blobs") == 0)
+                  {
+                    tag = XmlTagName::k_Blobs;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Blob"):
+                  if (std::strcmp(node.Name, "Blob") == 0)
+                  {
+                    tag = XmlTagName::k_Blob;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
                   && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
               {
@@ -2177,46 +2192,67 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "StorageServiceProperties") == 0)
-              {
-                path.emplace_back(XmlTagName::k_StorageServiceProperties);
-              }
-              else if (std::strcmp(node.Name, "Logging") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Logging);
-              }
-              else if (std::strcmp(node.Name, "HourMetrics") == 0)
-              {
-                path.emplace_back(XmlTagName::k_HourMetrics);
-              }
-              else if (std::strcmp(node.Name, "MinuteMetrics") == 0)
-              {
-                path.emplace_back(XmlTagName::k_MinuteMetrics);
-              }
-              else if (std::strcmp(node.Name, "Cors") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Cors);
-              }
-              else if (std::strcmp(node.Name, "CorsRule") == 0)
-              {
-                path.emplace_back(XmlTagName::k_CorsRule);
-              }
-              else if (std::strcmp(node.Name, "DefaultServiceVersion") == 0)
-              {
-                path.emplace_back(XmlTagName::k_DefaultServiceVersion);
-              }
-              else if (std::strcmp(node.Name, "DeleteRetentionPolicy") == 0)
-              {
-                path.emplace_back(XmlTagName::k_DeleteRetentionPolicy);
-              }
-              else if (std::strcmp(node.Name, "StaticWebsite") == 0)
-              {
-                path.emplace_back(XmlTagName::k_StaticWebsite);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("StorageServiceProperties"):
+                  if (std::strcmp(node.Name, "StorageServiceProperties") == 0)
+                  {
+                    tag = XmlTagName::k_StorageServiceProperties;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Logging"):
+                  if (std::strcmp(node.Name, "Logging") == 0)
+                  {
+                    tag = XmlTagName::k_Logging;
+                  }
+                  break;
+                case Storage::Details::StaticHash("HourMetrics"):
+                  if (std::strcmp(node.Name, "HourMetrics") == 0)
+                  {
+                    tag = XmlTagName::k_HourMetrics;
+                  }
+                  break;
+                case Storage::Details::StaticHash("MinuteMetrics"):
+                  if (std::strcmp(node.Name, "MinuteMetrics") == 0)
+                  {
+                    tag = XmlTagName::k_MinuteMetrics;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Cors"):
+                  if (std::strcmp(node.Name, "Cors") == 0)
+                  {
+                    tag = XmlTagName::k_Cors;
+                  }
+                  break;
+                case Storage::Details::StaticHash("CorsRule"):
+                  if (std::strcmp(node.Name, "CorsRule") == 0)
+                  {
+                    tag = XmlTagName::k_CorsRule;
+                  }
+                  break;
+                case Storage::Details::StaticHash("DefaultServiceVersion"):
+                  if (std::strcmp(node.Name, "DefaultServiceVersion") == 0)
+                  {
+                    tag = XmlTagName::k_DefaultServiceVersion;
+                  }
+                  break;
+                case Storage::Details::StaticHash("DeleteRetentionPolicy"):
+                  if (std::strcmp(node.Name, "DeleteRetentionPolicy") == 0)
+                  {
+                    tag = XmlTagName::k_DeleteRetentionPolicy;
+                  }
+                  break;
+                case Storage::Details::StaticHash("StaticWebsite"):
+                  if (std::strcmp(node.Name, "StaticWebsite") == 0)
+                  {
+                    tag = XmlTagName::k_StaticWebsite;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 2 && path[0] == XmlTagName::k_StorageServiceProperties
                   && path[1] == XmlTagName::k_Logging)
               {
@@ -2365,42 +2401,61 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "UserDelegationKey") == 0)
-              {
-                path.emplace_back(XmlTagName::k_UserDelegationKey);
-              }
-              else if (std::strcmp(node.Name, "SignedOid") == 0)
-              {
-                path.emplace_back(XmlTagName::k_SignedOid);
-              }
-              else if (std::strcmp(node.Name, "SignedTid") == 0)
-              {
-                path.emplace_back(XmlTagName::k_SignedTid);
-              }
-              else if (std::strcmp(node.Name, "SignedStart") == 0)
-              {
-                path.emplace_back(XmlTagName::k_SignedStart);
-              }
-              else if (std::strcmp(node.Name, "SignedExpiry") == 0)
-              {
-                path.emplace_back(XmlTagName::k_SignedExpiry);
-              }
-              else if (std::strcmp(node.Name, "SignedService") == 0)
-              {
-                path.emplace_back(XmlTagName::k_SignedService);
-              }
-              else if (std::strcmp(node.Name, "SignedVersion") == 0)
-              {
-                path.emplace_back(XmlTagName::k_SignedVersion);
-              }
-              else if (std::strcmp(node.Name, "Value") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Value);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("UserDelegationKey"):
+                  if (std::strcmp(node.Name, "UserDelegationKey") == 0)
+                  {
+                    tag = XmlTagName::k_UserDelegationKey;
+                  }
+                  break;
+                case Storage::Details::StaticHash("SignedOid"):
+                  if (std::strcmp(node.Name, "SignedOid") == 0)
+                  {
+                    tag = XmlTagName::k_SignedOid;
+                  }
+                  break;
+                case Storage::Details::StaticHash("SignedTid"):
+                  if (std::strcmp(node.Name, "SignedTid") == 0)
+                  {
+                    tag = XmlTagName::k_SignedTid;
+                  }
+                  break;
+                case Storage::Details::StaticHash("SignedStart"):
+                  if (std::strcmp(node.Name, "SignedStart") == 0)
+                  {
+                    tag = XmlTagName::k_SignedStart;
+                  }
+                  break;
+                case Storage::Details::StaticHash("SignedExpiry"):
+                  if (std::strcmp(node.Name, "SignedExpiry") == 0)
+                  {
+                    tag = XmlTagName::k_SignedExpiry;
+                  }
+                  break;
+                case Storage::Details::StaticHash("SignedService"):
+                  if (std::strcmp(node.Name, "SignedService") == 0)
+                  {
+                    tag = XmlTagName::k_SignedService;
+                  }
+                  break;
+                case Storage::Details::StaticHash("SignedVersion"):
+                  if (std::strcmp(node.Name, "SignedVersion") == 0)
+                  {
+                    tag = XmlTagName::k_SignedVersion;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Value"):
+                  if (std::strcmp(node.Name, "Value") == 0)
+                  {
+                    tag = XmlTagName::k_Value;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
             }
             else if (node.Type == Storage::Details::XmlNodeType::Text)
             {
@@ -2485,34 +2540,49 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::k_EnumerationResults);
-              }
-              else if (std::strcmp(node.Name, "Prefix") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Prefix);
-              }
-              else if (std::strcmp(node.Name, "Marker") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Marker);
-              }
-              else if (std::strcmp(node.Name, "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::k_NextMarker);
-              }
-              else if (std::strcmp(node.Name, "Containers") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Containers);
-              }
-              else if (std::strcmp(node.Name, "Container") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Container);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("EnumerationResults"):
+                  if (std::strcmp(node.Name, "EnumerationResults") == 0)
+                  {
+                    tag = XmlTagName::k_EnumerationResults;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Prefix"):
+                  if (std::strcmp(node.Name, "Prefix") == 0)
+                  {
+                    tag = XmlTagName::k_Prefix;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Marker"):
+                  if (std::strcmp(node.Name, "Marker") == 0)
+                  {
+                    tag = XmlTagName::k_Marker;
+                  }
+                  break;
+                case Storage::Details::StaticHash("NextMarker"):
+                  if (std::strcmp(node.Name, "NextMarker") == 0)
+                  {
+                    tag = XmlTagName::k_NextMarker;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Containers"):
+                  if (std::strcmp(node.Name, "Containers") == 0)
+                  {
+                    tag = XmlTagName::k_Containers;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Container"):
+                  if (std::strcmp(node.Name, "Container") == 0)
+                  {
+                    tag = XmlTagName::k_Container;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
                   && path[1] == XmlTagName::k_Containers && path[2] == XmlTagName::k_Container)
               {
@@ -2585,30 +2655,43 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "Version") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Version);
-              }
-              else if (std::strcmp(node.Name, "Delete") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Delete);
-              }
-              else if (std::strcmp(node.Name, "Read") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Read);
-              }
-              else if (std::strcmp(node.Name, "Write") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Write);
-              }
-              else if (std::strcmp(node.Name, "RetentionPolicy") == 0)
-              {
-                path.emplace_back(XmlTagName::k_RetentionPolicy);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Version"):
+                  if (std::strcmp(node.Name, "Version") == 0)
+                  {
+                    tag = XmlTagName::k_Version;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Delete"):
+                  if (std::strcmp(node.Name, "Delete") == 0)
+                  {
+                    tag = XmlTagName::k_Delete;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Read"):
+                  if (std::strcmp(node.Name, "Read") == 0)
+                  {
+                    tag = XmlTagName::k_Read;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Write"):
+                  if (std::strcmp(node.Name, "Write") == 0)
+                  {
+                    tag = XmlTagName::k_Write;
+                  }
+                  break;
+                case Storage::Details::StaticHash("RetentionPolicy"):
+                  if (std::strcmp(node.Name, "RetentionPolicy") == 0)
+                  {
+                    tag = XmlTagName::k_RetentionPolicy;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 1 && path[0] == XmlTagName::k_RetentionPolicy)
               {
                 ret.RetentionPolicy = BlobRetentionPolicyFromXml(reader);
@@ -2683,78 +2766,115 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "Name") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Name);
-              }
-              else if (std::strcmp(node.Name, "Properties") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Properties);
-              }
-              else if (std::strcmp(node.Name, "Etag") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Etag);
-              }
-              else if (std::strcmp(node.Name, "Last-Modified") == 0)
-              {
-                path.emplace_back(XmlTagName::k_LastModified);
-              }
-              else if (std::strcmp(node.Name, "PublicAccess") == 0)
-              {
-                path.emplace_back(XmlTagName::k_PublicAccess);
-              }
-              else if (std::strcmp(node.Name, "HasImmutabilityPolicy") == 0)
-              {
-                path.emplace_back(XmlTagName::k_HasImmutabilityPolicy);
-              }
-              else if (std::strcmp(node.Name, "HasLegalHold") == 0)
-              {
-                path.emplace_back(XmlTagName::k_HasLegalHold);
-              }
-              else if (std::strcmp(node.Name, "LeaseStatus") == 0)
-              {
-                path.emplace_back(XmlTagName::k_LeaseStatus);
-              }
-              else if (std::strcmp(node.Name, "LeaseState") == 0)
-              {
-                path.emplace_back(XmlTagName::k_LeaseState);
-              }
-              else if (std::strcmp(node.Name, "LeaseDuration") == 0)
-              {
-                path.emplace_back(XmlTagName::k_LeaseDuration);
-              }
-              else if (std::strcmp(node.Name, "DefaultEncryptionScope") == 0)
-              {
-                path.emplace_back(XmlTagName::k_DefaultEncryptionScope);
-              }
-              else if (std::strcmp(node.Name, "DenyEncryptionScopeOverride") == 0)
-              {
-                path.emplace_back(XmlTagName::k_DenyEncryptionScopeOverride);
-              }
-              else if (std::strcmp(node.Name, "Metadata") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Metadata);
-              }
-              else if (std::strcmp(node.Name, "Deleted") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Deleted);
-              }
-              else if (std::strcmp(node.Name, "Version") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Version);
-              }
-              else if (std::strcmp(node.Name, "DeletedTime") == 0)
-              {
-                path.emplace_back(XmlTagName::k_DeletedTime);
-              }
-              else if (std::strcmp(node.Name, "RemainingRetentionDays") == 0)
-              {
-                path.emplace_back(XmlTagName::k_RemainingRetentionDays);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Name"):
+                  if (std::strcmp(node.Name, "Name") == 0)
+                  {
+                    tag = XmlTagName::k_Name;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Properties"):
+                  if (std::strcmp(node.Name, "Properties") == 0)
+                  {
+                    tag = XmlTagName::k_Properties;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Etag"):
+                  if (std::strcmp(node.Name, "Etag") == 0)
+                  {
+                    tag = XmlTagName::k_Etag;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Last-Modified"):
+                  if (std::strcmp(node.Name, "Last-Modified") == 0)
+                  {
+                    tag = XmlTagName::k_LastModified;
+                  }
+                  break;
+                case Storage::Details::StaticHash("PublicAccess"):
+                  if (std::strcmp(node.Name, "PublicAccess") == 0)
+                  {
+                    tag = XmlTagName::k_PublicAccess;
+                  }
+                  break;
+                case Storage::Details::StaticHash("HasImmutabilityPolicy"):
+                  if (std::strcmp(node.Name, "HasImmutabilityPolicy") == 0)
+                  {
+                    tag = XmlTagName::k_HasImmutabilityPolicy;
+                  }
+                  break;
+                case Storage::Details::StaticHash("HasLegalHold"):
+                  if (std::strcmp(node.Name, "HasLegalHold") == 0)
+                  {
+                    tag = XmlTagName::k_HasLegalHold;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LeaseStatus"):
+                  if (std::strcmp(node.Name, "LeaseStatus") == 0)
+                  {
+                    tag = XmlTagName::k_LeaseStatus;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LeaseState"):
+                  if (std::strcmp(node.Name, "LeaseState") == 0)
+                  {
+                    tag = XmlTagName::k_LeaseState;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LeaseDuration"):
+                  if (std::strcmp(node.Name, "LeaseDuration") == 0)
+                  {
+                    tag = XmlTagName::k_LeaseDuration;
+                  }
+                  break;
+                case Storage::Details::StaticHash("DefaultEncryptionScope"):
+                  if (std::strcmp(node.Name, "DefaultEncryptionScope") == 0)
+                  {
+                    tag = XmlTagName::k_DefaultEncryptionScope;
+                  }
+                  break;
+                case Storage::Details::StaticHash("DenyEncryptionScopeOverride"):
+                  if (std::strcmp(node.Name, "DenyEncryptionScopeOverride") == 0)
+                  {
+                    tag = XmlTagName::k_DenyEncryptionScopeOverride;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Metadata"):
+                  if (std::strcmp(node.Name, "Metadata") == 0)
+                  {
+                    tag = XmlTagName::k_Metadata;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Deleted"):
+                  if (std::strcmp(node.Name, "Deleted") == 0)
+                  {
+                    tag = XmlTagName::k_Deleted;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Version"):
+                  if (std::strcmp(node.Name, "Version") == 0)
+                  {
+                    tag = XmlTagName::k_Version;
+                  }
+                  break;
+                case Storage::Details::StaticHash("DeletedTime"):
+                  if (std::strcmp(node.Name, "DeletedTime") == 0)
+                  {
+                    tag = XmlTagName::k_DeletedTime;
+                  }
+                  break;
+                case Storage::Details::StaticHash("RemainingRetentionDays"):
+                  if (std::strcmp(node.Name, "RemainingRetentionDays") == 0)
+                  {
+                    tag = XmlTagName::k_RemainingRetentionDays;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 1 && path[0] == XmlTagName::k_Metadata)
               {
                 ret.Metadata = MetadataFromXml(reader);
@@ -2885,30 +3005,43 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "AllowedOrigins") == 0)
-              {
-                path.emplace_back(XmlTagName::k_AllowedOrigins);
-              }
-              else if (std::strcmp(node.Name, "AllowedMethods") == 0)
-              {
-                path.emplace_back(XmlTagName::k_AllowedMethods);
-              }
-              else if (std::strcmp(node.Name, "MaxAgeInSeconds") == 0)
-              {
-                path.emplace_back(XmlTagName::k_MaxAgeInSeconds);
-              }
-              else if (std::strcmp(node.Name, "ExposedHeaders") == 0)
-              {
-                path.emplace_back(XmlTagName::k_ExposedHeaders);
-              }
-              else if (std::strcmp(node.Name, "AllowedHeaders") == 0)
-              {
-                path.emplace_back(XmlTagName::k_AllowedHeaders);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("AllowedOrigins"):
+                  if (std::strcmp(node.Name, "AllowedOrigins") == 0)
+                  {
+                    tag = XmlTagName::k_AllowedOrigins;
+                  }
+                  break;
+                case Storage::Details::StaticHash("AllowedMethods"):
+                  if (std::strcmp(node.Name, "AllowedMethods") == 0)
+                  {
+                    tag = XmlTagName::k_AllowedMethods;
+                  }
+                  break;
+                case Storage::Details::StaticHash("MaxAgeInSeconds"):
+                  if (std::strcmp(node.Name, "MaxAgeInSeconds") == 0)
+                  {
+                    tag = XmlTagName::k_MaxAgeInSeconds;
+                  }
+                  break;
+                case Storage::Details::StaticHash("ExposedHeaders"):
+                  if (std::strcmp(node.Name, "ExposedHeaders") == 0)
+                  {
+                    tag = XmlTagName::k_ExposedHeaders;
+                  }
+                  break;
+                case Storage::Details::StaticHash("AllowedHeaders"):
+                  if (std::strcmp(node.Name, "AllowedHeaders") == 0)
+                  {
+                    tag = XmlTagName::k_AllowedHeaders;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
             }
             else if (node.Type == Storage::Details::XmlNodeType::Text)
             {
@@ -3027,26 +3160,37 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "Version") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Version);
-              }
-              else if (std::strcmp(node.Name, "Enabled") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Enabled);
-              }
-              else if (std::strcmp(node.Name, "IncludeAPIs") == 0)
-              {
-                path.emplace_back(XmlTagName::k_IncludeAPIs);
-              }
-              else if (std::strcmp(node.Name, "RetentionPolicy") == 0)
-              {
-                path.emplace_back(XmlTagName::k_RetentionPolicy);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Version"):
+                  if (std::strcmp(node.Name, "Version") == 0)
+                  {
+                    tag = XmlTagName::k_Version;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Enabled"):
+                  if (std::strcmp(node.Name, "Enabled") == 0)
+                  {
+                    tag = XmlTagName::k_Enabled;
+                  }
+                  break;
+                case Storage::Details::StaticHash("IncludeAPIs"):
+                  if (std::strcmp(node.Name, "IncludeAPIs") == 0)
+                  {
+                    tag = XmlTagName::k_IncludeAPIs;
+                  }
+                  break;
+                case Storage::Details::StaticHash("RetentionPolicy"):
+                  if (std::strcmp(node.Name, "RetentionPolicy") == 0)
+                  {
+                    tag = XmlTagName::k_RetentionPolicy;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 1 && path[0] == XmlTagName::k_RetentionPolicy)
               {
                 ret.RetentionPolicy = BlobRetentionPolicyFromXml(reader);
@@ -3162,26 +3306,37 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "Enabled") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Enabled);
-              }
-              else if (std::strcmp(node.Name, "IndexDocument") == 0)
-              {
-                path.emplace_back(XmlTagName::k_IndexDocument);
-              }
-              else if (std::strcmp(node.Name, "DefaultIndexDocumentPath") == 0)
-              {
-                path.emplace_back(XmlTagName::k_DefaultIndexDocumentPath);
-              }
-              else if (std::strcmp(node.Name, "ErrorDocument404Path") == 0)
-              {
-                path.emplace_back(XmlTagName::k_ErrorDocument404Path);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Enabled"):
+                  if (std::strcmp(node.Name, "Enabled") == 0)
+                  {
+                    tag = XmlTagName::k_Enabled;
+                  }
+                  break;
+                case Storage::Details::StaticHash("IndexDocument"):
+                  if (std::strcmp(node.Name, "IndexDocument") == 0)
+                  {
+                    tag = XmlTagName::k_IndexDocument;
+                  }
+                  break;
+                case Storage::Details::StaticHash("DefaultIndexDocumentPath"):
+                  if (std::strcmp(node.Name, "DefaultIndexDocumentPath") == 0)
+                  {
+                    tag = XmlTagName::k_DefaultIndexDocumentPath;
+                  }
+                  break;
+                case Storage::Details::StaticHash("ErrorDocument404Path"):
+                  if (std::strcmp(node.Name, "ErrorDocument404Path") == 0)
+                  {
+                    tag = XmlTagName::k_ErrorDocument404Path;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
             }
             else if (node.Type == Storage::Details::XmlNodeType::Text)
             {
@@ -3825,6 +3980,9 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Core::Nullable<std::string> ContinuationToken;
           Azure::Core::Nullable<int32_t> MaxResults;
           ListBlobsIncludeItem Include = ListBlobsIncludeItem::None;
+          // If set, the response is parsed as it's received and blob items are passed to this
+          // function instead of being added to the result.
+          std::function<void(BlobItem)> OnItem;
         }; // struct ListBlobsFlatSegmentOptions
 
         static Azure::Core::Response<ListBlobsFlatSegmentResult> ListBlobsFlat(
@@ -3834,7 +3992,9 @@ namespace Azure { namespace Storage { namespace Blobs {
             const ListBlobsFlatSegmentOptions& options)
         {
           unused(options);
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+          const bool streaming = static_cast<bool>(options.OnItem);
+          auto request
+              = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url, streaming);
           request.AddHeader("x-ms-version", c_ApiVersion);
           if (options.Timeout.HasValue())
           {
@@ -3875,11 +4035,18 @@ namespace Azure { namespace Storage { namespace Blobs {
           {
             throw StorageException::CreateFromResponse(std::move(pHttpResponse));
           }
+          if (streaming)
+          {
+            auto bodyStream = httpResponse.GetBodyStream();
+            Storage::Details::XmlReader reader(context, *bodyStream);
+            response = ListBlobsFlatSegmentResultFromXml(reader, options.OnItem);
+          }
+          else
           {
             const auto& httpResponseBody = httpResponse.GetBody();
             Storage::Details::XmlReader reader(
                 reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = ListBlobsFlatSegmentResultFromXml(reader);
+            response = ListBlobsFlatSegmentResultFromXml(reader, options.OnItem);
           }
           return Azure::Core::Response<ListBlobsFlatSegmentResult>(
               std::move(response), std::move(pHttpResponse));
@@ -3893,6 +4060,10 @@ namespace Azure { namespace Storage { namespace Blobs {
           Azure::Core::Nullable<std::string> ContinuationToken;
           Azure::Core::Nullable<int32_t> MaxResults;
           ListBlobsIncludeItem Include = ListBlobsIncludeItem::None;
+          // If set, the response is parsed as it's received and blob items or prefixes are passed
+          // to these functions instead of being added to the result.
+          std::function<void(BlobItem)> OnItem;
+          std::function<void(BlobPrefix)> OnBlobPrefix;
         }; // struct ListBlobsByHierarchySegmentOptions
 
         static Azure::Core::Response<ListBlobsByHierarchySegmentResult> ListBlobsByHierarchy(
@@ -3902,7 +4073,9 @@ namespace Azure { namespace Storage { namespace Blobs {
             const ListBlobsByHierarchySegmentOptions& options)
         {
           unused(options);
-          auto request = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url);
+          const bool streaming = options.OnItem || options.OnBlobPrefix;
+          auto request
+              = Azure::Core::Http::Request(Azure::Core::Http::HttpMethod::Get, url, streaming);
           request.AddHeader("x-ms-version", c_ApiVersion);
           if (options.Timeout.HasValue())
           {
@@ -3949,11 +4122,20 @@ namespace Azure { namespace Storage { namespace Blobs {
           {
             throw StorageException::CreateFromResponse(std::move(pHttpResponse));
           }
+          if (streaming)
+          {
+            auto bodyStream = httpResponse.GetBodyStream();
+            Storage::Details::XmlReader reader(context, *bodyStream);
+            response = ListBlobsByHierarchySegmentResultFromXml(
+                reader, options.OnItem, options.OnBlobPrefix);
+          }
+          else
           {
             const auto& httpResponseBody = httpResponse.GetBody();
             Storage::Details::XmlReader reader(
                 reinterpret_cast<const char*>(httpResponseBody.data()), httpResponseBody.size());
-            response = ListBlobsByHierarchySegmentResultFromXml(reader);
+            response = ListBlobsByHierarchySegmentResultFromXml(
+                reader, options.OnItem, options.OnBlobPrefix);
           }
           return Azure::Core::Response<ListBlobsByHierarchySegmentResult>(
               std::move(response), std::move(pHttpResponse));
@@ -4404,7 +4586,9 @@ namespace Azure { namespace Storage { namespace Blobs {
         }
 
         static ListBlobsByHierarchySegmentResult ListBlobsByHierarchySegmentResultFromXml(
-            Storage::Details::XmlReader& reader)
+            Storage::Details::XmlReader& reader,
+            const std::function<void(BlobItem)>& onItem,
+            const std::function<void(BlobPrefix)>& onBlobPrefix)
         {
           ListBlobsByHierarchySegmentResult ret;
           enum class XmlTagName
@@ -4440,53 +4624,86 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::k_EnumerationResults);
-              }
-              else if (std::strcmp(node.Name, "Prefix") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Prefix);
-              }
-              else if (std::strcmp(node.Name, "Delimiter") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Delimiter);
-              }
-              else if (std::strcmp(node.Name, "Marker") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Marker);
-              }
-              else if (std::strcmp(node.Name, "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::k_NextMarker);
-              }
-              else if (std::strcmp(node.Name, "Blobs") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Blobs);
-              }
-              else if (std::strcmp(node.Name, "Blob") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Blob);
-              }
-              else if (std::strcmp(node.Name, "BlobPrefix") == 0)
-              {
-                path.emplace_back(XmlTagName::k_BlobPrefix);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("EnumerationResults"):
+                  if (std::strcmp(node.Name, "EnumerationResults") == 0)
+                  {
+                    tag = XmlTagName::k_EnumerationResults;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Prefix"):
+                  if (std::strcmp(node.Name, "Prefix") == 0)
+                  {
+                    tag = XmlTagName::k_Prefix;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Delimiter"):
+                  if (std::strcmp(node.Name, "Delimiter") == 0)
+                  {
+                    tag = XmlTagName::k_Delimiter;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Marker"):
+                  if (std::strcmp(node.Name, "Marker") == 0)
+                  {
+                    tag = XmlTagName::k_Marker;
+                  }
+                  break;
+                case Storage::Details::StaticHash("NextMarker"):
+                  if (std::strcmp(node.Name, "NextMarker") == 0)
+                  {
+                    tag = XmlTagName::k_NextMarker;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Blobs"):
+                  if (std::strcmp(node.Name, "Blobs") == 0)
+                  {
+                    tag = XmlTagName::k_Blobs;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Blob"):
+                  if (std::strcmp(node.Name, "Blob") == 0)
+                  {
+                    tag = XmlTagName::k_Blob;
+                  }
+                  break;
+                case Storage::Details::StaticHash("BlobPrefix"):
+                  if (std::strcmp(node.Name, "BlobPrefix") == 0)
+                  {
+                    tag = XmlTagName::k_BlobPrefix;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
                   && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
               {
-                ret.Items.emplace_back(BlobItemFromXml(reader));
+                if (onItem)
+                {
+                  onItem(BlobItemFromXml(reader));
+                }
+                else
+                {
+                  ret.Items.emplace_back(BlobItemFromXml(reader));
+                }
                 path.pop_back();
               }
               else if (
                   path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
                   && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_BlobPrefix)
               {
-                ret.BlobPrefixes.emplace_back(BlobPrefixFromXml(reader));
+                if (onBlobPrefix)
+                {
+                  onBlobPrefix(BlobPrefixFromXml(reader));
+                }
+                else
+                {
+                  ret.BlobPrefixes.emplace_back(BlobPrefixFromXml(reader));
+                }
                 path.pop_back();
               }
             }
@@ -4535,7 +4752,8 @@ namespace Azure { namespace Storage { namespace Blobs {
         }
 
         static ListBlobsFlatSegmentResult ListBlobsFlatSegmentResultFromXml(
-            Storage::Details::XmlReader& reader)
+            Storage::Details::XmlReader& reader,
+            const std::function<void(BlobItem)>& onItem)
         {
           ListBlobsFlatSegmentResult ret;
           enum class XmlTagName
@@ -4569,38 +4787,60 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::k_EnumerationResults);
-              }
-              else if (std::strcmp(node.Name, "Prefix") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Prefix);
-              }
-              else if (std::strcmp(node.Name, "Marker") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Marker);
-              }
-              else if (std::strcmp(node.Name, "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::k_NextMarker);
-              }
-              else if (std::strcmp(node.Name, "Blobs") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Blobs);
-              }
-              else if (std::strcmp(node.Name, "Blob") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Blob);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("EnumerationResults"):
+                  if (std::strcmp(node.Name, "EnumerationResults") == 0)
+                  {
+                    tag = XmlTagName::k_EnumerationResults;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Prefix"):
+                  if (std::strcmp(node.Name, "Prefix") == 0)
+                  {
+                    tag = XmlTagName::k_Prefix;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Marker"):
+                  if (std::strcmp(node.Name, "Marker") == 0)
+                  {
+                    tag = XmlTagName::k_Marker;
+                  }
+                  break;
+                case Storage::Details::StaticHash("NextMarker"):
+                  if (std::strcmp(node.Name, "NextMarker") == 0)
+                  {
+                    tag = XmlTagName::k_NextMarker;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Blobs"):
+                  if (std::strcmp(node.Name, "Blobs") == 0)
+                  {
+                    tag = XmlTagName::k_Blobs;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Blob"):
+                  if (std::strcmp(node.Name, "Blob") == 0)
+                  {
+                    tag = XmlTagName::k_Blob;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 3 && path[0] == XmlTagName::k_EnumerationResults
                   && path[1] == XmlTagName::k_Blobs && path[2] == XmlTagName::k_Blob)
               {
-                ret.Items.emplace_back(BlobItemFromXml(reader));
+                if (onItem)
+                {
+                  onItem(BlobItemFromXml(reader));
+                }
+                else
+                {
+                  ret.Items.emplace_back(BlobItemFromXml(reader));
+                }
                 path.pop_back();
               }
             }
@@ -4700,130 +4940,193 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "Name") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Name);
-              }
-              else if (std::strcmp(node.Name, "Deleted") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Deleted);
-              }
-              else if (std::strcmp(node.Name, "Snapshot") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Snapshot);
-              }
-              else if (std::strcmp(node.Name, "VersionId") == 0)
-              {
-                path.emplace_back(XmlTagName::k_VersionId);
-              }
-              else if (std::strcmp(node.Name, "IsCurrentVersion") == 0)
-              {
-                path.emplace_back(XmlTagName::k_IsCurrentVersion);
-              }
-              else if (std::strcmp(node.Name, "Properties") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Properties);
-              }
-              else if (std::strcmp(node.Name, "Content-Type") == 0)
-              {
-                path.emplace_back(XmlTagName::k_ContentType);
-              }
-              else if (std::strcmp(node.Name, "Content-Encoding") == 0)
-              {
-                path.emplace_back(XmlTagName::k_ContentEncoding);
-              }
-              else if (std::strcmp(node.Name, "Content-Language") == 0)
-              {
-                path.emplace_back(XmlTagName::k_ContentLanguage);
-              }
-              else if (std::strcmp(node.Name, "Content-MD5") == 0)
-              {
-                path.emplace_back(XmlTagName::k_ContentMD5);
-              }
-              else if (std::strcmp(node.Name, "Cache-Control") == 0)
-              {
-                path.emplace_back(XmlTagName::k_CacheControl);
-              }
-              else if (std::strcmp(node.Name, "Content-Disposition") == 0)
-              {
-                path.emplace_back(XmlTagName::k_ContentDisposition);
-              }
-              else if (std::strcmp(node.Name, "Creation-Time") == 0)
-              {
-                path.emplace_back(XmlTagName::k_CreationTime);
-              }
-              else if (std::strcmp(node.Name, "Expiry-Time") == 0)
-              {
-                path.emplace_back(XmlTagName::k_ExpiryTime);
-              }
-              else if (std::strcmp(node.Name, "LastAccessTime") == 0)
-              {
-                path.emplace_back(XmlTagName::k_LastAccessTime);
-              }
-              else if (std::strcmp(node.Name, "Last-Modified") == 0)
-              {
-                path.emplace_back(XmlTagName::k_LastModified);
-              }
-              else if (std::strcmp(node.Name, "Etag") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Etag);
-              }
-              else if (std::strcmp(node.Name, "Content-Length") == 0)
-              {
-                path.emplace_back(XmlTagName::k_ContentLength);
-              }
-              else if (std::strcmp(node.Name, "BlobType") == 0)
-              {
-                path.emplace_back(XmlTagName::k_BlobType);
-              }
-              else if (std::strcmp(node.Name, "AccessTier") == 0)
-              {
-                path.emplace_back(XmlTagName::k_AccessTier);
-              }
-              else if (std::strcmp(node.Name, "AccessTierInferred") == 0)
-              {
-                path.emplace_back(XmlTagName::k_AccessTierInferred);
-              }
-              else if (std::strcmp(node.Name, "LeaseStatus") == 0)
-              {
-                path.emplace_back(XmlTagName::k_LeaseStatus);
-              }
-              else if (std::strcmp(node.Name, "LeaseState") == 0)
-              {
-                path.emplace_back(XmlTagName::k_LeaseState);
-              }
-              else if (std::strcmp(node.Name, "LeaseDuration") == 0)
-              {
-                path.emplace_back(XmlTagName::k_LeaseDuration);
-              }
-              else if (std::strcmp(node.Name, "ServerEncrypted") == 0)
-              {
-                path.emplace_back(XmlTagName::k_ServerEncrypted);
-              }
-              else if (std::strcmp(node.Name, "EncryptionKeySHA256") == 0)
-              {
-                path.emplace_back(XmlTagName::k_EncryptionKeySHA256);
-              }
-              else if (std::strcmp(node.Name, "Sealed") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Sealed);
-              }
-              else if (std::strcmp(node.Name, "x-ms-blob-sequence-number") == 0)
-              {
-                path.emplace_back(XmlTagName::k_xmsblobsequencenumber);
-              }
-              else if (std::strcmp(node.Name, "Metadata") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Metadata);
-              }
-              else if (std::strcmp(node.Name, "OrMetadata") == 0)
-              {
-                path.emplace_back(XmlTagName::k_OrMetadata);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Name"):
+                  if (std::strcmp(node.Name, "Name") == 0)
+                  {
+                    tag = XmlTagName::k_Name;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Deleted"):
+                  if (std::strcmp(node.Name, "Deleted") == 0)
+                  {
+                    tag = XmlTagName::k_Deleted;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Snapshot"):
+                  if (std::strcmp(node.Name, "Snapshot") == 0)
+                  {
+                    tag = XmlTagName::k_Snapshot;
+                  }
+                  break;
+                case Storage::Details::StaticHash("VersionId"):
+                  if (std::strcmp(node.Name, "VersionId") == 0)
+                  {
+                    tag = XmlTagName::k_VersionId;
+                  }
+                  break;
+                case Storage::Details::StaticHash("IsCurrentVersion"):
+                  if (std::strcmp(node.Name, "IsCurrentVersion") == 0)
+                  {
+                    tag = XmlTagName::k_IsCurrentVersion;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Properties"):
+                  if (std::strcmp(node.Name, "Properties") == 0)
+                  {
+                    tag = XmlTagName::k_Properties;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Content-Type"):
+                  if (std::strcmp(node.Name, "Content-Type") == 0)
+                  {
+                    tag = XmlTagName::k_ContentType;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Content-Encoding"):
+                  if (std::strcmp(node.Name, "Content-Encoding") == 0)
+                  {
+                    tag = XmlTagName::k_ContentEncoding;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Content-Language"):
+                  if (std::strcmp(node.Name, "Content-Language") == 0)
+                  {
+                    tag = XmlTagName::k_ContentLanguage;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Content-MD5"):
+                  if (std::strcmp(node.Name, "Content-MD5") == 0)
+                  {
+                    tag = XmlTagName::k_ContentMD5;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Cache-Control"):
+                  if (std::strcmp(node.Name, "Cache-Control") == 0)
+                  {
+                    tag = XmlTagName::k_CacheControl;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Content-Disposition"):
+                  if (std::strcmp(node.Name, "Content-Disposition") == 0)
+                  {
+                    tag = XmlTagName::k_ContentDisposition;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Creation-Time"):
+                  if (std::strcmp(node.Name, "Creation-Time") == 0)
+                  {
+                    tag = XmlTagName::k_CreationTime;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Expiry-Time"):
+                  if (std::strcmp(node.Name, "Expiry-Time") == 0)
+                  {
+                    tag = XmlTagName::k_ExpiryTime;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LastAccessTime"):
+                  if (std::strcmp(node.Name, "LastAccessTime") == 0)
+                  {
+                    tag = XmlTagName::k_LastAccessTime;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Last-Modified"):
+                  if (std::strcmp(node.Name, "Last-Modified") == 0)
+                  {
+                    tag = XmlTagName::k_LastModified;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Etag"):
+                  if (std::strcmp(node.Name, "Etag") == 0)
+                  {
+                    tag = XmlTagName::k_Etag;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Content-Length"):
+                  if (std::strcmp(node.Name, "Content-Length") == 0)
+                  {
+                    tag = XmlTagName::k_ContentLength;
+                  }
+                  break;
+                case Storage::Details::StaticHash("BlobType"):
+                  if (std::strcmp(node.Name, "BlobType") == 0)
+                  {
+                    tag = XmlTagName::k_BlobType;
+                  }
+                  break;
+                case Storage::Details::StaticHash("AccessTier"):
+                  if (std::strcmp(node.Name, "AccessTier") == 0)
+                  {
+                    tag = XmlTagName::k_AccessTier;
+                  }
+                  break;
+                case Storage::Details::StaticHash("AccessTierInferred"):
+                  if (std::strcmp(node.Name, "AccessTierInferred") == 0)
+                  {
+                    tag = XmlTagName::k_AccessTierInferred;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LeaseStatus"):
+                  if (std::strcmp(node.Name, "LeaseStatus") == 0)
+                  {
+                    tag = XmlTagName::k_LeaseStatus;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LeaseState"):
+                  if (std::strcmp(node.Name, "LeaseState") == 0)
+                  {
+                    tag = XmlTagName::k_LeaseState;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LeaseDuration"):
+                  if (std::strcmp(node.Name, "LeaseDuration") == 0)
+                  {
+                    tag = XmlTagName::k_LeaseDuration;
+                  }
+                  break;
+                case Storage::Details::StaticHash("ServerEncrypted"):
+                  if (std::strcmp(node.Name, "ServerEncrypted") == 0)
+                  {
+                    tag = XmlTagName::k_ServerEncrypted;
+                  }
+                  break;
+                case Storage::Details::StaticHash("EncryptionKeySHA256"):
+                  if (std::strcmp(node.Name, "EncryptionKeySHA256") == 0)
+                  {
+                    tag = XmlTagName::k_EncryptionKeySHA256;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Sealed"):
+                  if (std::strcmp(node.Name, "Sealed") == 0)
+                  {
+                    tag = XmlTagName::k_Sealed;
+                  }
+                  break;
+                case Storage::Details::StaticHash("x-ms-blob-sequence-number"):
+                  if (std::strcmp(node.Name, "x-ms-blob-sequence-number") == 0)
+                  {
+                    tag = XmlTagName::k_xmsblobsequencenumber;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Metadata"):
+                  if (std::strcmp(node.Name, "Metadata") == 0)
+                  {
+                    tag = XmlTagName::k_Metadata;
+                  }
+                  break;
+                case Storage::Details::StaticHash("OrMetadata"):
+                  if (std::strcmp(node.Name, "OrMetadata") == 0)
+                  {
+                    tag = XmlTagName::k_OrMetadata;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 1 && path[0] == XmlTagName::k_Metadata)
               {
                 ret.Metadata = MetadataFromXml(reader);
@@ -5060,48 +5363,61 @@ namespace Azure { namespace Storage { namespace Blobs {
           while (true)
           {
             auto node = reader.Read();
-            if (node.Type == Storage::Details::XmlNodeType::End)
-            {
-              break;
-            }
-            else if (node.Type == Storage::Details::XmlNodeType::EndTag)
-            {
-              if (path.size() > 0)
-              {
-                path.pop_back();
-              }
-              else
-              {
-                break;
-              }
-            }
-            else if (node.Type == Storage::Details::XmlNodeType::StartTag)
-            {
-              if (std::strcmp(node.Name, "Id") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Id);
-              }
-              else if (std::strcmp(node.Name, "AccessPolicy") == 0)
-              {
-                path.emplace_back(XmlTagName::k_AccessPolicy);
-              }
-              else if (std::strcmp(node.Name, "Start") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Start);
-              }
-              else if (std::strcmp(node.Name, "Expiry") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Expiry);
-              }
-              else if (std::strcmp(node.Name, "Permission") == 0)
+            if (node.Type == Storage::Details::XmlNodeType::End)
+            {
+              break;
+            }
+            else if (node.Type == Storage::Details::XmlNodeType::EndTag)
+            {
+              if (path.size() > 0)
               {
-                path.emplace_back(XmlTagName::k_Permission);
+                path.pop_back();
               }
               else
               {
-                path.emplace_back(XmlTagName::k_Unknown);
+                break;
               }
             }
+            else if (node.Type == Storage::Details::XmlNodeType::StartTag)
+            {
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Id"):
+                  if (std::strcmp(node.Name, "Id") == 0)
+                  {
+                    tag = XmlTagName::k_Id;
+                  }
+                  break;
+                case Storage::Details::StaticHash("AccessPolicy"):
+                  if (std::strcmp(node.Name, "AccessPolicy") == 0)
+                  {
+                    tag = XmlTagName::k_AccessPolicy;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Start"):
+                  if (std::strcmp(node.Name, "Start") == 0)
+                  {
+                    tag = XmlTagName::k_Start;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Expiry"):
+                  if (std::strcmp(node.Name, "Expiry") == 0)
+                  {
+                    tag = XmlTagName::k_Expiry;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Permission"):
+                  if (std::strcmp(node.Name, "Permission") == 0)
+                  {
+                    tag = XmlTagName::k_Permission;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
+            }
             else if (node.Type == Storage::Details::XmlNodeType::Text)
             {
               if (path.size() == 1 && path[0] == XmlTagName::k_Id)
@@ -5269,6 +5585,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         {
           Azure::Core::Nullable<int32_t> Timeout;
           Azure::Core::Nullable<std::pair<int64_t, int64_t>> Range;
+          Azure::Core::Nullable<bool> RangeGetContentCrc64;
           Azure::Core::Nullable<std::string> EncryptionKey;
           Azure::Core::Nullable<std::string> EncryptionKeySha256;
           Azure::Core::Nullable<EncryptionAlgorithmType> EncryptionAlgorithm;
@@ -5309,6 +5626,12 @@ namespace Azure { namespace Storage { namespace Blobs {
               request.AddHeader("x-ms-range", "bytes=" + std::to_string(startOffset) + "-");
             }
           }
+          if (options.RangeGetContentCrc64.HasValue())
+          {
+            request.AddHeader(
+                "x-ms-range-get-content-crc64",
+                options.RangeGetContentCrc64.GetValue() ? "true" : "false");
+          }
           if (options.EncryptionKey.HasValue())
           {
             request.AddHeader("x-ms-encryption-key", options.EncryptionKey.GetValue());
@@ -5782,219 +6105,297 @@ namespace Azure { namespace Storage { namespace Blobs {
           {
             throw StorageException::CreateFromResponse(std::move(pHttpResponse));
           }
-          response.ETag = httpResponse.GetHeaders().at("etag");
-          response.LastModified = httpResponse.GetHeaders().at("last-modified");
-          response.CreationTime = httpResponse.GetHeaders().at("x-ms-creation-time");
-          auto response_expiry_time_iterator = httpResponse.GetHeaders().find("x-ms-expiry-time");
-          if (response_expiry_time_iterator != httpResponse.GetHeaders().end())
-          {
-            response.ExpiryTime = response_expiry_time_iterator->second;
-          }
-          auto response_last_access_time_iterator
-              = httpResponse.GetHeaders().find("x-ms-last-access-time");
-          if (response_last_access_time_iterator != httpResponse.GetHeaders().end())
-          {
-            response.LastAccessTime = response_last_access_time_iterator->second;
-          }
-          for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-meta-");
-               i != httpResponse.GetHeaders().end() && i->first.substr(0, 10) == "x-ms-meta-";
-               ++i)
-          {
-            response.Metadata.emplace(i->first.substr(10), i->second);
-          }
-          response.BlobType = BlobTypeFromString(httpResponse.GetHeaders().at("x-ms-blob-type"));
-          auto response_lease_status_iterator = httpResponse.GetHeaders().find("x-ms-lease-status");
-          if (response_lease_status_iterator != httpResponse.GetHeaders().end())
-          {
-            response.LeaseStatus
-                = BlobLeaseStatusFromString(response_lease_status_iterator->second);
-          }
-          auto response_lease_state_iterator = httpResponse.GetHeaders().find("x-ms-lease-state");
-          if (response_lease_state_iterator != httpResponse.GetHeaders().end())
-          {
-            response.LeaseState = BlobLeaseStateFromString(response_lease_state_iterator->second);
-          }
-          auto response_lease_duration_iterator
-              = httpResponse.GetHeaders().find("x-ms-lease-duration");
-          if (response_lease_duration_iterator != httpResponse.GetHeaders().end())
-          {
-            response.LeaseDuration = response_lease_duration_iterator->second;
-          }
-          response.ContentLength = std::stoll(httpResponse.GetHeaders().at("content-length"));
-          auto response_http_headers_content_type_iterator
-              = httpResponse.GetHeaders().find("content-type");
-          if (response_http_headers_content_type_iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentType = response_http_headers_content_type_iterator->second;
-          }
-          auto response_http_headers_content_encoding_iterator
-              = httpResponse.GetHeaders().find("content-encoding");
-          if (response_http_headers_content_encoding_iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentEncoding
-                = response_http_headers_content_encoding_iterator->second;
-          }
-          auto response_http_headers_content_language_iterator
-              = httpResponse.GetHeaders().find("content-language");
-          if (response_http_headers_content_language_iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentLanguage
-                = response_http_headers_content_language_iterator->second;
-          }
-          auto response_http_headers_cache_control_iterator
-              = httpResponse.GetHeaders().find("cache-control");
-          if (response_http_headers_cache_control_iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.CacheControl
-                = response_http_headers_cache_control_iterator->second;
-          }
-          auto response_http_headers_content_md5_iterator
-              = httpResponse.GetHeaders().find("content-md5");
-          if (response_http_headers_content_md5_iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentMd5 = response_http_headers_content_md5_iterator->second;
-          }
-          auto x_ms_blob_content_md5_iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-content-md5");
-          if (x_ms_blob_content_md5_iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentMd5 = x_ms_blob_content_md5_iterator->second;
-          }
-          auto response_http_headers_content_disposition_iterator
-              = httpResponse.GetHeaders().find("content-disposition");
-          if (response_http_headers_content_disposition_iterator != httpResponse.GetHeaders().end())
-          {
-            response.HttpHeaders.ContentDisposition
-                = response_http_headers_content_disposition_iterator->second;
-          }
-          auto response_sequence_number_iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-sequence-number");
-          if (response_sequence_number_iterator != httpResponse.GetHeaders().end())
-          {
-            response.SequenceNumber = std::stoll(response_sequence_number_iterator->second);
-          }
-          auto response_committed_block_count_iterator
-              = httpResponse.GetHeaders().find("x-ms-blob-committed-block-count");
-          if (response_committed_block_count_iterator != httpResponse.GetHeaders().end())
-          {
-            response.CommittedBlockCount
-                = std::stoi(response_committed_block_count_iterator->second);
-          }
-          auto response_is_sealed_iterator = httpResponse.GetHeaders().find("x-ms-blob-sealed");
-          if (response_is_sealed_iterator != httpResponse.GetHeaders().end())
-          {
-            response.IsSealed = response_is_sealed_iterator->second == "true";
-          }
-          auto response_server_encrypted_iterator
-              = httpResponse.GetHeaders().find("x-ms-server-encrypted");
-          if (response_server_encrypted_iterator != httpResponse.GetHeaders().end())
-          {
-            response.ServerEncrypted = response_server_encrypted_iterator->second == "true";
-          }
-          auto response_encryption_key_sha256_iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-key-sha256");
-          if (response_encryption_key_sha256_iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionKeySha256 = response_encryption_key_sha256_iterator->second;
-          }
-          auto response_encryption_scope_iterator
-              = httpResponse.GetHeaders().find("x-ms-encryption-scope");
-          if (response_encryption_scope_iterator != httpResponse.GetHeaders().end())
-          {
-            response.EncryptionScope = response_encryption_scope_iterator->second;
-          }
-          auto response_tier_iterator = httpResponse.GetHeaders().find("x-ms-access-tier");
-          if (response_tier_iterator != httpResponse.GetHeaders().end())
-          {
-            response.Tier = AccessTierFromString(response_tier_iterator->second);
-          }
-          auto response_access_tier_inferred_iterator
-              = httpResponse.GetHeaders().find("x-ms-access-tier-inferred");
-          if (response_access_tier_inferred_iterator != httpResponse.GetHeaders().end())
-          {
-            response.AccessTierInferred = response_access_tier_inferred_iterator->second == "true";
-          }
-          auto response_archive_status_iterator
-              = httpResponse.GetHeaders().find("x-ms-archive-status");
-          if (response_archive_status_iterator != httpResponse.GetHeaders().end())
-          {
-            response.ArchiveStatus
-                = BlobArchiveStatusFromString(response_archive_status_iterator->second);
-          }
-          auto response_access_tier_change_time_iterator
-              = httpResponse.GetHeaders().find("x-ms-access-tier-change-time");
-          if (response_access_tier_change_time_iterator != httpResponse.GetHeaders().end())
-          {
-            response.AccessTierChangeTime = response_access_tier_change_time_iterator->second;
-          }
-          auto response_copy_id_iterator = httpResponse.GetHeaders().find("x-ms-copy-id");
-          if (response_copy_id_iterator != httpResponse.GetHeaders().end())
-          {
-            response.CopyId = response_copy_id_iterator->second;
-          }
-          auto response_copy_source_iterator = httpResponse.GetHeaders().find("x-ms-copy-source");
-          if (response_copy_source_iterator != httpResponse.GetHeaders().end())
-          {
-            response.CopySource = response_copy_source_iterator->second;
-          }
-          auto response_copy_status_iterator = httpResponse.GetHeaders().find("x-ms-copy-status");
-          if (response_copy_status_iterator != httpResponse.GetHeaders().end())
-          {
-            response.CopyStatus = CopyStatusFromString(response_copy_status_iterator->second);
-          }
-          auto response_copy_progress_iterator
-              = httpResponse.GetHeaders().find("x-ms-copy-progress");
-          if (response_copy_progress_iterator != httpResponse.GetHeaders().end())
-          {
-            response.CopyProgress = response_copy_progress_iterator->second;
-          }
-          auto response_copy_completion_time_iterator
-              = httpResponse.GetHeaders().find("x-ms-copy-completion-time");
-          if (response_copy_completion_time_iterator != httpResponse.GetHeaders().end())
-          {
-            response.CopyCompletionTime = response_copy_completion_time_iterator->second;
-          }
-          auto response_object_replication_destination_policy_id_iterator
-              = httpResponse.GetHeaders().find("x-ms-or-policy-id");
-          if (response_object_replication_destination_policy_id_iterator
-              != httpResponse.GetHeaders().end())
-          {
-            response.ObjectReplicationDestinationPolicyId
-                = response_object_replication_destination_policy_id_iterator->second;
-          }
-          {
-            std::map<std::string, std::vector<ObjectReplicationRule>> orPropertiesMap;
-            for (auto i = httpResponse.GetHeaders().lower_bound("x-ms-or-");
-                 i != httpResponse.GetHeaders().end() && i->first.substr(0, 8) == "x-ms-or-";
-                 ++i)
+          // Every header is classified with one hash and at most one string comparison, instead of
+          // looking up each known header in the map. Required headers are counted so that a
+          // response missing one still fails.
+          constexpr int c_numRequiredHeaders = 5;
+          int numRequiredHeaders = 0;
+          std::map<std::string, std::vector<ObjectReplicationRule>> orPropertiesMap;
+          for (const auto& header : httpResponse.GetHeaders())
+          {
+            const std::string& name = header.first;
+            switch (Storage::Details::StaticHash(name.data(), name.length()))
+            {
+              case Storage::Details::StaticHash("etag"):
+                if (name == "etag")
+                {
+                  response.ETag = header.second;
+                  ++numRequiredHeaders;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("last-modified"):
+                if (name == "last-modified")
+                {
+                  response.LastModified = header.second;
+                  ++numRequiredHeaders;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-creation-time"):
+                if (name == "x-ms-creation-time")
+                {
+                  response.CreationTime = header.second;
+                  ++numRequiredHeaders;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-expiry-time"):
+                if (name == "x-ms-expiry-time")
+                {
+                  response.ExpiryTime = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-last-access-time"):
+                if (name == "x-ms-last-access-time")
+                {
+                  response.LastAccessTime = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-blob-type"):
+                if (name == "x-ms-blob-type")
+                {
+                  response.BlobType = BlobTypeFromString(header.second);
+                  ++numRequiredHeaders;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-lease-status"):
+                if (name == "x-ms-lease-status")
+                {
+                  response.LeaseStatus = BlobLeaseStatusFromString(header.second);
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-lease-state"):
+                if (name == "x-ms-lease-state")
+                {
+                  response.LeaseState = BlobLeaseStateFromString(header.second);
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-lease-duration"):
+                if (name == "x-ms-lease-duration")
+                {
+                  response.LeaseDuration = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("content-length"):
+                if (name == "content-length")
+                {
+                  response.ContentLength = std::stoll(header.second);
+                  ++numRequiredHeaders;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("content-type"):
+                if (name == "content-type")
+                {
+                  response.HttpHeaders.ContentType = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("content-encoding"):
+                if (name == "content-encoding")
+                {
+                  response.HttpHeaders.ContentEncoding = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("content-language"):
+                if (name == "content-language")
+                {
+                  response.HttpHeaders.ContentLanguage = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("cache-control"):
+                if (name == "cache-control")
+                {
+                  response.HttpHeaders.CacheControl = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("content-md5"):
+                if (name == "content-md5")
+                {
+                  // x-ms-blob-content-md5 takes precedence.
+                  if (response.HttpHeaders.ContentMd5.empty())
+                  {
+                    response.HttpHeaders.ContentMd5 = header.second;
+                  }
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-blob-content-md5"):
+                if (name == "x-ms-blob-content-md5")
+                {
+                  response.HttpHeaders.ContentMd5 = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("content-disposition"):
+                if (name == "content-disposition")
+                {
+                  response.HttpHeaders.ContentDisposition = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-blob-sequence-number"):
+                if (name == "x-ms-blob-sequence-number")
+                {
+                  response.SequenceNumber = std::stoll(header.second);
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-blob-committed-block-count"):
+                if (name == "x-ms-blob-committed-block-count")
+                {
+                  response.CommittedBlockCount = std::stoi(header.second);
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-blob-sealed"):
+                if (name == "x-ms-blob-sealed")
+                {
+                  response.IsSealed = header.second == "true";
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-server-encrypted"):
+                if (name == "x-ms-server-encrypted")
+                {
+                  response.ServerEncrypted = header.second == "true";
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-encryption-key-sha256"):
+                if (name == "x-ms-encryption-key-sha256")
+                {
+                  response.EncryptionKeySha256 = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-encryption-scope"):
+                if (name == "x-ms-encryption-scope")
+                {
+                  response.EncryptionScope = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-access-tier"):
+                if (name == "x-ms-access-tier")
+                {
+                  response.Tier = AccessTierFromString(header.second);
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-access-tier-inferred"):
+                if (name == "x-ms-access-tier-inferred")
+                {
+                  response.AccessTierInferred = header.second == "true";
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-archive-status"):
+                if (name == "x-ms-archive-status")
+                {
+                  response.ArchiveStatus = BlobArchiveStatusFromString(header.second);
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-access-tier-change-time"):
+                if (name == "x-ms-access-tier-change-time")
+                {
+                  response.AccessTierChangeTime = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-copy-id"):
+                if (name == "x-ms-copy-id")
+                {
+                  response.CopyId = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-copy-source"):
+                if (name == "x-ms-copy-source")
+                {
+                  response.CopySource = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-copy-status"):
+                if (name == "x-ms-copy-status")
+                {
+                  response.CopyStatus = CopyStatusFromString(header.second);
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-copy-progress"):
+                if (name == "x-ms-copy-progress")
+                {
+                  response.CopyProgress = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-copy-completion-time"):
+                if (name == "x-ms-copy-completion-time")
+                {
+                  response.CopyCompletionTime = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-or-policy-id"):
+                if (name == "x-ms-or-policy-id")
+                {
+                  response.ObjectReplicationDestinationPolicyId = header.second;
+                  continue;
+                }
+                break;
+              case Storage::Details::StaticHash("x-ms-tag-count"):
+                if (name == "x-ms-tag-count")
+                {
+                  response.TagCount = std::stoi(header.second);
+                  continue;
+                }
+                break;
+              default:
+                break;
+            }
+            if (name.compare(0, 10, "x-ms-meta-") == 0)
             {
-              const std::string& header = i->first;
-              auto underscorePos = header.find('_', 8);
+              response.Metadata.emplace(name.substr(10), header.second);
+            }
+            else if (name.compare(0, 8, "x-ms-or-") == 0)
+            {
+              auto underscorePos = name.find('_', 8);
               if (underscorePos == std::string::npos)
               {
                 continue;
               }
-              std::string policyId
-                  = std::string(header.begin() + 8, header.begin() + underscorePos);
-              std::string ruleId = header.substr(underscorePos + 1);
+              std::string policyId = std::string(name.begin() + 8, name.begin() + underscorePos);
+              std::string ruleId = name.substr(underscorePos + 1);
 
               ObjectReplicationRule rule;
               rule.RuleId = std::move(ruleId);
-              rule.ReplicationStatus = ObjectReplicationStatusFromString(i->second);
+              rule.ReplicationStatus = ObjectReplicationStatusFromString(header.second);
               orPropertiesMap[policyId].emplace_back(std::move(rule));
             }
-            for (auto& property : orPropertiesMap)
-            {
-              ObjectReplicationPolicy policy;
-              policy.PolicyId = property.first;
-              policy.Rules = std::move(property.second);
-              response.ObjectReplicationSourceProperties.emplace_back(std::move(policy));
-            }
           }
-          auto response_tag_count_iterator = httpResponse.GetHeaders().find("x-ms-tag-count");
-          if (response_tag_count_iterator != httpResponse.GetHeaders().end())
+          if (numRequiredHeaders != c_numRequiredHeaders)
           {
-            response.TagCount = std::stoi(response_tag_count_iterator->second);
+            throw std::out_of_range("missing required header in get blob properties response");
+          }
+          for (auto& property : orPropertiesMap)
+          {
+            ObjectReplicationPolicy policy;
+            policy.PolicyId = property.first;
+            policy.Rules = std::move(property.second);
+            response.ObjectReplicationSourceProperties.emplace_back(std::move(policy));
           }
           return Azure::Core::Response<GetBlobPropertiesResult>(
               std::move(response), std::move(pHttpResponse));
@@ -7609,15 +8010,11 @@ namespace Azure { namespace Storage { namespace Blobs {
             const CommitBlockListOptions& options)
         {
           unused(options);
-          std::string xml_body;
-          {
-            Storage::Details::XmlWriter writer;
-            CommitBlockListOptionsToXml(writer, options);
-            xml_body = writer.GetDocument();
-            writer.Write(Storage::Details::XmlNode{Storage::Details::XmlNodeType::End});
-          }
-          Azure::Core::Http::MemoryBodyStream xml_body_stream(
-              reinterpret_cast<const uint8_t*>(xml_body.data()), xml_body.length());
+          // A block list may hold 50,000 blocks, so it's serialized while it's being sent.
+          Storage::Details::XmlBodyStream xml_body_stream(
+              [&options](Storage::Details::XmlWriter& writer, std::size_t part) {
+                return CommitBlockListOptionsToXml(writer, options, part);
+              });
           auto request = Azure::Core::Http::Request(
               Azure::Core::Http::HttpMethod::Put, url, &xml_body_stream);
           request.AddHeader("Content-Length", std::to_string(xml_body_stream.Length()));
@@ -7844,26 +8241,37 @@ namespace Azure { namespace Storage { namespace Blobs {
             }
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
-              if (std::strcmp(node.Name, "BlockList") == 0)
-              {
-                path.emplace_back(XmlTagName::k_BlockList);
-              }
-              else if (std::strcmp(node.Name, "CommittedBlocks") == 0)
-              {
-                path.emplace_back(XmlTagName::k_CommittedBlocks);
-              }
-              else if (std::strcmp(node.Name, "Block") == 0)
-              {
-                path.emplace_back(XmlTagName::k_Block);
-              }
-              else if (std::strcmp(node.Name, "UncommittedBlocks") == 0)
-              {
-                path.emplace_back(XmlTagName::k_UncommittedBlocks);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::k_Unknown);
-              }
+              XmlTagName tag = XmlTagName::k_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("BlockList"):
+                  if (std::strcmp(node.Name, "BlockList") == 0)
+                  {
+                    tag = XmlTagName::k_BlockList;
+                  }
+                  break;
+                case Storage::Details::StaticHash("CommittedBlocks"):
+                  if (std::strcmp(node.Name, "CommittedBlocks") == 0)
+                  {
+                    tag = XmlTagName::k_CommittedBlocks;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Block"):
+                  if (std::strcmp(node.Name, "Block") == 0)
+                  {
+                    tag = XmlTagName::k_Block;
+                  }
+                  break;
+                case Storage::Details::StaticHash("UncommittedBlocks"):
+                  if (std::strcmp(node.Name, "UncommittedBlocks") == 0)
+                  {
+                    tag = XmlTagName::k_UncommittedBlocks;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 3 && path[0] == XmlTagName::k_BlockList
                   && path[1] == XmlTagName::k_CommittedBlocks && path[2] == XmlTagName::k_Block)
               {
@@ -7943,20 +8351,32 @@ namespace Azure { namespace Storage { namespace Blobs {
           return ret;
         }
 
-        static void CommitBlockListOptionsToXml(
+        static bool CommitBlockListOptionsToXml(
             Storage::Details::XmlWriter& writer,
-            const CommitBlockListOptions& options)
+            const CommitBlockListOptions& options,
+            std::size_t part)
         {
-          writer.Write(
-              Storage::Details::XmlNode{Storage::Details::XmlNodeType::StartTag, "BlockList"});
-          for (const auto& i : options.BlockList)
+          constexpr std::size_t c_blocksPerPart = 1024;
+          const std::size_t begin = std::min(part * c_blocksPerPart, options.BlockList.size());
+          const std::size_t end = std::min(begin + c_blocksPerPart, options.BlockList.size());
+          if (part == 0)
+          {
+            writer.Write(
+                Storage::Details::XmlNode{Storage::Details::XmlNodeType::StartTag, "BlockList"});
+          }
+          for (std::size_t i = begin; i < end; ++i)
           {
             writer.Write(Storage::Details::XmlNode{
                 Storage::Details::XmlNodeType::StartTag,
-                BlockTypeToString(i.first).data(),
-                i.second.data()});
+                BlockTypeToString(options.BlockList[i].first).data(),
+                options.BlockList[i].second.data()});
           }
-          writer.Write(Storage::Details::XmlNode{Storage::Details::XmlNodeType::EndTag});
+          if (end == options.BlockList.size())
+          {
+            writer.Write(Storage::Details::XmlNode{Storage::Details::XmlNodeType::EndTag});
+            return false;
+          }
+          return true;
         }
 
       }; // class BlockBlob
@@ -0,0 +1,260 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/blobs/append_blob_writer.hpp"
+
+#include "azure/storage/common/storage_exception.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Blobs {
+
+  namespace {
+    // The service accepts at most 4 MB per AppendBlock request.
+    constexpr int64_t c_maxAppendBlockSize = 4 * 1024 * 1024;
+  } // namespace
+
+  struct AppendBlobWriter::Block
+  {
+    std::vector<uint8_t> Data;
+    std::chrono::steady_clock::time_point FirstWrite;
+    bool FlushRequested = false;
+    std::promise<void> Promise;
+    std::shared_future<void> Future;
+  };
+
+  AppendBlobWriter::AppendBlobWriter(
+      AppendBlobClient client,
+      const AppendBlobWriterOptions& options)
+      : m_client(std::move(client)), m_options(options)
+  {
+    if (m_options.MaxBlockSize <= 0 || m_options.MaxBlockSize > c_maxAppendBlockSize)
+    {
+      throw std::runtime_error("append block size must be between 1 byte and 4 MB");
+    }
+    m_thread = std::thread(&AppendBlobWriter::AppendLoop, this);
+  }
+
+  AppendBlobWriter::~AppendBlobWriter()
+  {
+    try
+    {
+      Close();
+    }
+    catch (std::exception&)
+    {
+    }
+  }
+
+  void AppendBlobWriter::Write(const uint8_t* data, std::size_t size)
+  {
+    std::unique_lock<std::mutex> guard(m_mutex);
+    int64_t remaining = static_cast<int64_t>(size);
+    while (remaining > 0)
+    {
+      m_cv.wait(guard, [this]() {
+        return m_bufferedSize < m_options.MaxBufferedSize || m_error || m_closed;
+      });
+      if (m_error)
+      {
+        std::rethrow_exception(m_error);
+      }
+      if (m_closed)
+      {
+        throw std::runtime_error("append blob writer is closed");
+      }
+
+      // A write that fits into a block isn't split, a bigger one fills up the last block first.
+      const int64_t blockSize = m_blocks.empty()
+          ? 0
+          : static_cast<int64_t>(m_blocks.back()->Data.size());
+      if (m_blocks.empty() || blockSize == m_options.MaxBlockSize
+          || (remaining <= m_options.MaxBlockSize
+              && blockSize + remaining > m_options.MaxBlockSize))
+      {
+        auto block = std::make_shared<Block>();
+        block->FirstWrite = std::chrono::steady_clock::now();
+        block->Future = block->Promise.get_future().share();
+        m_blocks.push_back(std::move(block));
+      }
+      auto& block = *m_blocks.back();
+      const int64_t writeSize = std::min(
+          remaining, m_options.MaxBlockSize - static_cast<int64_t>(block.Data.size()));
+      block.Data.insert(block.Data.end(), data, data + writeSize);
+      data += writeSize;
+      remaining -= writeSize;
+      m_bufferedSize += writeSize;
+      // The append thread only needs to know about new and full blocks, the others wait for the
+      // flush interval anyway.
+      if ((m_blocks.size() == 1 && block.Data.size() == static_cast<std::size_t>(writeSize))
+          || static_cast<int64_t>(block.Data.size()) == m_options.MaxBlockSize)
+      {
+        m_cv.notify_all();
+      }
+    }
+  }
+
+  std::shared_future<void> AppendBlobWriter::Flush()
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (!m_blocks.empty())
+    {
+      m_blocks.back()->FlushRequested = true;
+      m_cv.notify_all();
+      return m_blocks.back()->Future;
+    }
+    if (m_appendingBlock)
+    {
+      return m_appendingBlock->Future;
+    }
+    std::promise<void> promise;
+    if (m_error)
+    {
+      promise.set_exception(m_error);
+    }
+    else
+    {
+      promise.set_value();
+    }
+    return promise.get_future().share();
+  }
+
+  void AppendBlobWriter::Close()
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      m_closed = true;
+      m_cv.notify_all();
+    }
+    if (m_thread.joinable())
+    {
+      m_thread.join();
+    }
+    if (m_error)
+    {
+      std::rethrow_exception(m_error);
+    }
+  }
+
+  void AppendBlobWriter::AppendLoop()
+  {
+    std::unique_lock<std::mutex> guard(m_mutex);
+    while (true)
+    {
+      if (m_blocks.empty())
+      {
+        if (m_closed)
+        {
+          return;
+        }
+        m_cv.wait(guard);
+        continue;
+      }
+
+      // Blocks before the last one don't get any more writes.
+      const auto& front = m_blocks.front();
+      if (!m_closed && !front->FlushRequested && m_blocks.size() == 1
+          && static_cast<int64_t>(front->Data.size()) < m_options.MaxBlockSize)
+      {
+        const auto deadline = front->FirstWrite + m_options.FlushInterval;
+        if (std::chrono::steady_clock::now() < deadline)
+        {
+          m_cv.wait_until(guard, deadline);
+          continue;
+        }
+      }
+
+      auto block = std::move(m_blocks.front());
+      m_blocks.pop_front();
+      m_appendingBlock = block;
+      std::exception_ptr error = m_error;
+      guard.unlock();
+      if (!error)
+      {
+        try
+        {
+          AppendBlock(*block);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+      }
+      guard.lock();
+
+      m_appendingBlock.reset();
+      m_bufferedSize -= static_cast<int64_t>(block->Data.size());
+      if (error)
+      {
+        // Nothing is appended after a failed block, the blocks still waiting fail as well.
+        m_error = error;
+        block->Promise.set_exception(error);
+      }
+      else
+      {
+        block->Promise.set_value();
+      }
+      m_cv.notify_all();
+    }
+  }
+
+  void AppendBlobWriter::AppendBlock(const Block& block)
+  {
+    if (m_appendPosition < 0)
+    {
+      GetBlobPropertiesOptions propertiesOptions;
+      propertiesOptions.Context = m_options.Context;
+      propertiesOptions.AccessConditions.LeaseId = m_options.AccessConditions.LeaseId;
+      m_appendPosition = m_client.GetProperties(propertiesOptions)->ContentLength;
+    }
+
+    AppendBlockOptions appendBlockOptions;
+    appendBlockOptions.Context = m_options.Context;
+    appendBlockOptions.AccessConditions = m_options.AccessConditions;
+    appendBlockOptions.AccessConditions.AppendPosition = m_appendPosition;
+    Azure::Core::Http::MemoryBodyStream blockStream(block.Data.data(), block.Data.size());
+    try
+    {
+      m_client.AppendBlock(&blockStream, appendBlockOptions);
+    }
+    catch (StorageException& e)
+    {
+      // When the response to an append that succeeded is lost, the retry fails the condition.
+      if (e.ErrorCode != "AppendPositionConditionNotMet" || !IsAppended(block))
+      {
+        throw;
+      }
+    }
+    m_appendPosition += static_cast<int64_t>(block.Data.size());
+  }
+
+  bool AppendBlobWriter::IsAppended(const Block& block) const
+  {
+    const int64_t blockSize = static_cast<int64_t>(block.Data.size());
+    GetBlobPropertiesOptions propertiesOptions;
+    propertiesOptions.Context = m_options.Context;
+    propertiesOptions.AccessConditions.LeaseId = m_options.AccessConditions.LeaseId;
+    auto properties = m_client.GetProperties(propertiesOptions);
+    if (properties->ContentLength != m_appendPosition + blockSize)
+    {
+      return false;
+    }
+
+    DownloadBlobOptions downloadOptions;
+    downloadOptions.Context = m_options.Context;
+    downloadOptions.Offset = m_appendPosition;
+    downloadOptions.Length = blockSize;
+    downloadOptions.AccessConditions.LeaseId = m_options.AccessConditions.LeaseId;
+    downloadOptions.AccessConditions.IfMatch = properties->ETag;
+    auto downloadResponse = m_client.Download(downloadOptions);
+    std::vector<uint8_t> content(block.Data.size());
+    return Azure::Core::Http::BodyStream::ReadToCount(
+               m_options.Context, *downloadResponse->BodyStream, content.data(), blockSize)
+        == blockSize
+        && content == block.Data;
+  }
+
+}}} // namespace Azure::Storage::Blobs
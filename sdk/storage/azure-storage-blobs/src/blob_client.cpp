@@ -11,14 +11,87 @@
 #include "azure/storage/blobs/version.hpp"
 #include "azure/storage/common/concurrent_transfer.hpp"
 #include "azure/storage/common/constants.hpp"
+#include "azure/storage/common/crypt.hpp"
 #include "azure/storage/common/file_io.hpp"
+#include "azure/storage/common/parallel_download_stream.hpp"
 #include "azure/storage/common/reliable_stream.hpp"
 #include "azure/storage/common/shared_key_policy.hpp"
+#include "azure/storage/common/storage_exception.hpp"
 #include "azure/storage/common/storage_common.hpp"
 #include "azure/storage/common/storage_per_retry_policy.hpp"
+#include "azure/storage/common/transfer_journal.hpp"
+#include "azure/storage/common/transfer_manager.hpp"
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace {
+    // The service only returns the CRC64 of ranges up to 4 MB.
+    constexpr int64_t c_maxRangeCrc64Size = 4 * 1024 * 1024;
+
+    Azure::Core::Response<Models::DownloadBlobResult> DownloadFirstChunk(
+        const BlobClient& client,
+        DownloadBlobOptions& options,
+        bool rangeIsImplicit)
+    {
+      try
+      {
+        return client.Download(options);
+      }
+      catch (StorageException& e)
+      {
+        // An empty blob can't satisfy a range request, download it as a whole instead.
+        if (!rangeIsImplicit
+            || e.StatusCode != Azure::Core::Http::HttpStatusCode::RangeNotSatisfiable)
+        {
+          throw;
+        }
+        options.Offset.Reset();
+        options.Length.Reset();
+        options.GetRangeContentCrc64.Reset();
+        return client.Download(options);
+      }
+    }
+
+    void BodyStreamToBuffer(
+        const Azure::Core::Context& context,
+        Azure::Core::Http::BodyStream& stream,
+        uint8_t* buffer,
+        int64_t length,
+        Crc64* crc64)
+    {
+      // Checksum the data in small slices while it's still in cache.
+      constexpr int64_t c_sliceSize = 256 * 1024;
+      while (length > 0)
+      {
+        int64_t readSize = crc64 ? std::min(c_sliceSize, length) : length;
+        int64_t bytesRead
+            = Azure::Core::Http::BodyStream::ReadToCount(context, stream, buffer, readSize);
+        if (bytesRead != readSize)
+        {
+          throw std::runtime_error("error when reading body stream");
+        }
+        if (crc64)
+        {
+          crc64->Update(buffer, static_cast<std::size_t>(bytesRead));
+        }
+        buffer += bytesRead;
+        length -= bytesRead;
+      }
+    }
+
+    // Smaller splits of a slow chunk cost more in requests than they save. Range CRC64s are
+    // verified per requested range, so downloads with transactional CRC64 aren't split.
+    constexpr int64_t c_minSplitLength = 1024 * 1024;
+
+    void VerifyRangeCrc64(const Crc64& crc64, const Azure::Core::Nullable<std::string>& expected)
+    {
+      if (!expected.HasValue() || Base64Encode(crc64.Digest()) != expected.GetValue())
+      {
+        throw std::runtime_error("crc64 mismatch in downloaded range");
+      }
+    }
+  } // namespace
+
   BlobClient BlobClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& containerName,
@@ -169,6 +242,7 @@ namespace Azure { namespace Storage { namespace Blobs {
           options.Offset.GetValue(),
           std::numeric_limits<std::remove_reference_t<decltype(options.Offset.GetValue())>>::max());
     }
+    protocolLayerOptions.RangeGetContentCrc64 = options.GetRangeContentCrc64;
     protocolLayerOptions.LeaseId = options.AccessConditions.LeaseId;
     protocolLayerOptions.IfModifiedSince = options.AccessConditions.IfModifiedSince;
     protocolLayerOptions.IfUnmodifiedSince = options.AccessConditions.IfUnmodifiedSince;
@@ -212,12 +286,102 @@ namespace Azure { namespace Storage { namespace Blobs {
 
       ReliableStreamOptions reliableStreamOptions;
       reliableStreamOptions.MaxRetryRequests = Storage::Details::c_reliableStreamRetryCount;
+      reliableStreamOptions.MinimumThroughput
+          = Storage::Details::c_reliableStreamMinimumThroughput;
+      reliableStreamOptions.ThroughputWindow
+          = std::chrono::seconds(Storage::Details::c_reliableStreamThroughputWindowSeconds);
+      reliableStreamOptions.MaximumIdleGap
+          = std::chrono::seconds(Storage::Details::c_reliableStreamMaximumIdleGapSeconds);
       downloadResponse->BodyStream = std::make_unique<ReliableStream>(
           std::move(downloadResponse->BodyStream), reliableStreamOptions, retryFunction);
     }
     return downloadResponse;
   }
 
+  Azure::Core::Response<Models::DownloadBlobResult> BlobClient::ParallelDownload(
+      const ParallelDownloadBlobOptions& options) const
+  {
+    constexpr int64_t c_defaultChunkSize = 4 * 1024 * 1024;
+
+    int64_t chunkSize = c_defaultChunkSize;
+    if (options.ChunkSize.HasValue())
+    {
+      chunkSize = options.ChunkSize.GetValue();
+    }
+
+    // The first chunk is downloaded right away to get the properties and size of the blob, the
+    // stream reads it directly while the following chunks are downloaded.
+    int64_t firstChunkOffset = options.Offset.HasValue() ? options.Offset.GetValue() : 0;
+    int64_t firstChunkLength = chunkSize;
+    if (options.Length.HasValue())
+    {
+      firstChunkLength = std::min(firstChunkLength, options.Length.GetValue());
+    }
+
+    DownloadBlobOptions firstChunkOptions;
+    firstChunkOptions.Context = options.Context;
+    firstChunkOptions.Offset = firstChunkOffset;
+    firstChunkOptions.Length = firstChunkLength;
+    firstChunkOptions.AccessConditions = options.AccessConditions;
+    auto firstChunk = DownloadFirstChunk(*this, firstChunkOptions, !options.Offset.HasValue());
+
+    int64_t blobSize;
+    int64_t blobRangeSize;
+    if (firstChunkOptions.Offset.HasValue())
+    {
+      blobSize = std::stoll(firstChunk->ContentRange.GetValue().substr(
+          firstChunk->ContentRange.GetValue().find('/') + 1));
+      blobRangeSize = blobSize - firstChunkOffset;
+      if (options.Length.HasValue())
+      {
+        blobRangeSize = std::min(blobRangeSize, options.Length.GetValue());
+      }
+    }
+    else
+    {
+      blobSize = firstChunk->BodyStream->Length();
+      blobRangeSize = blobSize;
+    }
+
+    auto rangeGetter = [client = *this,
+                        accessConditions = options.AccessConditions,
+                        eTag = firstChunk->ETag](
+                           const Azure::Core::Context& context, int64_t offset, int64_t length) {
+      DownloadBlobOptions chunkOptions;
+      chunkOptions.Context = context;
+      chunkOptions.Offset = offset;
+      chunkOptions.Length = length;
+      chunkOptions.AccessConditions = accessConditions;
+      chunkOptions.AccessConditions.IfMatch = eTag;
+      return std::move(client.Download(chunkOptions)->BodyStream);
+    };
+
+    ParallelDownloadStreamOptions streamOptions;
+    streamOptions.ChunkSize = chunkSize;
+    streamOptions.Concurrency = options.Concurrency;
+    firstChunk->BodyStream = std::make_unique<ParallelDownloadStream>(
+        std::move(firstChunk->BodyStream),
+        firstChunkOffset,
+        blobRangeSize,
+        rangeGetter,
+        options.Context,
+        streamOptions);
+
+    // The range and checksums in the response only described the first chunk.
+    if (options.Offset.HasValue() && blobRangeSize > 0)
+    {
+      firstChunk->ContentRange = "bytes " + std::to_string(firstChunkOffset) + "-"
+          + std::to_string(firstChunkOffset + blobRangeSize - 1) + "/" + std::to_string(blobSize);
+    }
+    else
+    {
+      firstChunk->ContentRange.Reset();
+    }
+    firstChunk->TransactionalContentMd5.Reset();
+    firstChunk->TransactionalContentCrc64.Reset();
+    return firstChunk;
+  }
+
   Azure::Core::Response<Models::DownloadBlobToResult> BlobClient::DownloadTo(
       uint8_t* buffer,
       std::size_t bufferSize,
@@ -238,16 +402,29 @@ namespace Azure { namespace Storage { namespace Blobs {
     {
       firstChunkLength = std::min(firstChunkLength, options.Length.GetValue());
     }
+    if (options.UseTransactionalCrc64)
+    {
+      firstChunkLength = std::min(firstChunkLength, c_maxRangeCrc64Size);
+    }
 
     DownloadBlobOptions firstChunkOptions;
-    firstChunkOptions.Context = options.Context;
+    firstChunkOptions.Context
+        = Storage::Details::BindTransferContext(options.TransferHandle, options.Context);
     firstChunkOptions.Offset = options.Offset;
     if (firstChunkOptions.Offset.HasValue())
     {
       firstChunkOptions.Length = firstChunkLength;
     }
+    if (options.UseTransactionalCrc64)
+    {
+      // Range CRC64 needs an explicit range.
+      firstChunkOptions.Offset = firstChunkOffset;
+      firstChunkOptions.Length = firstChunkLength;
+      firstChunkOptions.GetRangeContentCrc64 = true;
+    }
 
-    auto firstChunk = Download(firstChunkOptions);
+    Storage::Details::TransferSlot firstChunkSlot(options.TransferHandle, firstChunkLength);
+    auto firstChunk = DownloadFirstChunk(*this, firstChunkOptions, !options.Offset.HasValue());
 
     int64_t blobSize;
     int64_t blobRangeSize;
@@ -267,6 +444,10 @@ namespace Azure { namespace Storage { namespace Blobs {
       blobRangeSize = blobSize;
     }
     firstChunkLength = std::min(firstChunkLength, blobRangeSize);
+    if (options.TransferHandle)
+    {
+      options.TransferHandle->SetTotalBytes(blobRangeSize);
+    }
 
     if (static_cast<std::size_t>(blobRangeSize) > bufferSize)
     {
@@ -274,13 +455,19 @@ namespace Azure { namespace Storage { namespace Blobs {
           "buffer is not big enough, blob range size is " + std::to_string(blobRangeSize));
     }
 
-    int64_t bytesRead = Azure::Core::Http::BodyStream::ReadToCount(
-        firstChunkOptions.Context, *(firstChunk->BodyStream), buffer, firstChunkLength);
-    if (bytesRead != firstChunkLength)
+    Crc64 contentCrc64;
+    BodyStreamToBuffer(
+        firstChunkOptions.Context,
+        *(firstChunk->BodyStream),
+        buffer,
+        firstChunkLength,
+        options.UseTransactionalCrc64 ? &contentCrc64 : nullptr);
+    if (firstChunkOptions.GetRangeContentCrc64.HasValue())
     {
-      throw std::runtime_error("error when reading body stream");
+      VerifyRangeCrc64(contentCrc64, firstChunk->TransactionalContentCrc64);
     }
     firstChunk->BodyStream.reset();
+    firstChunkSlot.Complete(firstChunkLength);
 
     auto returnTypeConverter = [](Azure::Core::Response<Models::DownloadBlobResult>& response) {
       Models::DownloadBlobToResult ret;
@@ -298,32 +485,46 @@ namespace Azure { namespace Storage { namespace Blobs {
     auto ret = returnTypeConverter(firstChunk);
 
     // Keep downloading the remaining in parallel
-    auto downloadChunkFunc
-        = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-            DownloadBlobOptions chunkOptions;
-            chunkOptions.Context = options.Context;
-            chunkOptions.Offset = offset;
-            chunkOptions.Length = length;
-            if (!chunkOptions.AccessConditions.IfMatch.HasValue())
-            {
-              chunkOptions.AccessConditions.IfMatch = firstChunk->ETag;
-            }
-            auto chunk = Download(chunkOptions);
-            int64_t bytesRead = Azure::Core::Http::BodyStream::ReadToCount(
-                chunkOptions.Context,
-                *(chunk->BodyStream),
-                buffer + (offset - firstChunkOffset),
-                chunkOptions.Length.GetValue());
-            if (bytesRead != chunkOptions.Length.GetValue())
-            {
-              throw std::runtime_error("error when reading body stream");
-            }
-
-            if (chunkId == numChunks - 1)
-            {
-              ret = returnTypeConverter(chunk);
-            }
-          };
+    std::vector<Crc64> chunkCrc64s;
+    int64_t numChunks = 0;
+    auto downloadChunkFunc = [&](Storage::Details::ChunkRange& range) {
+      DownloadBlobOptions chunkOptions;
+      chunkOptions.Context = firstChunkOptions.Context;
+      chunkOptions.Offset = range.Offset();
+      chunkOptions.Length = range.End() - range.Offset();
+      if (!chunkOptions.AccessConditions.IfMatch.HasValue())
+      {
+        chunkOptions.AccessConditions.IfMatch = firstChunk->ETag;
+      }
+      Crc64* chunkCrc64 = nullptr;
+      if (options.UseTransactionalCrc64)
+      {
+        chunkOptions.GetRangeContentCrc64 = true;
+        chunkCrc64 = &chunkCrc64s[static_cast<std::size_t>(range.ChunkId())];
+      }
+      auto chunk = Download(chunkOptions);
+      // The end of the range may be split off while it's being read.
+      int64_t offset = range.Offset();
+      while (int64_t length = range.Claim(c_minSplitLength))
+      {
+        BodyStreamToBuffer(
+            chunkOptions.Context,
+            *(chunk->BodyStream),
+            buffer + (offset - firstChunkOffset),
+            length,
+            chunkCrc64);
+        offset += length;
+      }
+      if (chunkCrc64)
+      {
+        VerifyRangeCrc64(*chunkCrc64, chunk->TransactionalContentCrc64);
+      }
+
+      if (!range.IsSplitOff() && range.ChunkId() == numChunks - 1)
+      {
+        ret = returnTypeConverter(chunk);
+      }
+    };
 
     int64_t remainingOffset = firstChunkOffset + firstChunkLength;
     int64_t remainingSize = blobRangeSize - firstChunkLength;
@@ -339,10 +540,30 @@ namespace Azure { namespace Storage { namespace Blobs {
       chunkSize = (std::max(chunkSize, int64_t(1)) + c_grainSize - 1) / c_grainSize * c_grainSize;
       chunkSize = std::min(chunkSize, c_defaultChunkSize);
     }
+    if (options.UseTransactionalCrc64)
+    {
+      chunkSize = std::min(chunkSize, c_maxRangeCrc64Size);
+      chunkCrc64s.resize(static_cast<std::size_t>((remainingSize + chunkSize - 1) / chunkSize));
+    }
+    numChunks = (remainingSize + chunkSize - 1) / chunkSize;
 
     Storage::Details::ConcurrentTransfer(
-        remainingOffset, remainingSize, chunkSize, options.Concurrency, downloadChunkFunc);
+        remainingOffset,
+        remainingSize,
+        chunkSize,
+        options.Concurrency,
+        downloadChunkFunc,
+        options.UseTransactionalCrc64 ? 0 : c_minSplitLength,
+        options.TransferHandle);
     ret->ContentLength = blobRangeSize;
+    if (options.UseTransactionalCrc64)
+    {
+      for (const auto& chunkCrc64 : chunkCrc64s)
+      {
+        contentCrc64.Concatenate(chunkCrc64);
+      }
+      ret->TransactionalContentCrc64 = Base64Encode(contentCrc64.Digest());
+    }
     return ret;
   }
 
@@ -365,18 +586,33 @@ namespace Azure { namespace Storage { namespace Blobs {
     {
       firstChunkLength = std::min(firstChunkLength, options.Length.GetValue());
     }
+    if (options.UseTransactionalCrc64)
+    {
+      firstChunkLength = std::min(firstChunkLength, c_maxRangeCrc64Size);
+    }
 
     DownloadBlobOptions firstChunkOptions;
-    firstChunkOptions.Context = options.Context;
+    firstChunkOptions.Context
+        = Storage::Details::BindTransferContext(options.TransferHandle, options.Context);
     firstChunkOptions.Offset = options.Offset;
     if (firstChunkOptions.Offset.HasValue())
     {
       firstChunkOptions.Length = firstChunkLength;
     }
+    if (options.UseTransactionalCrc64)
+    {
+      // Range CRC64 needs an explicit range.
+      firstChunkOptions.Offset = firstChunkOffset;
+      firstChunkOptions.Length = firstChunkLength;
+      firstChunkOptions.GetRangeContentCrc64 = true;
+    }
 
-    Storage::Details::FileWriter fileWriter(fileName);
+    // A download that may be resumed keeps what's in the file until it's known whether the
+    // checkpoint file matches.
+    Storage::Details::FileWriter fileWriter(fileName, options.CheckpointFileName.empty());
 
-    auto firstChunk = Download(firstChunkOptions);
+    Storage::Details::TransferSlot firstChunkSlot(options.TransferHandle, firstChunkLength);
+    auto firstChunk = DownloadFirstChunk(*this, firstChunkOptions, !options.Offset.HasValue());
 
     int64_t blobSize;
     int64_t blobRangeSize;
@@ -396,32 +632,163 @@ namespace Azure { namespace Storage { namespace Blobs {
       blobRangeSize = blobSize;
     }
     firstChunkLength = std::min(firstChunkLength, blobRangeSize);
+    if (options.TransferHandle)
+    {
+      options.TransferHandle->SetTotalBytes(blobRangeSize);
+    }
 
-    auto bodyStreamToFile = [](Azure::Core::Http::BodyStream& stream,
+    int64_t remainingOffset = firstChunkOffset + firstChunkLength;
+    int64_t remainingSize = blobRangeSize - firstChunkLength;
+    int64_t chunkSize;
+    if (options.ChunkSize.HasValue())
+    {
+      chunkSize = options.ChunkSize.GetValue();
+    }
+    else
+    {
+      int64_t c_grainSize = 4 * 1024;
+      chunkSize = remainingSize / options.Concurrency;
+      chunkSize = (std::max(chunkSize, int64_t(1)) + c_grainSize - 1) / c_grainSize * c_grainSize;
+      chunkSize = std::min(chunkSize, c_defaultChunkSize);
+    }
+    if (options.UseTransactionalCrc64)
+    {
+      chunkSize = std::min(chunkSize, c_maxRangeCrc64Size);
+    }
+    const int64_t numChunks = (remainingSize + chunkSize - 1) / chunkSize;
+
+    // The checkpoint file records the chunks after the first one, which is downloaded again
+    // anyway to learn the ETag and size of the blob.
+    std::unique_ptr<Storage::Details::TransferJournal> journal;
+    if (!options.CheckpointFileName.empty())
+    {
+      auto openJournal = [&]() {
+        return std::make_unique<Storage::Details::TransferJournal>(
+            options.CheckpointFileName,
+            firstChunk->ETag + " " + std::to_string(firstChunkOffset) + " "
+                + std::to_string(firstChunkLength),
+            remainingSize,
+            chunkSize);
+      };
+      journal = openJournal();
+      if (journal->IsResumed())
+      {
+        // The recorded chunks are only trusted if the file still reaches past the last of them,
+        // it may have been deleted or truncated since.
+        int64_t recordedSize = 0;
+        for (int64_t i = 0; i < numChunks; ++i)
+        {
+          if (journal->IsChunkDone(i))
+          {
+            recordedSize = std::min(firstChunkLength + chunkSize * (i + 1), blobRangeSize);
+          }
+        }
+        const int64_t fileSize = fileWriter.GetFileSize();
+        if (fileSize < recordedSize || fileSize > blobRangeSize)
+        {
+          journal->Remove();
+          journal = openJournal();
+        }
+      }
+      if (!journal->IsResumed())
+      {
+        fileWriter.Truncate(0);
+      }
+    }
+
+    fileWriter.Preallocate(blobRangeSize);
+    std::unique_ptr<Storage::Details::MemoryMappedFile> mappedFile;
+    if (options.UseMemoryMappedFile)
+    {
+      try
+      {
+        mappedFile
+            = std::make_unique<Storage::Details::MemoryMappedFile>(fileWriter, blobRangeSize);
+      }
+      catch (std::runtime_error&)
+      {
+        // Not every file can be mapped, those are written through the file writer.
+      }
+    }
+
+    // When range is set, the data is claimed from it part by part instead of reading length bytes,
+    // as the end of the range may be split off while it's being read.
+    auto bodyStreamToFile = [&journal](Azure::Core::Http::BodyStream& stream,
                                Storage::Details::FileWriter& fileWriter,
+                               Storage::Details::MemoryMappedFile* mappedFile,
                                int64_t offset,
                                int64_t length,
+                               Storage::Details::ChunkRange* range,
+                               Crc64* crc64,
                                Azure::Core::Context& context) {
-      constexpr std::size_t bufferSize = 4 * 1024 * 1024;
-      std::vector<uint8_t> buffer(bufferSize);
-      while (length > 0)
+      constexpr int64_t bufferSize = 4 * 1024 * 1024;
+      const int64_t partSize = range ? c_minSplitLength : bufferSize;
+      while (true)
       {
-        int64_t readSize = std::min(static_cast<int64_t>(bufferSize), length);
+        int64_t readSize = range ? range->Claim(partSize) : std::min(partSize, length);
+        if (readSize == 0)
+        {
+          break;
+        }
+        if (mappedFile)
+        {
+          uint8_t* destination = mappedFile->Data() + offset;
+          int64_t bytesRead
+              = Azure::Core::Http::BodyStream::ReadToCount(context, stream, destination, readSize);
+          if (bytesRead != readSize)
+          {
+            throw std::runtime_error("error when reading body stream");
+          }
+          if (crc64)
+          {
+            crc64->Update(destination, static_cast<std::size_t>(readSize));
+          }
+          length -= readSize;
+          offset += readSize;
+          continue;
+        }
+        auto buffer = fileWriter.AcquireBuffer(static_cast<std::size_t>(readSize));
         int64_t bytesRead
-            = Azure::Core::Http::BodyStream::ReadToCount(context, stream, buffer.data(), readSize);
+            = Azure::Core::Http::BodyStream::ReadToCount(context, stream, buffer.Data(), readSize);
         if (bytesRead != readSize)
         {
           throw std::runtime_error("error when reading body stream");
         }
-        fileWriter.Write(buffer.data(), bytesRead, offset);
+        if (crc64)
+        {
+          crc64->Update(buffer.Data(), static_cast<std::size_t>(bytesRead));
+        }
+        if (journal)
+        {
+          // A chunk recorded in the checkpoint file must already be in the file.
+          fileWriter.Write(buffer.Data(), bytesRead, offset);
+        }
+        else
+        {
+          // The buffer is written in the background while the next one is received.
+          fileWriter.WriteAsync(std::move(buffer), offset);
+        }
         length -= bytesRead;
         offset += bytesRead;
       }
     };
 
+    Crc64 contentCrc64;
     bodyStreamToFile(
-        *(firstChunk->BodyStream), fileWriter, 0, firstChunkLength, firstChunkOptions.Context);
+        *(firstChunk->BodyStream),
+        fileWriter,
+        mappedFile.get(),
+        0,
+        firstChunkLength,
+        nullptr,
+        options.UseTransactionalCrc64 ? &contentCrc64 : nullptr,
+        firstChunkOptions.Context);
+    if (firstChunkOptions.GetRangeContentCrc64.HasValue())
+    {
+      VerifyRangeCrc64(contentCrc64, firstChunk->TransactionalContentCrc64);
+    }
     firstChunk->BodyStream.reset();
+    firstChunkSlot.Complete(firstChunkLength);
 
     auto returnTypeConverter = [](Azure::Core::Response<Models::DownloadBlobResult>& response) {
       Models::DownloadBlobToResult ret;
@@ -439,48 +806,102 @@ namespace Azure { namespace Storage { namespace Blobs {
     auto ret = returnTypeConverter(firstChunk);
 
     // Keep downloading the remaining in parallel
-    auto downloadChunkFunc
-        = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-            DownloadBlobOptions chunkOptions;
-            chunkOptions.Context = options.Context;
-            chunkOptions.Offset = offset;
-            chunkOptions.Length = length;
-            if (!chunkOptions.AccessConditions.IfMatch.HasValue())
-            {
-              chunkOptions.AccessConditions.IfMatch = firstChunk->ETag;
-            }
-            auto chunk = Download(chunkOptions);
-            bodyStreamToFile(
-                *(chunk->BodyStream),
-                fileWriter,
-                offset - firstChunkOffset,
-                chunkOptions.Length.GetValue(),
-                chunkOptions.Context);
-
-            if (chunkId == numChunks - 1)
-            {
-              ret = returnTypeConverter(chunk);
-            }
-          };
-
-    int64_t remainingOffset = firstChunkOffset + firstChunkLength;
-    int64_t remainingSize = blobRangeSize - firstChunkLength;
-    int64_t chunkSize;
-    if (options.ChunkSize.HasValue())
-    {
-      chunkSize = options.ChunkSize.GetValue();
-    }
-    else
+    std::vector<Crc64> chunkCrc64s;
+    if (options.UseTransactionalCrc64)
     {
-      int64_t c_grainSize = 4 * 1024;
-      chunkSize = remainingSize / options.Concurrency;
-      chunkSize = (std::max(chunkSize, int64_t(1)) + c_grainSize - 1) / c_grainSize * c_grainSize;
-      chunkSize = std::min(chunkSize, c_defaultChunkSize);
+      chunkCrc64s.resize(static_cast<std::size_t>(numChunks));
     }
+    auto downloadChunkFunc = [&](Storage::Details::ChunkRange& range) {
+      if (journal && journal->IsChunkDone(range.ChunkId()))
+      {
+        // Downloaded before the transfer was interrupted.
+        range.Claim(std::numeric_limits<int64_t>::max());
+        return;
+      }
+      DownloadBlobOptions chunkOptions;
+      chunkOptions.Context = firstChunkOptions.Context;
+      chunkOptions.Offset = range.Offset();
+      chunkOptions.Length = range.End() - range.Offset();
+      if (!chunkOptions.AccessConditions.IfMatch.HasValue())
+      {
+        chunkOptions.AccessConditions.IfMatch = firstChunk->ETag;
+      }
+      Crc64* chunkCrc64 = nullptr;
+      if (options.UseTransactionalCrc64)
+      {
+        chunkOptions.GetRangeContentCrc64 = true;
+        chunkCrc64 = &chunkCrc64s[static_cast<std::size_t>(range.ChunkId())];
+      }
+      auto chunk = Download(chunkOptions);
+      bodyStreamToFile(
+          *(chunk->BodyStream),
+          fileWriter,
+          mappedFile.get(),
+          range.Offset() - firstChunkOffset,
+          0,
+          &range,
+          chunkCrc64,
+          chunkOptions.Context);
+      if (chunkCrc64)
+      {
+        VerifyRangeCrc64(*chunkCrc64, chunk->TransactionalContentCrc64);
+      }
+      if (journal)
+      {
+        journal->SetChunkDone(range.ChunkId());
+      }
+
+      if (!range.IsSplitOff() && range.ChunkId() == numChunks - 1)
+      {
+        ret = returnTypeConverter(chunk);
+      }
+    };
 
+    // The checkpoint file records whole chunks, so they aren't split.
     Storage::Details::ConcurrentTransfer(
-        remainingOffset, remainingSize, chunkSize, options.Concurrency, downloadChunkFunc);
+        remainingOffset,
+        remainingSize,
+        chunkSize,
+        options.Concurrency,
+        downloadChunkFunc,
+        options.UseTransactionalCrc64 || journal ? 0 : c_minSplitLength,
+        options.TransferHandle);
+    fileWriter.Flush();
     ret->ContentLength = blobRangeSize;
+    if (options.UseTransactionalCrc64)
+    {
+      if (journal && journal->IsResumed())
+      {
+        // The chunks downloaded before the transfer was interrupted are checksummed from the file.
+        Storage::Details::FileReader fileReader(fileName);
+        for (int64_t i = 0; i < numChunks; ++i)
+        {
+          if (journal->IsChunkDone(i))
+          {
+            const int64_t offset = firstChunkLength + chunkSize * i;
+            const int64_t length = std::min(chunkSize, remainingSize - chunkSize * i);
+            auto buffer = Storage::Details::BufferPool::GetTransferBufferPool().Acquire(
+                static_cast<std::size_t>(length));
+            Azure::Core::Http::FileBodyStream chunkStream(fileReader.GetHandle(), offset, length);
+            BodyStreamToBuffer(
+                firstChunkOptions.Context,
+                chunkStream,
+                buffer.Data(),
+                length,
+                &chunkCrc64s[static_cast<std::size_t>(i)]);
+          }
+        }
+      }
+      for (const auto& chunkCrc64 : chunkCrc64s)
+      {
+        contentCrc64.Concatenate(chunkCrc64);
+      }
+      ret->TransactionalContentCrc64 = Base64Encode(contentCrc64.Digest());
+    }
+    if (journal)
+    {
+      journal->Remove();
+    }
     return ret;
   }
 
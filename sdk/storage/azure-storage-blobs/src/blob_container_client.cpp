@@ -241,6 +241,74 @@ namespace Azure { namespace Storage { namespace Blobs {
     return response;
   }
 
+  Azure::Core::Response<Models::ListBlobsFlatSegmentResult>
+  BlobContainerClient::ListBlobsFlatSegment(
+      const std::function<void(Models::BlobItem)>& onItem,
+      const ListBlobsSegmentOptions& options) const
+  {
+    Details::BlobRestClient::Container::ListBlobsFlatSegmentOptions protocolLayerOptions;
+    protocolLayerOptions.Prefix = options.Prefix;
+    protocolLayerOptions.ContinuationToken = options.ContinuationToken;
+    protocolLayerOptions.MaxResults = options.MaxResults;
+    protocolLayerOptions.Include = options.Include;
+    if (onItem)
+    {
+      protocolLayerOptions.OnItem = [&onItem](Models::BlobItem item) {
+        if (item.VersionId.HasValue() && !item.IsCurrentVersion.HasValue())
+        {
+          item.IsCurrentVersion = false;
+        }
+        onItem(std::move(item));
+      };
+    }
+    auto response = Details::BlobRestClient::Container::ListBlobsFlat(
+        options.Context, *m_pipeline, m_containerUrl, protocolLayerOptions);
+    for (auto& i : response->Items)
+    {
+      if (i.VersionId.HasValue() && !i.IsCurrentVersion.HasValue())
+      {
+        i.IsCurrentVersion = false;
+      }
+    }
+    return response;
+  }
+
+  Azure::Core::Response<Models::ListBlobsByHierarchySegmentResult>
+  BlobContainerClient::ListBlobsByHierarchySegment(
+      const std::string& delimiter,
+      const std::function<void(Models::BlobItem)>& onItem,
+      const std::function<void(Models::BlobPrefix)>& onBlobPrefix,
+      const ListBlobsSegmentOptions& options) const
+  {
+    Details::BlobRestClient::Container::ListBlobsByHierarchySegmentOptions protocolLayerOptions;
+    protocolLayerOptions.Prefix = options.Prefix;
+    protocolLayerOptions.Delimiter = delimiter;
+    protocolLayerOptions.ContinuationToken = options.ContinuationToken;
+    protocolLayerOptions.MaxResults = options.MaxResults;
+    protocolLayerOptions.Include = options.Include;
+    if (onItem)
+    {
+      protocolLayerOptions.OnItem = [&onItem](Models::BlobItem item) {
+        if (item.VersionId.HasValue() && !item.IsCurrentVersion.HasValue())
+        {
+          item.IsCurrentVersion = false;
+        }
+        onItem(std::move(item));
+      };
+    }
+    protocolLayerOptions.OnBlobPrefix = onBlobPrefix;
+    auto response = Details::BlobRestClient::Container::ListBlobsByHierarchy(
+        options.Context, *m_pipeline, m_containerUrl, protocolLayerOptions);
+    for (auto& i : response->Items)
+    {
+      if (i.VersionId.HasValue() && !i.IsCurrentVersion.HasValue())
+      {
+        i.IsCurrentVersion = false;
+      }
+    }
+    return response;
+  }
+
   Azure::Core::Response<Models::GetContainerAccessPolicyResult>
   BlobContainerClient::GetAccessPolicy(const GetContainerAccessPolicyOptions& options) const
   {
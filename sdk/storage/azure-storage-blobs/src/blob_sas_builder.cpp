@@ -135,8 +135,7 @@ namespace Azure { namespace Storage { namespace Blobs {
         + CacheControl + "\n" + ContentDisposition + "\n" + ContentEncoding + "\n" + ContentLanguage
         + "\n" + ContentType;
 
-    std::string signature = Base64Encode(
-        Storage::Details::HmacSha256(stringToSign, Base64Decode(credential.GetAccountKey())));
+    std::string signature = Base64Encode(credential.GetSigningContext()->Sign(stringToSign));
 
     Azure::Core::Http::Url builder;
     builder.AppendQueryParameter(
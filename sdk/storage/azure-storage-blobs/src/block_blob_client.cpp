@@ -3,14 +3,75 @@
 
 #include "azure/storage/blobs/block_blob_client.hpp"
 
+#include "azure/storage/common/buffer_pool.hpp"
 #include "azure/storage/common/concurrent_transfer.hpp"
 #include "azure/storage/common/constants.hpp"
+#include "azure/storage/common/content_defined_chunker.hpp"
 #include "azure/storage/common/crypt.hpp"
 #include "azure/storage/common/file_io.hpp"
 #include "azure/storage/common/storage_common.hpp"
+#include "azure/storage/common/storage_exception.hpp"
+#include "azure/storage/common/transfer_journal.hpp"
+#include "azure/storage/common/transfer_manager.hpp"
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <map>
+#include <mutex>
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace {
+    // Counts the buffers UploadFrom(BodyStream&) has read, or is reading, and hasn't staged yet.
+    class StagingBuffers {
+    public:
+      explicit StagingBuffers(int maxBuffers) : m_maxBuffers(std::max(maxBuffers, 1)) {}
+
+      // Waits for a buffer to become free, returns false if staging a block failed meanwhile.
+      bool Acquire()
+      {
+        std::unique_lock<std::mutex> guard(m_mutex);
+        m_cv.wait(guard, [this]() { return m_numBuffers < m_maxBuffers || m_firstException; });
+        if (m_firstException)
+        {
+          return false;
+        }
+        ++m_numBuffers;
+        return true;
+      }
+
+      void Release(std::exception_ptr exception = nullptr)
+      {
+        std::lock_guard<std::mutex> guard(m_mutex);
+        if (exception && !m_firstException)
+        {
+          m_firstException = exception;
+        }
+        --m_numBuffers;
+        m_cv.notify_all();
+      }
+
+      // Waits until every buffer is released and rethrows the first failure.
+      void WaitForAll()
+      {
+        std::unique_lock<std::mutex> guard(m_mutex);
+        m_cv.wait(guard, [this]() { return m_numBuffers == 0; });
+        if (m_firstException)
+        {
+          std::rethrow_exception(m_firstException);
+        }
+      }
+
+    private:
+      const int m_maxBuffers;
+      std::mutex m_mutex;
+      std::condition_variable m_cv;
+      int m_numBuffers = 0;
+      std::exception_ptr m_firstException;
+    };
+  } // namespace
+
   BlockBlobClient BlockBlobClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& containerName,
@@ -125,18 +186,40 @@ namespace Azure { namespace Storage { namespace Blobs {
       chunkSize = (chunkSize + c_grainSize - 1) / c_grainSize * c_grainSize;
     }
 
+    auto context = Storage::Details::BindTransferContext(options.TransferHandle, options.Context);
+    if (options.TransferHandle)
+    {
+      options.TransferHandle->SetTotalBytes(static_cast<int64_t>(bufferSize));
+    }
+
     if (bufferSize <= static_cast<std::size_t>(chunkSize))
     {
       Azure::Core::Http::MemoryBodyStream contentStream(buffer, bufferSize);
       UploadBlockBlobOptions uploadBlockBlobOptions;
-      uploadBlockBlobOptions.Context = options.Context;
+      uploadBlockBlobOptions.Context = context;
       uploadBlockBlobOptions.HttpHeaders = options.HttpHeaders;
       uploadBlockBlobOptions.Metadata = options.Metadata;
       uploadBlockBlobOptions.Tier = options.Tier;
-      return Upload(&contentStream, uploadBlockBlobOptions);
+      if (options.UseTransactionalCrc64)
+      {
+        uploadBlockBlobOptions.TransactionalContentCrc64
+            = Base64Encode(Crc64::Hash(buffer, bufferSize));
+      }
+      Storage::Details::TransferSlot slot(
+          options.TransferHandle, static_cast<int64_t>(bufferSize));
+      auto response = Upload(&contentStream, uploadBlockBlobOptions);
+      slot.Complete(static_cast<int64_t>(bufferSize));
+      response->TransactionalContentCrc64 = uploadBlockBlobOptions.TransactionalContentCrc64;
+      return response;
     }
 
     std::vector<std::pair<Models::BlockType, std::string>> blockIds;
+    std::vector<Crc64> blockCrc64s;
+    if (options.UseTransactionalCrc64)
+    {
+      blockCrc64s.resize(
+          static_cast<std::size_t>((static_cast<int64_t>(bufferSize) + chunkSize - 1) / chunkSize));
+    }
     auto getBlockId = [](int64_t id) {
       constexpr std::size_t c_blockIdLength = 64;
       std::string blockId = std::to_string(id);
@@ -147,7 +230,13 @@ namespace Azure { namespace Storage { namespace Blobs {
     auto uploadBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
       Azure::Core::Http::MemoryBodyStream contentStream(buffer + offset, length);
       StageBlockOptions chunkOptions;
-      chunkOptions.Context = options.Context;
+      chunkOptions.Context = context;
+      if (options.UseTransactionalCrc64)
+      {
+        auto& blockCrc64 = blockCrc64s[static_cast<std::size_t>(chunkId)];
+        blockCrc64.Update(buffer + offset, static_cast<std::size_t>(length));
+        chunkOptions.TransactionalContentCrc64 = Base64Encode(blockCrc64.Digest());
+      }
       auto blockInfo = StageBlock(getBlockId(chunkId), &contentStream, chunkOptions);
       if (chunkId == numChunks - 1)
       {
@@ -156,7 +245,7 @@ namespace Azure { namespace Storage { namespace Blobs {
     };
 
     Storage::Details::ConcurrentTransfer(
-        0, bufferSize, chunkSize, options.Concurrency, uploadBlockFunc);
+        0, bufferSize, chunkSize, options.Concurrency, uploadBlockFunc, options.TransferHandle);
 
     for (std::size_t i = 0; i < blockIds.size(); ++i)
     {
@@ -164,7 +253,7 @@ namespace Azure { namespace Storage { namespace Blobs {
       blockIds[i].second = getBlockId(static_cast<int64_t>(i));
     }
     CommitBlockListOptions commitBlockListOptions;
-    commitBlockListOptions.Context = options.Context;
+    commitBlockListOptions.Context = context;
     commitBlockListOptions.HttpHeaders = options.HttpHeaders;
     commitBlockListOptions.Metadata = options.Metadata;
     commitBlockListOptions.Tier = options.Tier;
@@ -177,6 +266,15 @@ namespace Azure { namespace Storage { namespace Blobs {
     ret.ServerEncrypted = commitBlockListResponse->ServerEncrypted;
     ret.EncryptionKeySha256 = std::move(commitBlockListResponse->EncryptionKeySha256);
     ret.EncryptionScope = std::move(commitBlockListResponse->EncryptionScope);
+    if (options.UseTransactionalCrc64)
+    {
+      Crc64 contentCrc64;
+      for (const auto& blockCrc64 : blockCrc64s)
+      {
+        contentCrc64.Concatenate(blockCrc64);
+      }
+      ret.TransactionalContentCrc64 = Base64Encode(contentCrc64.Digest());
+    }
     return Azure::Core::Response<Models::UploadBlockBlobFromResult>(
         std::move(ret),
         std::make_unique<Azure::Core::Http::RawResponse>(
@@ -206,19 +304,299 @@ namespace Azure { namespace Storage { namespace Blobs {
       chunkSize = (chunkSize + c_grainSize - 1) / c_grainSize * c_grainSize;
     }
 
+    auto context = Storage::Details::BindTransferContext(options.TransferHandle, options.Context);
+    if (options.TransferHandle)
+    {
+      options.TransferHandle->SetTotalBytes(fileReader.GetFileSize());
+    }
+
+    std::unique_ptr<Storage::Details::MemoryMappedFile> mappedFile;
+    if (options.UseMemoryMappedFile)
+    {
+      try
+      {
+        mappedFile = std::make_unique<Storage::Details::MemoryMappedFile>(fileReader);
+      }
+      catch (std::runtime_error&)
+      {
+        // Fall back to reading the file.
+      }
+    }
+
+    // The checksum header precedes the body, so with transactional CRC64 every block is read into
+    // memory once, checksummed and sent from there instead of being streamed from the file. A
+    // mapped file is checksummed and sent in place. blockData is set to the block's content
+    // whenever it's in memory.
+    auto openBlock = [&](int64_t offset,
+                         int64_t length,
+                         Storage::Details::PooledBuffer& blockContent,
+                         const uint8_t*& blockData)
+        -> std::unique_ptr<Azure::Core::Http::BodyStream> {
+      if (mappedFile)
+      {
+        blockData = mappedFile->Data() + offset;
+        return std::make_unique<Azure::Core::Http::MemoryBodyStream>(blockData, length);
+      }
+      auto fileStream = std::make_unique<Azure::Core::Http::FileBodyStream>(
+          fileReader.GetHandle(), offset, length);
+      if (!options.UseTransactionalCrc64)
+      {
+        return fileStream;
+      }
+      blockContent = Storage::Details::BufferPool::GetTransferBufferPool().Acquire(
+          static_cast<std::size_t>(length));
+      if (Azure::Core::Http::BodyStream::ReadToCount(
+              context, *fileStream, blockContent.Data(), length)
+          != length)
+      {
+        throw std::runtime_error("error when reading file");
+      }
+      blockData = blockContent.Data();
+      return std::make_unique<Azure::Core::Http::MemoryBodyStream>(blockData, length);
+    };
+
+    if (options.IncrementalUpload)
+    {
+      const int64_t fileSize = fileReader.GetFileSize();
+      struct ContentBlock
+      {
+        int64_t Offset = 0;
+        int64_t Length = 0;
+        Crc64 ContentCrc64;
+      };
+      std::vector<ContentBlock> blocks;
+
+      if (options.UseContentDefinedChunking)
+      {
+        // Blocks may be down to a quarter of the average size, which must still keep the blob
+        // within the block limit.
+        constexpr int64_t c_maxBlockSize = 4000LL * 1024 * 1024;
+        const int64_t averageBlockSize = std::min(
+            std::max(chunkSize, (fileSize + c_maximumNumberBlocks - 1) / c_maximumNumberBlocks * 4),
+            c_maxBlockSize / 4);
+        Storage::Details::ContentDefinedChunker chunker(
+            averageBlockSize / 4, averageBlockSize, averageBlockSize * 4);
+        constexpr int64_t c_scanSize = 4 * 1024 * 1024;
+        Storage::Details::PooledBuffer scanBuffer;
+        if (!mappedFile)
+        {
+          scanBuffer = Storage::Details::BufferPool::GetTransferBufferPool().Acquire(
+              static_cast<std::size_t>(std::min(c_scanSize, fileSize)));
+        }
+        ContentBlock block;
+        for (int64_t offset = 0; offset < fileSize;)
+        {
+          const int64_t length = std::min(c_scanSize, fileSize - offset);
+          const uint8_t* data = nullptr;
+          if (mappedFile)
+          {
+            data = mappedFile->Data() + offset;
+          }
+          else
+          {
+            Azure::Core::Http::FileBodyStream fileStream(fileReader.GetHandle(), offset, length);
+            if (Azure::Core::Http::BodyStream::ReadToCount(
+                    context, fileStream, scanBuffer.Data(), length)
+                != length)
+            {
+              throw std::runtime_error("error when reading file");
+            }
+            data = scanBuffer.Data();
+          }
+          int64_t position = 0;
+          while (position < length)
+          {
+            const int64_t boundary = chunker.FindBoundary(data + position, length - position);
+            const int64_t blockPartLength = boundary < 0 ? length - position : boundary;
+            block.ContentCrc64.Update(data + position, static_cast<std::size_t>(blockPartLength));
+            position += blockPartLength;
+            if (boundary >= 0)
+            {
+              block.Length = offset + position - block.Offset;
+              blocks.push_back(std::move(block));
+              block = ContentBlock();
+              block.Offset = offset + position;
+            }
+          }
+          offset += length;
+        }
+        if (block.Offset < fileSize)
+        {
+          block.Length = fileSize - block.Offset;
+          blocks.push_back(std::move(block));
+        }
+      }
+      else
+      {
+        blocks.resize(static_cast<std::size_t>((fileSize + chunkSize - 1) / chunkSize));
+        auto checksumBlockFunc
+            = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
+                unused(numChunks);
+                auto& block = blocks[static_cast<std::size_t>(chunkId)];
+                block.Offset = offset;
+                block.Length = length;
+                if (mappedFile)
+                {
+                  block.ContentCrc64.Update(
+                      mappedFile->Data() + offset, static_cast<std::size_t>(length));
+                  return;
+                }
+                Azure::Core::Http::FileBodyStream fileStream(
+                    fileReader.GetHandle(), offset, length);
+                auto blockContent = Storage::Details::BufferPool::GetTransferBufferPool().Acquire(
+                    static_cast<std::size_t>(length));
+                if (Azure::Core::Http::BodyStream::ReadToCount(
+                        context, fileStream, blockContent.Data(), length)
+                    != length)
+                {
+                  throw std::runtime_error("error when reading file");
+                }
+                block.ContentCrc64.Update(blockContent.Data(), static_cast<std::size_t>(length));
+              };
+        Storage::Details::ConcurrentTransfer(
+            0, fileSize, chunkSize, options.Concurrency, checksumBlockFunc);
+      }
+
+      // The IDs have the same length as the ones of other uploads, the service requires all
+      // blocks of a blob to have IDs of the same length.
+      auto getContentBlockId = [](const ContentBlock& block) {
+        constexpr std::size_t c_blockIdLength = 64;
+        static const char c_hexDigits[] = "0123456789abcdef";
+        std::string blockId = std::to_string(block.Length) + "-";
+        for (char c : block.ContentCrc64.Digest())
+        {
+          blockId += c_hexDigits[static_cast<uint8_t>(c) >> 4];
+          blockId += c_hexDigits[static_cast<uint8_t>(c) & 15];
+        }
+        blockId = std::string(c_blockIdLength - blockId.length(), '0') + blockId;
+        return Base64Encode(blockId);
+      };
+
+      std::map<std::string, int64_t> existingBlocks;
+      try
+      {
+        GetBlockListOptions getBlockListOptions;
+        getBlockListOptions.Context = context;
+        getBlockListOptions.ListType = Models::BlockListTypeOption::All;
+        auto blockList = GetBlockList(getBlockListOptions);
+        for (const auto& block : blockList->CommittedBlocks)
+        {
+          existingBlocks[block.Name] = block.Size;
+        }
+        for (const auto& block : blockList->UncommittedBlocks)
+        {
+          existingBlocks[block.Name] = block.Size;
+        }
+      }
+      catch (StorageException& e)
+      {
+        if (e.StatusCode != Azure::Core::Http::HttpStatusCode::NotFound)
+        {
+          throw;
+        }
+      }
+
+      std::vector<std::pair<Models::BlockType, std::string>> blockIds;
+      std::vector<std::size_t> missingBlocks;
+      int64_t missingBytes = 0;
+      for (std::size_t i = 0; i < blocks.size(); ++i)
+      {
+        std::string blockId = getContentBlockId(blocks[i]);
+        auto existingBlock = existingBlocks.find(blockId);
+        if (existingBlock == existingBlocks.end() || existingBlock->second != blocks[i].Length)
+        {
+          // Repeated content is only staged once.
+          existingBlocks[blockId] = blocks[i].Length;
+          missingBlocks.push_back(i);
+          missingBytes += blocks[i].Length;
+        }
+        blockIds.emplace_back(Models::BlockType::Latest, std::move(blockId));
+      }
+      if (options.TransferHandle)
+      {
+        options.TransferHandle->SetTotalBytes(missingBytes);
+      }
+
+      // The transfer is over the indexes of the missing blocks, each of them is one chunk.
+      auto stageBlockFunc = [&](int64_t index, int64_t, int64_t, int64_t) {
+        const std::size_t i = missingBlocks[static_cast<std::size_t>(index)];
+        const auto& block = blocks[i];
+        Storage::Details::TransferSlot slot(options.TransferHandle, block.Length);
+        auto contentStream = std::make_unique<Azure::Core::Http::FileBodyStream>(
+            fileReader.GetHandle(), block.Offset, block.Length);
+        StageBlockOptions stageBlockOptions;
+        stageBlockOptions.Context = context;
+        // The service checks that the content matches the checksum the block ID is made of.
+        stageBlockOptions.TransactionalContentCrc64 = Base64Encode(block.ContentCrc64.Digest());
+        StageBlock(blockIds[i].second, contentStream.get(), stageBlockOptions);
+        slot.Complete(block.Length);
+      };
+      Storage::Details::ConcurrentTransfer(
+          0,
+          static_cast<int64_t>(missingBlocks.size()),
+          1,
+          options.Concurrency,
+          stageBlockFunc);
+
+      CommitBlockListOptions commitBlockListOptions;
+      commitBlockListOptions.Context = context;
+      commitBlockListOptions.HttpHeaders = options.HttpHeaders;
+      commitBlockListOptions.Metadata = options.Metadata;
+      commitBlockListOptions.Tier = options.Tier;
+      auto commitBlockListResponse = CommitBlockList(blockIds, commitBlockListOptions);
+
+      Models::UploadBlockBlobFromResult result;
+      result.ETag = commitBlockListResponse->ETag;
+      result.LastModified = commitBlockListResponse->LastModified;
+      result.VersionId = commitBlockListResponse->VersionId;
+      result.ServerEncrypted = commitBlockListResponse->ServerEncrypted;
+      result.EncryptionKeySha256 = commitBlockListResponse->EncryptionKeySha256;
+      result.EncryptionScope = commitBlockListResponse->EncryptionScope;
+      if (options.UseTransactionalCrc64)
+      {
+        Crc64 contentCrc64;
+        for (const auto& block : blocks)
+        {
+          contentCrc64.Concatenate(block.ContentCrc64);
+        }
+        result.TransactionalContentCrc64 = Base64Encode(contentCrc64.Digest());
+      }
+      return Azure::Core::Response<Models::UploadBlockBlobFromResult>(
+          std::move(result),
+          std::make_unique<Azure::Core::Http::RawResponse>(
+              std::move(commitBlockListResponse.GetRawResponse())));
+    }
+
     if (fileReader.GetFileSize() <= chunkSize)
     {
-      Azure::Core::Http::FileBodyStream contentStream(
-          fileReader.GetHandle(), 0, fileReader.GetFileSize());
+      Storage::Details::PooledBuffer blockContent;
+      const uint8_t* blockData = nullptr;
+      auto contentStream = openBlock(0, fileReader.GetFileSize(), blockContent, blockData);
       UploadBlockBlobOptions uploadBlockBlobOptions;
-      uploadBlockBlobOptions.Context = options.Context;
+      uploadBlockBlobOptions.Context = context;
       uploadBlockBlobOptions.HttpHeaders = options.HttpHeaders;
       uploadBlockBlobOptions.Metadata = options.Metadata;
       uploadBlockBlobOptions.Tier = options.Tier;
-      return Upload(&contentStream, uploadBlockBlobOptions);
+      if (options.UseTransactionalCrc64)
+      {
+        uploadBlockBlobOptions.TransactionalContentCrc64
+            = Base64Encode(Crc64::Hash(
+                blockData, static_cast<std::size_t>(fileReader.GetFileSize())));
+      }
+      Storage::Details::TransferSlot slot(options.TransferHandle, fileReader.GetFileSize());
+      auto response = Upload(contentStream.get(), uploadBlockBlobOptions);
+      slot.Complete(fileReader.GetFileSize());
+      response->TransactionalContentCrc64 = uploadBlockBlobOptions.TransactionalContentCrc64;
+      return response;
     }
 
     std::vector<std::pair<Models::BlockType, std::string>> blockIds;
+    std::vector<Crc64> blockCrc64s;
+    if (options.UseTransactionalCrc64)
+    {
+      blockCrc64s.resize(
+          static_cast<std::size_t>((fileReader.GetFileSize() + chunkSize - 1) / chunkSize));
+    }
     auto getBlockId = [](int64_t id) {
       constexpr std::size_t c_blockIdLength = 64;
       std::string blockId = std::to_string(id);
@@ -226,19 +604,90 @@ namespace Azure { namespace Storage { namespace Blobs {
       return Base64Encode(blockId);
     };
 
+    // A block recorded in the checkpoint file is only skipped if it's still staged with the
+    // expected size, uncommitted blocks are discarded by the service after a week. The checkpoint
+    // file is only used for the same source file, unmodified since it was written.
+    std::unique_ptr<Storage::Details::TransferJournal> journal;
+    std::vector<bool> stagedBlocks;
+    if (!options.CheckpointFileName.empty())
+    {
+      journal = std::make_unique<Storage::Details::TransferJournal>(
+          options.CheckpointFileName,
+          m_blobUrl.GetAbsoluteUrl() + " " + std::to_string(fileReader.GetLastWriteTime()) + " "
+              + fileName,
+          fileReader.GetFileSize(),
+          chunkSize);
+      if (journal->IsResumed())
+      {
+        const int64_t numChunks = (fileReader.GetFileSize() + chunkSize - 1) / chunkSize;
+        std::map<std::string, int64_t> uncommittedBlocks;
+        GetBlockListOptions getBlockListOptions;
+        getBlockListOptions.Context = context;
+        getBlockListOptions.ListType = Models::BlockListTypeOption::All;
+        for (const auto& block : GetBlockList(getBlockListOptions)->UncommittedBlocks)
+        {
+          uncommittedBlocks[block.Name] = block.Size;
+        }
+        stagedBlocks.resize(static_cast<std::size_t>(numChunks));
+        for (int64_t i = 0; i < numChunks; ++i)
+        {
+          auto block = uncommittedBlocks.find(getBlockId(i));
+          stagedBlocks[static_cast<std::size_t>(i)] = journal->IsChunkDone(i)
+              && block != uncommittedBlocks.end()
+              && block->second == std::min(chunkSize, fileReader.GetFileSize() - chunkSize * i);
+        }
+      }
+    }
+
     auto uploadBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-      Azure::Core::Http::FileBodyStream contentStream(fileReader.GetHandle(), offset, length);
-      StageBlockOptions chunkOptions;
-      chunkOptions.Context = options.Context;
-      auto blockInfo = StageBlock(getBlockId(chunkId), &contentStream, chunkOptions);
       if (chunkId == numChunks - 1)
       {
         blockIds.resize(static_cast<std::size_t>(numChunks));
       }
+      if (!stagedBlocks.empty() && stagedBlocks[static_cast<std::size_t>(chunkId)])
+      {
+        // Staged before the transfer was interrupted, only its checksum is needed.
+        if (options.UseTransactionalCrc64)
+        {
+          Storage::Details::PooledBuffer blockContent;
+          const uint8_t* blockData = nullptr;
+          openBlock(offset, length, blockContent, blockData);
+          blockCrc64s[static_cast<std::size_t>(chunkId)].Update(
+              blockData, static_cast<std::size_t>(length));
+        }
+        return;
+      }
+      if (!mappedFile)
+      {
+        // Have the OS read the block this worker is likely to pick up next while this one is
+        // sent.
+        fileReader.Prefetch(offset + options.Concurrency * chunkSize, chunkSize);
+      }
+      Storage::Details::PooledBuffer blockContent;
+      const uint8_t* blockData = nullptr;
+      auto contentStream = openBlock(offset, length, blockContent, blockData);
+      StageBlockOptions chunkOptions;
+      chunkOptions.Context = context;
+      if (options.UseTransactionalCrc64)
+      {
+        auto& blockCrc64 = blockCrc64s[static_cast<std::size_t>(chunkId)];
+        blockCrc64.Update(blockData, static_cast<std::size_t>(length));
+        chunkOptions.TransactionalContentCrc64 = Base64Encode(blockCrc64.Digest());
+      }
+      auto blockInfo = StageBlock(getBlockId(chunkId), contentStream.get(), chunkOptions);
+      if (journal)
+      {
+        journal->SetChunkDone(chunkId);
+      }
     };
 
     Storage::Details::ConcurrentTransfer(
-        0, fileReader.GetFileSize(), chunkSize, options.Concurrency, uploadBlockFunc);
+        0,
+        fileReader.GetFileSize(),
+        chunkSize,
+        options.Concurrency,
+        uploadBlockFunc,
+        options.TransferHandle);
 
     for (std::size_t i = 0; i < blockIds.size(); ++i)
     {
@@ -246,7 +695,176 @@ namespace Azure { namespace Storage { namespace Blobs {
       blockIds[i].second = getBlockId(static_cast<int64_t>(i));
     }
     CommitBlockListOptions commitBlockListOptions;
-    commitBlockListOptions.Context = options.Context;
+    commitBlockListOptions.Context = context;
+    commitBlockListOptions.HttpHeaders = options.HttpHeaders;
+    commitBlockListOptions.Metadata = options.Metadata;
+    commitBlockListOptions.Tier = options.Tier;
+    auto commitBlockListResponse = CommitBlockList(blockIds, commitBlockListOptions);
+    if (journal)
+    {
+      journal->Remove();
+    }
+
+    Models::UploadBlockBlobFromResult result;
+    result.ETag = commitBlockListResponse->ETag;
+    result.LastModified = commitBlockListResponse->LastModified;
+    result.VersionId = commitBlockListResponse->VersionId;
+    result.ServerEncrypted = commitBlockListResponse->ServerEncrypted;
+    result.EncryptionKeySha256 = commitBlockListResponse->EncryptionKeySha256;
+    result.EncryptionScope = commitBlockListResponse->EncryptionScope;
+    if (options.UseTransactionalCrc64)
+    {
+      Crc64 contentCrc64;
+      for (const auto& blockCrc64 : blockCrc64s)
+      {
+        contentCrc64.Concatenate(blockCrc64);
+      }
+      result.TransactionalContentCrc64 = Base64Encode(contentCrc64.Digest());
+    }
+    return Azure::Core::Response<Models::UploadBlockBlobFromResult>(
+        std::move(result),
+        std::make_unique<Azure::Core::Http::RawResponse>(
+            std::move(commitBlockListResponse.GetRawResponse())));
+  }
+
+  Azure::Core::Response<Models::UploadBlockBlobFromResult> BlockBlobClient::UploadFrom(
+      Azure::Core::Http::BodyStream& content,
+      const UploadBlockBlobFromOptions& options) const
+  {
+    constexpr int64_t c_defaultBlockSize = 8 * 1024 * 1024;
+    constexpr int64_t c_maximumNumberBlocks = 50000;
+    constexpr int64_t c_grainSize = 4 * 1024;
+
+    // The length of some streams isn't known up front.
+    const int64_t contentLength = content.Length();
+
+    int64_t chunkSize = c_defaultBlockSize;
+    if (options.ChunkSize.HasValue())
+    {
+      chunkSize = options.ChunkSize.GetValue();
+    }
+    else if (contentLength > 0)
+    {
+      int64_t minBlockSize = (contentLength + c_maximumNumberBlocks - 1) / c_maximumNumberBlocks;
+      chunkSize = std::max(chunkSize, minBlockSize);
+      chunkSize = (chunkSize + c_grainSize - 1) / c_grainSize * c_grainSize;
+    }
+
+    auto context = Storage::Details::BindTransferContext(options.TransferHandle, options.Context);
+    if (options.TransferHandle && contentLength >= 0)
+    {
+      options.TransferHandle->SetTotalBytes(contentLength);
+    }
+
+    auto& bufferPool = Storage::Details::BufferPool::GetTransferBufferPool();
+    auto readBlock = [&](Storage::Details::PooledBuffer& blockContent) {
+      blockContent = bufferPool.Acquire(static_cast<std::size_t>(chunkSize));
+      return Azure::Core::Http::BodyStream::ReadToCount(
+          context, content, blockContent.Data(), chunkSize);
+    };
+
+    Storage::Details::PooledBuffer blockContent;
+    int64_t blockLength = readBlock(blockContent);
+    if (blockLength < chunkSize)
+    {
+      Azure::Core::Http::MemoryBodyStream contentStream(blockContent.Data(), blockLength);
+      UploadBlockBlobOptions uploadBlockBlobOptions;
+      uploadBlockBlobOptions.Context = context;
+      uploadBlockBlobOptions.HttpHeaders = options.HttpHeaders;
+      uploadBlockBlobOptions.Metadata = options.Metadata;
+      uploadBlockBlobOptions.Tier = options.Tier;
+      if (options.UseTransactionalCrc64)
+      {
+        uploadBlockBlobOptions.TransactionalContentCrc64 = Base64Encode(
+            Crc64::Hash(blockContent.Data(), static_cast<std::size_t>(blockLength)));
+      }
+      Storage::Details::TransferSlot slot(options.TransferHandle, blockLength);
+      auto response = Upload(&contentStream, uploadBlockBlobOptions);
+      slot.Complete(blockLength);
+      response->TransactionalContentCrc64 = uploadBlockBlobOptions.TransactionalContentCrc64;
+      return response;
+    }
+
+    std::vector<std::pair<Models::BlockType, std::string>> blockIds;
+    // Growing a deque doesn't move the CRC64s that blocks being staged are updating.
+    std::deque<Crc64> blockCrc64s;
+    auto getBlockId = [](int64_t id) {
+      constexpr std::size_t c_blockIdLength = 64;
+      std::string blockId = std::to_string(id);
+      blockId = std::string(c_blockIdLength - blockId.length(), '0') + blockId;
+      return Base64Encode(blockId);
+    };
+
+    // Buffers are only read while one is free, so a producer that's faster than the network waits
+    // and memory stays bounded by Concurrency * ChunkSize.
+    StagingBuffers stagingBuffers(options.Concurrency);
+    auto stageBlock = [&](std::shared_ptr<Storage::Details::PooledBuffer> block,
+                          int64_t length,
+                          const std::string& blockId,
+                          Crc64* blockCrc64) {
+      std::exception_ptr exception;
+      try
+      {
+        Storage::Details::TransferSlot slot(options.TransferHandle, length);
+        Azure::Core::Http::MemoryBodyStream contentStream(block->Data(), length);
+        StageBlockOptions chunkOptions;
+        chunkOptions.Context = context;
+        if (blockCrc64)
+        {
+          blockCrc64->Update(block->Data(), static_cast<std::size_t>(length));
+          chunkOptions.TransactionalContentCrc64 = Base64Encode(blockCrc64->Digest());
+        }
+        StageBlock(blockId, &contentStream, chunkOptions);
+        slot.Complete(length);
+      }
+      catch (...)
+      {
+        exception = std::current_exception();
+      }
+      block.reset();
+      stagingBuffers.Release(exception);
+    };
+
+    stagingBuffers.Acquire();
+    while (blockLength > 0)
+    {
+      blockIds.emplace_back(
+          Models::BlockType::Uncommitted, getBlockId(static_cast<int64_t>(blockIds.size())));
+      Crc64* blockCrc64 = nullptr;
+      if (options.UseTransactionalCrc64)
+      {
+        blockCrc64s.emplace_back();
+        blockCrc64 = &blockCrc64s.back();
+      }
+      auto block = std::make_shared<Storage::Details::PooledBuffer>(std::move(blockContent));
+      std::string blockId = blockIds.back().second;
+      Storage::Details::SubmitTransferTask(
+          options.TransferHandle, [&stageBlock, block, blockLength, blockId, blockCrc64]() mutable {
+            stageBlock(std::move(block), blockLength, blockId, blockCrc64);
+          });
+      if (blockLength < chunkSize || !stagingBuffers.Acquire())
+      {
+        break;
+      }
+      blockLength = 0;
+      try
+      {
+        blockLength = readBlock(blockContent);
+      }
+      catch (...)
+      {
+        stagingBuffers.Release(std::current_exception());
+        break;
+      }
+      if (blockLength == 0)
+      {
+        stagingBuffers.Release();
+      }
+    }
+    stagingBuffers.WaitForAll();
+
+    CommitBlockListOptions commitBlockListOptions;
+    commitBlockListOptions.Context = context;
     commitBlockListOptions.HttpHeaders = options.HttpHeaders;
     commitBlockListOptions.Metadata = options.Metadata;
     commitBlockListOptions.Tier = options.Tier;
@@ -259,6 +877,15 @@ namespace Azure { namespace Storage { namespace Blobs {
     result.ServerEncrypted = commitBlockListResponse->ServerEncrypted;
     result.EncryptionKeySha256 = commitBlockListResponse->EncryptionKeySha256;
     result.EncryptionScope = commitBlockListResponse->EncryptionScope;
+    if (options.UseTransactionalCrc64)
+    {
+      Crc64 contentCrc64;
+      for (const auto& blockCrc64 : blockCrc64s)
+      {
+        contentCrc64.Concatenate(blockCrc64);
+      }
+      result.TransactionalContentCrc64 = Base64Encode(contentCrc64.Digest());
+    }
     return Azure::Core::Response<Models::UploadBlockBlobFromResult>(
         std::move(result),
         std::make_unique<Azure::Core::Http::RawResponse>(
@@ -325,6 +952,82 @@ namespace Azure { namespace Storage { namespace Blobs {
         options.Context, *m_pipeline, m_blobUrl, protocolLayerOptions);
   }
 
+  Azure::Core::Response<Models::CopyBlockBlobFromResult> BlockBlobClient::CopyFrom(
+      const std::string& sourceUri,
+      const CopyBlockBlobFromOptions& options) const
+  {
+    constexpr int64_t c_defaultBlockSize = 8 * 1024 * 1024;
+    constexpr int64_t c_maximumNumberBlocks = 50000;
+    constexpr int64_t c_grainSize = 4 * 1024;
+
+    // The source is expected to be public or carry a SAS, so it's read with an anonymous client.
+    GetBlobPropertiesOptions sourcePropertiesOptions;
+    sourcePropertiesOptions.Context = options.Context;
+    auto sourceProperties = BlobClient(sourceUri).GetProperties(sourcePropertiesOptions);
+    const int64_t sourceSize = sourceProperties->ContentLength;
+
+    int64_t chunkSize = c_defaultBlockSize;
+    if (options.ChunkSize.HasValue())
+    {
+      chunkSize = options.ChunkSize.GetValue();
+    }
+    else
+    {
+      int64_t minBlockSize = (sourceSize + c_maximumNumberBlocks - 1) / c_maximumNumberBlocks;
+      chunkSize = std::max(chunkSize, minBlockSize);
+      chunkSize = (chunkSize + c_grainSize - 1) / c_grainSize * c_grainSize;
+    }
+
+    auto getBlockId = [](int64_t id) {
+      constexpr std::size_t c_blockIdLength = 64;
+      std::string blockId = std::to_string(id);
+      blockId = std::string(c_blockIdLength - blockId.length(), '0') + blockId;
+      return Base64Encode(blockId);
+    };
+
+    // Every block is read from the version of the source the properties were taken from.
+    auto stageBlockFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
+      unused(numChunks);
+      StageBlockFromUriOptions chunkOptions;
+      chunkOptions.Context = options.Context;
+      chunkOptions.SourceOffset = offset;
+      chunkOptions.SourceLength = length;
+      chunkOptions.SourceConditions.IfMatch = sourceProperties->ETag;
+      StageBlockFromUri(getBlockId(chunkId), sourceUri, chunkOptions);
+    };
+
+    Storage::Details::ConcurrentTransfer(
+        0, sourceSize, chunkSize, options.Concurrency, stageBlockFunc);
+
+    std::vector<std::pair<Models::BlockType, std::string>> blockIds;
+    const int64_t numBlocks = (sourceSize + chunkSize - 1) / chunkSize;
+    for (int64_t i = 0; i < numBlocks; ++i)
+    {
+      blockIds.emplace_back(Models::BlockType::Uncommitted, getBlockId(i));
+    }
+    CommitBlockListOptions commitBlockListOptions;
+    commitBlockListOptions.Context = options.Context;
+    commitBlockListOptions.HttpHeaders = options.HttpHeaders.HasValue()
+        ? options.HttpHeaders.GetValue()
+        : sourceProperties->HttpHeaders;
+    commitBlockListOptions.Metadata
+        = options.Metadata.HasValue() ? options.Metadata.GetValue() : sourceProperties->Metadata;
+    commitBlockListOptions.Tier = options.Tier;
+    auto commitBlockListResponse = CommitBlockList(blockIds, commitBlockListOptions);
+
+    Models::CopyBlockBlobFromResult result;
+    result.ETag = commitBlockListResponse->ETag;
+    result.LastModified = commitBlockListResponse->LastModified;
+    result.VersionId = commitBlockListResponse->VersionId;
+    result.ServerEncrypted = commitBlockListResponse->ServerEncrypted;
+    result.EncryptionKeySha256 = commitBlockListResponse->EncryptionKeySha256;
+    result.EncryptionScope = commitBlockListResponse->EncryptionScope;
+    return Azure::Core::Response<Models::CopyBlockBlobFromResult>(
+        std::move(result),
+        std::make_unique<Azure::Core::Http::RawResponse>(
+            std::move(commitBlockListResponse.GetRawResponse())));
+  }
+
   Azure::Core::Response<Models::CommitBlockListResult> BlockBlobClient::CommitBlockList(
       const std::vector<std::pair<Models::BlockType, std::string>>& blockIds,
       const CommitBlockListOptions& options) const
@@ -3,13 +3,195 @@
 
 #include "azure/storage/blobs/page_blob_client.hpp"
 
+#include "azure/storage/common/buffer_pool.hpp"
 #include "azure/storage/common/concurrent_transfer.hpp"
 #include "azure/storage/common/constants.hpp"
 #include "azure/storage/common/file_io.hpp"
 #include "azure/storage/common/storage_common.hpp"
+#include "azure/storage/common/transfer_manager.hpp"
+
+#include <algorithm>
+#include <cstring>
 
 namespace Azure { namespace Storage { namespace Blobs {
 
+  namespace {
+    constexpr int64_t c_pageSize = 512;
+    // The service accepts at most 4 MB per UploadPages request.
+    constexpr int64_t c_maxUploadPagesSize = 4 * 1024 * 1024;
+
+    // The chunks of page uploads and copies are written with single requests, so they must be
+    // whole pages the service accepts.
+    int64_t GetUploadPagesChunkSize(const Azure::Core::Nullable<int64_t>& chunkSize)
+    {
+      if (!chunkSize.HasValue())
+      {
+        return c_maxUploadPagesSize;
+      }
+      if (chunkSize.GetValue() <= 0 || chunkSize.GetValue() % c_pageSize != 0
+          || chunkSize.GetValue() > c_maxUploadPagesSize)
+      {
+        throw std::runtime_error("chunk size must be a multiple of 512 of at most 4 MB");
+      }
+      return chunkSize.GetValue();
+    }
+
+    // Chunks of downloads are only limited by memory, but each of them must make progress.
+    int64_t GetDownloadPagesChunkSize(const Azure::Core::Nullable<int64_t>& chunkSize)
+    {
+      constexpr int64_t c_defaultChunkSize = 4 * 1024 * 1024;
+      if (!chunkSize.HasValue())
+      {
+        return c_defaultChunkSize;
+      }
+      if (chunkSize.GetValue() <= 0)
+      {
+        throw std::runtime_error("chunk size must be positive");
+      }
+      return chunkSize.GetValue();
+    }
+
+    // Checks the sizes of an upload from a buffer or file of blobSize bytes and creates the blob.
+    // Returns the chunk size.
+    int64_t CreateForUpload(
+        const PageBlobClient& client,
+        int64_t blobSize,
+        const UploadPageBlobFromOptions& options,
+        const Azure::Core::Context& context)
+    {
+      if (blobSize % c_pageSize != 0)
+      {
+        throw std::runtime_error("page blob size must be a multiple of 512");
+      }
+      const int64_t chunkSize = GetUploadPagesChunkSize(options.ChunkSize);
+      if (options.TransferHandle)
+      {
+        options.TransferHandle->SetTotalBytes(blobSize);
+      }
+
+      CreatePageBlobOptions createOptions;
+      createOptions.Context = context;
+      createOptions.HttpHeaders = options.HttpHeaders;
+      createOptions.Metadata = options.Metadata;
+      createOptions.Tier = options.Tier;
+      client.Create(blobSize, createOptions);
+      return chunkSize;
+    }
+
+    // The result of an upload, copy or sync that wrote pages in parallel. The pages are written in
+    // no particular order, so the final state of the blob is fetched.
+    template <class T>
+    Azure::Core::Response<T> MakePagesWrittenResult(
+        const PageBlobClient& client,
+        const Azure::Core::Context& context)
+    {
+      GetBlobPropertiesOptions propertiesOptions;
+      propertiesOptions.Context = context;
+      auto properties = client.GetProperties(propertiesOptions);
+
+      T result;
+      result.ETag = properties->ETag;
+      result.LastModified = properties->LastModified;
+      result.ContentLength = properties->ContentLength;
+      result.SequenceNumber = properties->SequenceNumber;
+      return Azure::Core::Response<T>(
+          std::move(result),
+          std::make_unique<Azure::Core::Http::RawResponse>(
+              std::move(properties.GetRawResponse())));
+    }
+
+    // Uploads the pages of a chunk that aren't all zeros, with one request per run of them.
+    void UploadNonZeroPages(
+        const PageBlobClient& client,
+        const uint8_t* data,
+        int64_t offset,
+        int64_t length,
+        const Azure::Core::Context& context)
+    {
+      int64_t runStart = -1;
+      for (int64_t position = 0; position <= length; position += c_pageSize)
+      {
+        const bool isZero = position == length
+            || Storage::Details::IsAllZeros(
+                data + position, static_cast<std::size_t>(c_pageSize));
+        if (!isZero && runStart < 0)
+        {
+          runStart = position;
+        }
+        else if (isZero && runStart >= 0)
+        {
+          Azure::Core::Http::MemoryBodyStream pageStream(
+              data + runStart, static_cast<std::size_t>(position - runStart));
+          UploadPageBlobPagesOptions uploadPagesOptions;
+          uploadPagesOptions.Context = context;
+          client.UploadPages(offset + runStart, &pageStream, uploadPagesOptions);
+          runStart = -1;
+        }
+      }
+    }
+
+    // Downloads the page ranges into the file with parallel requests, split into chunks of at most
+    // chunkSize bytes.
+    void DownloadPageRanges(
+        const PageBlobClient& client,
+        const std::vector<Models::PageRange>& pageRanges,
+        int64_t chunkSize,
+        int concurrency,
+        const BlobAccessConditions& accessConditions,
+        Storage::Details::FileWriter& fileWriter,
+        const Azure::Core::Context& context)
+    {
+      std::vector<Models::PageRange> chunks;
+      for (const auto& pageRange : pageRanges)
+      {
+        for (int64_t offset = 0; offset < pageRange.Length; offset += chunkSize)
+        {
+          Models::PageRange chunk;
+          chunk.Offset = pageRange.Offset + offset;
+          chunk.Length = std::min(chunkSize, pageRange.Length - offset);
+          chunks.push_back(chunk);
+        }
+      }
+
+      // The transfer is over the indexes of the chunks, each of them is one chunk.
+      auto downloadChunkFunc = [&](int64_t index, int64_t, int64_t, int64_t) {
+        const auto& chunk = chunks[static_cast<std::size_t>(index)];
+        DownloadBlobOptions chunkOptions;
+        chunkOptions.Context = context;
+        chunkOptions.Offset = chunk.Offset;
+        chunkOptions.Length = chunk.Length;
+        chunkOptions.AccessConditions = accessConditions;
+        auto chunkResponse = client.Download(chunkOptions);
+        auto buffer = Storage::Details::BufferPool::GetTransferBufferPool().Acquire(
+            static_cast<std::size_t>(chunk.Length));
+        if (Azure::Core::Http::BodyStream::ReadToCount(
+                context, *chunkResponse->BodyStream, buffer.Data(), chunk.Length)
+            != chunk.Length)
+        {
+          throw std::runtime_error("error when reading body stream");
+        }
+        fileWriter.Write(buffer.Data(), chunk.Length, chunk.Offset);
+      };
+      Storage::Details::ConcurrentTransfer(
+          0, static_cast<int64_t>(chunks.size()), 1, concurrency, downloadChunkFunc);
+    }
+
+    Models::DownloadBlobToResult MakeDownloadBlobToResult(
+        const Models::GetBlobPropertiesResult& properties)
+    {
+      Models::DownloadBlobToResult result;
+      result.ETag = properties.ETag;
+      result.LastModified = properties.LastModified;
+      result.ContentLength = properties.ContentLength;
+      result.HttpHeaders = properties.HttpHeaders;
+      result.Metadata = properties.Metadata;
+      result.BlobType = properties.BlobType;
+      result.ServerEncrypted = properties.ServerEncrypted;
+      result.EncryptionKeySha256 = properties.EncryptionKeySha256;
+      return result;
+    }
+  } // namespace
+
   PageBlobClient PageBlobClient::CreateFromConnectionString(
       const std::string& connectionString,
       const std::string& containerName,
@@ -162,6 +344,286 @@ namespace Azure { namespace Storage { namespace Blobs {
         options.Context, *m_pipeline, m_blobUrl, protocolLayerOptions);
   }
 
+  Azure::Core::Response<Models::CopyPageBlobFromResult> PageBlobClient::CopyFrom(
+      const std::string& sourceUri,
+      const CopyPageBlobFromOptions& options) const
+  {
+    // Checked before the destination is replaced.
+    const int64_t chunkSize = GetUploadPagesChunkSize(options.ChunkSize);
+
+    // The source is expected to be public or carry a SAS, so it's read with an anonymous client.
+    GetBlobPropertiesOptions sourcePropertiesOptions;
+    sourcePropertiesOptions.Context = options.Context;
+    auto sourceProperties = BlobClient(sourceUri).GetProperties(sourcePropertiesOptions);
+    const int64_t sourceSize = sourceProperties->ContentLength;
+
+    CreatePageBlobOptions createOptions;
+    createOptions.Context = options.Context;
+    createOptions.HttpHeaders = options.HttpHeaders.HasValue() ? options.HttpHeaders.GetValue()
+                                                               : sourceProperties->HttpHeaders;
+    createOptions.Metadata
+        = options.Metadata.HasValue() ? options.Metadata.GetValue() : sourceProperties->Metadata;
+    Create(sourceSize, createOptions);
+
+    auto uploadPageFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
+      unused(chunkId, numChunks);
+      UploadPageBlobPagesFromUriOptions chunkOptions;
+      chunkOptions.Context = options.Context;
+      UploadPagesFromUri(offset, sourceUri, offset, length, chunkOptions);
+    };
+
+    Storage::Details::ConcurrentTransfer(
+        0, sourceSize, chunkSize, options.Concurrency, uploadPageFunc);
+
+    return MakePagesWrittenResult<Models::CopyPageBlobFromResult>(*this, options.Context);
+  }
+
+  Azure::Core::Response<Models::UploadPageBlobFromResult> PageBlobClient::UploadFrom(
+      const uint8_t* buffer,
+      std::size_t bufferSize,
+      const UploadPageBlobFromOptions& options) const
+  {
+    const int64_t blobSize = static_cast<int64_t>(bufferSize);
+    auto context = Storage::Details::BindTransferContext(options.TransferHandle, options.Context);
+    const int64_t chunkSize = CreateForUpload(*this, blobSize, options, context);
+
+    auto uploadPageFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
+      unused(chunkId, numChunks);
+      UploadNonZeroPages(*this, buffer + offset, offset, length, context);
+    };
+    Storage::Details::ConcurrentTransfer(
+        0, blobSize, chunkSize, options.Concurrency, uploadPageFunc, options.TransferHandle);
+
+    return MakePagesWrittenResult<Models::UploadPageBlobFromResult>(*this, context);
+  }
+
+  Azure::Core::Response<Models::UploadPageBlobFromResult> PageBlobClient::UploadFrom(
+      const std::string& fileName,
+      const UploadPageBlobFromOptions& options) const
+  {
+    Storage::Details::FileReader fileReader(fileName);
+    const int64_t blobSize = fileReader.GetFileSize();
+    auto context = Storage::Details::BindTransferContext(options.TransferHandle, options.Context);
+    const int64_t chunkSize = CreateForUpload(*this, blobSize, options, context);
+
+    auto uploadPageFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
+      unused(chunkId, numChunks);
+      // Chunks that lie in a hole of a sparse file aren't read at all. The parts of a hole within
+      // a chunk read as zeros.
+      if (fileReader.SeekData(offset) >= offset + length)
+      {
+        return;
+      }
+      auto buffer = Storage::Details::BufferPool::GetTransferBufferPool().Acquire(
+          static_cast<std::size_t>(length));
+      Azure::Core::Http::FileBodyStream fileStream(fileReader.GetHandle(), offset, length);
+      if (Azure::Core::Http::BodyStream::ReadToCount(context, fileStream, buffer.Data(), length)
+          != length)
+      {
+        throw std::runtime_error("error when reading file");
+      }
+      UploadNonZeroPages(*this, buffer.Data(), offset, length, context);
+    };
+    Storage::Details::ConcurrentTransfer(
+        0, blobSize, chunkSize, options.Concurrency, uploadPageFunc, options.TransferHandle);
+
+    return MakePagesWrittenResult<Models::UploadPageBlobFromResult>(*this, context);
+  }
+
+  Azure::Core::Response<Models::DownloadBlobToResult> PageBlobClient::DownloadPagesTo(
+      const std::string& fileName,
+      const DownloadPageBlobToOptions& options) const
+  {
+    const int64_t chunkSize = GetDownloadPagesChunkSize(options.ChunkSize);
+
+    GetBlobPropertiesOptions propertiesOptions;
+    propertiesOptions.Context = options.Context;
+    propertiesOptions.AccessConditions = options.AccessConditions;
+    auto properties = GetProperties(propertiesOptions);
+
+    // The page ranges and their content are pinned to the version of the blob that was measured.
+    GetPageBlobPageRangesOptions pageRangesOptions;
+    pageRangesOptions.Context = options.Context;
+    pageRangesOptions.AccessConditions = options.AccessConditions;
+    pageRangesOptions.AccessConditions.IfMatch = properties->ETag;
+    auto pageRanges = GetPageRanges(pageRangesOptions);
+
+    Storage::Details::FileWriter fileWriter(fileName);
+    fileWriter.SetSparse();
+    fileWriter.Truncate(properties->ContentLength);
+
+    BlobAccessConditions chunkAccessConditions = options.AccessConditions;
+    chunkAccessConditions.IfMatch = properties->ETag;
+    DownloadPageRanges(
+        *this,
+        pageRanges->PageRanges,
+        chunkSize,
+        options.Concurrency,
+        chunkAccessConditions,
+        fileWriter,
+        options.Context);
+
+    return Azure::Core::Response<Models::DownloadBlobToResult>(
+        MakeDownloadBlobToResult(*properties),
+        std::make_unique<Azure::Core::Http::RawResponse>(
+            std::move(properties.GetRawResponse())));
+  }
+
+  Azure::Core::Response<Models::DownloadBlobToResult> PageBlobClient::SyncFromSnapshotDiff(
+      const std::string& fileName,
+      const std::string& baseSnapshot,
+      const std::string& newSnapshot,
+      const SyncPageBlobFromSnapshotDiffOptions& options) const
+  {
+    const int64_t chunkSize = GetDownloadPagesChunkSize(options.ChunkSize);
+
+    // Snapshots can't change, so unlike DownloadPagesTo no conditions are needed to pin them.
+    auto snapshotClient = WithSnapshot(newSnapshot);
+    GetBlobPropertiesOptions propertiesOptions;
+    propertiesOptions.Context = options.Context;
+    auto properties = snapshotClient.GetProperties(propertiesOptions);
+    const int64_t blobSize = properties->ContentLength;
+
+    GetPageBlobPageRangesOptions pageRangesOptions;
+    pageRangesOptions.Context = options.Context;
+    pageRangesOptions.PreviousSnapshot = baseSnapshot;
+    auto pageRanges = snapshotClient.GetPageRanges(pageRangesOptions);
+
+    Storage::Details::FileWriter fileWriter(fileName, false);
+    // Pages past the end of a shrunk blob are cut off, pages of a grown blob read as zeros until
+    // the diff fills them in.
+    fileWriter.Truncate(blobSize);
+    for (const auto& clearRange : pageRanges->ClearRanges)
+    {
+      const int64_t length = std::min(clearRange.Length, blobSize - clearRange.Offset);
+      if (length > 0)
+      {
+        fileWriter.ZeroRange(clearRange.Offset, length);
+      }
+    }
+    DownloadPageRanges(
+        snapshotClient,
+        pageRanges->PageRanges,
+        chunkSize,
+        options.Concurrency,
+        BlobAccessConditions(),
+        fileWriter,
+        options.Context);
+
+    return Azure::Core::Response<Models::DownloadBlobToResult>(
+        MakeDownloadBlobToResult(*properties),
+        std::make_unique<Azure::Core::Http::RawResponse>(
+            std::move(properties.GetRawResponse())));
+  }
+
+  Azure::Core::Response<Models::UploadPageBlobFromResult> PageBlobClient::SyncFromFileDiff(
+      const std::string& fileName,
+      const std::string& baseFileName,
+      const SyncPageBlobFromFileDiffOptions& options) const
+  {
+    Storage::Details::FileReader fileReader(fileName);
+    Storage::Details::FileReader baseFileReader(baseFileName);
+    const int64_t blobSize = fileReader.GetFileSize();
+    const int64_t baseSize = baseFileReader.GetFileSize();
+    if (blobSize % c_pageSize != 0)
+    {
+      throw std::runtime_error("page blob size must be a multiple of 512");
+    }
+    const int64_t chunkSize = GetUploadPagesChunkSize(options.ChunkSize);
+
+    if (blobSize != baseSize)
+    {
+      ResizePageBlobOptions resizeOptions;
+      resizeOptions.Context = options.Context;
+      Resize(blobSize, resizeOptions);
+    }
+
+    auto syncChunkFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
+      unused(chunkId, numChunks);
+      // Past its end, the base reads as zeros, like the pages a grown blob gains.
+      const int64_t baseLength = std::max<int64_t>(std::min(length, baseSize - offset), 0);
+      const bool hasData = fileReader.SeekData(offset) < offset + length;
+      const bool baseHasData
+          = baseLength > 0 && baseFileReader.SeekData(offset) < offset + baseLength;
+      if (!hasData && !baseHasData)
+      {
+        return;
+      }
+
+      auto readChunk = [&](const Storage::Details::FileReader& reader,
+                           uint8_t* buffer,
+                           int64_t readLength) {
+        Azure::Core::Http::FileBodyStream fileStream(reader.GetHandle(), offset, readLength);
+        if (Azure::Core::Http::BodyStream::ReadToCount(
+                options.Context, fileStream, buffer, readLength)
+            != readLength)
+        {
+          throw std::runtime_error("error when reading file");
+        }
+      };
+      auto buffer = Storage::Details::BufferPool::GetTransferBufferPool().Acquire(
+          static_cast<std::size_t>(length));
+      auto baseBuffer = Storage::Details::BufferPool::GetTransferBufferPool().Acquire(
+          static_cast<std::size_t>(length));
+      readChunk(fileReader, buffer.Data(), length);
+      readChunk(baseFileReader, baseBuffer.Data(), baseLength);
+      std::fill(
+          baseBuffer.Data() + baseLength, baseBuffer.Data() + length, static_cast<uint8_t>(0));
+
+      // Runs of changed pages become one request each, UploadPages for pages with data and
+      // ClearPages for pages that became zeros.
+      int64_t runStart = -1;
+      bool runIsZero = false;
+      auto flushRun = [&](int64_t runEnd) {
+        if (runStart < 0)
+        {
+          return;
+        }
+        if (runIsZero)
+        {
+          ClearPageBlobPagesOptions clearPagesOptions;
+          clearPagesOptions.Context = options.Context;
+          ClearPages(offset + runStart, runEnd - runStart, clearPagesOptions);
+        }
+        else
+        {
+          Azure::Core::Http::MemoryBodyStream pageStream(
+              buffer.Data() + runStart, static_cast<std::size_t>(runEnd - runStart));
+          UploadPageBlobPagesOptions uploadPagesOptions;
+          uploadPagesOptions.Context = options.Context;
+          UploadPages(offset + runStart, &pageStream, uploadPagesOptions);
+        }
+        runStart = -1;
+      };
+      for (int64_t position = 0; position < length; position += c_pageSize)
+      {
+        const uint8_t* page = buffer.Data() + position;
+        if (std::memcmp(page, baseBuffer.Data() + position, static_cast<std::size_t>(c_pageSize))
+            == 0)
+        {
+          flushRun(position);
+          continue;
+        }
+        const bool isZero
+            = Storage::Details::IsAllZeros(page, static_cast<std::size_t>(c_pageSize));
+        if (runStart >= 0 && isZero != runIsZero)
+        {
+          flushRun(position);
+        }
+        if (runStart < 0)
+        {
+          runStart = position;
+          runIsZero = isZero;
+        }
+      }
+      flushRun(length);
+    };
+    Storage::Details::ConcurrentTransfer(
+        0, blobSize, chunkSize, options.Concurrency, syncChunkFunc);
+
+    return MakePagesWrittenResult<Models::UploadPageBlobFromResult>(*this, options.Context);
+  }
+
   Azure::Core::Response<Models::ClearPageBlobPagesResult> PageBlobClient::ClearPages(
       int64_t offset,
       int64_t length,
@@ -3,6 +3,8 @@
 
 #include "append_blob_client_test.hpp"
 
+#include <future>
+
 namespace Azure { namespace Storage { namespace Test {
 
   std::shared_ptr<Azure::Storage::Blobs::AppendBlobClient> AppendBlobClientTest::m_appendBlobClient;
@@ -330,4 +332,85 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_TRUE(getPropertiesResult->IsSealed.GetValue());
   }
 
+  TEST_F(AppendBlobClientTest, AppendBlobWriter)
+  {
+    auto appendBlobClient = Azure::Storage::Blobs::AppendBlobClient::CreateFromConnectionString(
+        StandardStorageConnectionString(), m_containerName, RandomString());
+    appendBlobClient.Create();
+    auto blockContent
+        = Azure::Core::Http::MemoryBodyStream(m_blobContent.data(), m_blobContent.size());
+    appendBlobClient.AppendBlock(&blockContent);
+
+    // Every record is the ID of its thread followed by its sequence number in the thread.
+    constexpr int numThreads = 8;
+    constexpr int numRecords = 500;
+    constexpr std::size_t recordSize = 100;
+    {
+      Blobs::AppendBlobWriterOptions options;
+      options.MaxBlockSize = 64_KB;
+      Blobs::AppendBlobWriter writer(appendBlobClient, options);
+      std::vector<std::future<void>> futures;
+      for (int i = 0; i < numThreads; ++i)
+      {
+        futures.emplace_back(std::async(std::launch::async, [&writer, i]() {
+          for (int j = 0; j < numRecords; ++j)
+          {
+            std::vector<uint8_t> record(recordSize);
+            record[0] = static_cast<uint8_t>(i);
+            record[1] = static_cast<uint8_t>(j >> 8);
+            record[2] = static_cast<uint8_t>(j);
+            writer.Write(record.data(), record.size());
+          }
+        }));
+      }
+      for (auto& f : futures)
+      {
+        f.get();
+      }
+      writer.Flush().get();
+      EXPECT_EQ(
+          appendBlobClient.GetProperties()->ContentLength,
+          static_cast<int64_t>(m_blobContent.size() + numThreads * numRecords * recordSize));
+
+      writer.Write(m_blobContent.data(), m_blobContent.size());
+      writer.Close();
+      EXPECT_THROW(writer.Write(m_blobContent.data(), 1), std::runtime_error);
+    }
+
+    auto content = ReadBodyStream(appendBlobClient.Download()->BodyStream);
+    ASSERT_EQ(content.size(), m_blobContent.size() * 2 + numThreads * numRecords * recordSize);
+    EXPECT_EQ(
+        std::vector<uint8_t>(content.begin(), content.begin() + m_blobContent.size()),
+        m_blobContent);
+    EXPECT_EQ(
+        std::vector<uint8_t>(content.end() - m_blobContent.size(), content.end()), m_blobContent);
+    std::vector<int> nextRecord(numThreads);
+    for (std::size_t offset = m_blobContent.size(); offset + m_blobContent.size() < content.size();
+         offset += recordSize)
+    {
+      const int thread = content[offset];
+      ASSERT_LT(thread, numThreads);
+      EXPECT_EQ((content[offset + 1] << 8) | content[offset + 2], nextRecord[thread]);
+      ++nextRecord[thread];
+    }
+    EXPECT_EQ(nextRecord, std::vector<int>(numThreads, numRecords));
+    // Records were grouped into few blocks.
+    EXPECT_LT(
+        appendBlobClient.GetProperties()->CommittedBlockCount.GetValue(),
+        numThreads * numRecords / 10);
+
+    // Another writer appending at the same time makes the AppendPosition condition fail.
+    {
+      Blobs::AppendBlobWriter writer(appendBlobClient);
+      writer.Write(m_blobContent.data(), m_blobContent.size());
+      writer.Flush().get();
+      blockContent.Rewind();
+      appendBlobClient.AppendBlock(&blockContent);
+      writer.Write(m_blobContent.data(), m_blobContent.size());
+      auto flushResult = writer.Flush();
+      EXPECT_THROW(flushResult.get(), StorageException);
+      EXPECT_THROW(writer.Close(), StorageException);
+    }
+  }
+
 }}} // namespace Azure::Storage::Test
@@ -201,6 +201,24 @@ namespace Azure { namespace Storage { namespace Test {
       }
     } while (!options.ContinuationToken.GetValue().empty());
     EXPECT_TRUE(std::includes(listBlobs.begin(), listBlobs.end(), p1Blobs.begin(), p1Blobs.end()));
+
+    Azure::Storage::Blobs::ListBlobsSegmentOptions streamingOptions;
+    streamingOptions.Prefix = prefix1;
+    streamingOptions.MaxResults = 4;
+    std::set<std::string> streamedBlobs;
+    do
+    {
+      auto res = m_blobContainerClient->ListBlobsFlatSegment(
+          [&](Blobs::Models::BlobItem blob) {
+            EXPECT_FALSE(blob.ETag.empty());
+            streamedBlobs.insert(std::move(blob.Name));
+          },
+          streamingOptions);
+      EXPECT_EQ(res->Container, m_containerName);
+      EXPECT_TRUE(res->Items.empty());
+      streamingOptions.ContinuationToken = res->ContinuationToken;
+    } while (!streamingOptions.ContinuationToken.GetValue().empty());
+    EXPECT_EQ(streamedBlobs, listBlobs);
   }
 
   TEST_F(BlobContainerClientTest, DISABLED_ListBlobsHierarchy)
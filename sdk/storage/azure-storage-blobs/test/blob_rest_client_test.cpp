@@ -0,0 +1,272 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/blobs/protocol/blob_rest_client.hpp"
+#include "test_base.hpp"
+
+#include <chrono>
+#include <iostream>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(BlobRestClientTest, ListBlobsStreaming)
+  {
+    class ListBlobsResponsePolicy : public Core::Http::HttpPolicy {
+    public:
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<ListBlobsResponsePolicy>();
+      }
+
+      std::unique_ptr<Core::Http::RawResponse> Send(
+          Core::Context const&,
+          Core::Http::Request& request,
+          Core::Http::NextHttpPolicy) const override
+      {
+        static const std::string body
+            = "<?xml version=\"1.0\" encoding=\"utf-8\"?><EnumerationResults "
+              "ServiceEndpoint=\"https://a.blob.core.windows.net/\" ContainerName=\"c\">"
+              "<Delimiter>/</Delimiter><Blobs>"
+              "<Blob><Name>b1</Name><Properties><Etag>0x1</Etag>"
+              "<BlobType>BlockBlob</BlobType></Properties></Blob>"
+              "<BlobPrefix><Name>d/</Name></BlobPrefix>"
+              "<Blob><Name>b2</Name><VersionId>v</VersionId><Properties><Etag>0x2</Etag>"
+              "<BlobType>AppendBlob</BlobType></Properties></Blob>"
+              "</Blobs><NextMarker>next</NextMarker></EnumerationResults>";
+        auto response = std::make_unique<Core::Http::RawResponse>(
+            1, 1, Core::Http::HttpStatusCode::Ok, "OK");
+        // Only streamed requests get the body as a stream.
+        if (request.IsDownloadViaStream())
+        {
+          response->SetBodyStream(std::make_unique<Core::Http::MemoryBodyStream>(
+              reinterpret_cast<const uint8_t*>(body.data()), body.length()));
+        }
+        else
+        {
+          response->SetBody(std::vector<uint8_t>(body.begin(), body.end()));
+        }
+        return response;
+      }
+    };
+
+    std::vector<std::unique_ptr<Core::Http::HttpPolicy>> policies;
+    policies.emplace_back(std::make_unique<ListBlobsResponsePolicy>());
+    Core::Http::HttpPipeline pipeline(policies);
+    const Core::Http::Url url("https://a.blob.core.windows.net/c");
+
+    Blobs::Details::BlobRestClient::Container::ListBlobsFlatSegmentOptions flatOptions;
+    auto buffered = Blobs::Details::BlobRestClient::Container::ListBlobsFlat(
+        Core::Context(), pipeline, url, flatOptions);
+    ASSERT_EQ(buffered->Items.size(), 2U);
+
+    std::vector<std::string> names;
+    flatOptions.OnItem = [&](Blobs::Models::BlobItem item) {
+      EXPECT_FALSE(item.ETag.empty());
+      names.push_back(item.Name);
+    };
+    auto streamed = Blobs::Details::BlobRestClient::Container::ListBlobsFlat(
+        Core::Context(), pipeline, url, flatOptions);
+    EXPECT_TRUE(streamed->Items.empty());
+    EXPECT_EQ(streamed->Container, "c");
+    EXPECT_EQ(streamed->ContinuationToken, "next");
+    EXPECT_EQ(names, (std::vector<std::string>{"b1", "b2"}));
+
+    names.clear();
+    std::vector<std::string> prefixes;
+    Blobs::Details::BlobRestClient::Container::ListBlobsByHierarchySegmentOptions
+        hierarchyOptions;
+    hierarchyOptions.OnItem = [&](Blobs::Models::BlobItem item) { names.push_back(item.Name); };
+    hierarchyOptions.OnBlobPrefix
+        = [&](Blobs::Models::BlobPrefix prefix) { prefixes.push_back(prefix.Name); };
+    auto hierarchy = Blobs::Details::BlobRestClient::Container::ListBlobsByHierarchy(
+        Core::Context(), pipeline, url, hierarchyOptions);
+    EXPECT_TRUE(hierarchy->Items.empty());
+    EXPECT_TRUE(hierarchy->BlobPrefixes.empty());
+    EXPECT_EQ(hierarchy->Delimiter, "/");
+    EXPECT_EQ(names, (std::vector<std::string>{"b1", "b2"}));
+    EXPECT_EQ(prefixes, (std::vector<std::string>{"d/"}));
+  }
+
+  namespace {
+    class CannedResponsePolicy : public Core::Http::HttpPolicy {
+    public:
+      CannedResponsePolicy(std::map<std::string, std::string> headers, std::string body)
+          : m_headers(std::move(headers)), m_body(std::move(body))
+      {
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<CannedResponsePolicy>(*this);
+      }
+
+      std::unique_ptr<Core::Http::RawResponse> Send(
+          Core::Context const&,
+          Core::Http::Request&,
+          Core::Http::NextHttpPolicy) const override
+      {
+        auto response = std::make_unique<Core::Http::RawResponse>(
+            1, 1, Core::Http::HttpStatusCode::Ok, "OK");
+        for (const auto& header : m_headers)
+        {
+          response->AddHeader(header.first, header.second);
+        }
+        response->SetBody(std::vector<uint8_t>(m_body.begin(), m_body.end()));
+        return response;
+      }
+
+    private:
+      std::map<std::string, std::string> m_headers;
+      std::string m_body;
+    };
+
+    std::map<std::string, std::string> MakeBlobPropertiesHeaders()
+    {
+      return {
+          {"etag", "\"0x8D8A1B2C3D4E5F6\""},
+          {"last-modified", "Thu, 03 Dec 2020 08:14:07 GMT"},
+          {"x-ms-creation-time", "Thu, 03 Dec 2020 08:14:07 GMT"},
+          {"x-ms-blob-type", "BlockBlob"},
+          {"content-length", "1048576"},
+          {"content-type", "application/octet-stream"},
+          {"content-md5", "md5"},
+          {"x-ms-blob-content-md5", "blob-md5"},
+          {"x-ms-lease-status", "unlocked"},
+          {"x-ms-lease-state", "available"},
+          {"x-ms-server-encrypted", "true"},
+          {"x-ms-access-tier", "Hot"},
+          {"x-ms-access-tier-inferred", "true"},
+          {"x-ms-meta-key1", "value1"},
+          {"x-ms-meta-key2", "value2"},
+          {"x-ms-or-policy1_rule1", "complete"},
+          {"x-ms-or-policy1_rule2", "failed"},
+          {"x-ms-tag-count", "3"},
+          {"x-ms-request-id", "00000000-0000-0000-0000-000000000000"},
+          {"x-ms-version", "2019-12-12"},
+          {"date", "Thu, 03 Dec 2020 08:14:07 GMT"},
+          {"server", "Windows-Azure-Blob/1.0 Microsoft-HTTPAPI/2.0"},
+          {"accept-ranges", "bytes"},
+      };
+    }
+
+    std::string MakeListBlobsBody(int numBlobs)
+    {
+      std::string body = "<?xml version=\"1.0\" encoding=\"utf-8\"?><EnumerationResults "
+                         "ServiceEndpoint=\"https://a.blob.core.windows.net/\" "
+                         "ContainerName=\"c\"><Blobs>";
+      for (int i = 0; i < numBlobs; ++i)
+      {
+        body += "<Blob><Name>dir/file-" + std::to_string(i)
+            + "</Name><Properties><Creation-Time>Thu, 03 Dec 2020 08:14:07 GMT</Creation-Time>"
+              "<Last-Modified>Thu, 03 Dec 2020 08:14:07 GMT</Last-Modified><Etag>0x8D8A1B2C3D4E5F6"
+              "</Etag><Content-Length>1024</Content-Length><Content-Type>application/octet-stream"
+              "</Content-Type><Content-Encoding /><Content-Language /><Content-CRC64 />"
+              "<Content-MD5>1B2M2Y8AsgTpgAmY7PhCfg==</Content-MD5><Cache-Control />"
+              "<Content-Disposition /><BlobType>BlockBlob</BlobType><AccessTier>Hot</AccessTier>"
+              "<AccessTierInferred>true</AccessTierInferred><LeaseStatus>unlocked</LeaseStatus>"
+              "<LeaseState>available</LeaseState><ServerEncrypted>true</ServerEncrypted>"
+              "</Properties><OrMetadata /></Blob>";
+      }
+      body += "</Blobs><NextMarker /></EnumerationResults>";
+      return body;
+    }
+  } // namespace
+
+  TEST(BlobRestClientTest, GetPropertiesHeaders)
+  {
+    std::vector<std::unique_ptr<Core::Http::HttpPolicy>> policies;
+    policies.emplace_back(
+        std::make_unique<CannedResponsePolicy>(MakeBlobPropertiesHeaders(), std::string()));
+    Core::Http::HttpPipeline pipeline(policies);
+
+    auto properties = Blobs::Details::BlobRestClient::Blob::GetProperties(
+        Core::Context(),
+        pipeline,
+        Core::Http::Url("https://a.blob.core.windows.net/c/b"),
+        Blobs::Details::BlobRestClient::Blob::GetBlobPropertiesOptions());
+    EXPECT_EQ(properties->ETag, "\"0x8D8A1B2C3D4E5F6\"");
+    EXPECT_EQ(properties->LastModified, "Thu, 03 Dec 2020 08:14:07 GMT");
+    EXPECT_EQ(properties->CreationTime, "Thu, 03 Dec 2020 08:14:07 GMT");
+    EXPECT_EQ(properties->BlobType, Blobs::Models::BlobType::BlockBlob);
+    EXPECT_EQ(properties->ContentLength, 1048576);
+    EXPECT_EQ(properties->HttpHeaders.ContentType, "application/octet-stream");
+    EXPECT_EQ(properties->HttpHeaders.ContentMd5, "blob-md5");
+    EXPECT_EQ(properties->LeaseState.GetValue(), Blobs::Models::BlobLeaseState::Available);
+    EXPECT_TRUE(properties->ServerEncrypted.GetValue());
+    EXPECT_EQ(properties->Tier.GetValue(), Blobs::Models::AccessTier::Hot);
+    EXPECT_TRUE(properties->AccessTierInferred.GetValue());
+    EXPECT_EQ(properties->Metadata.size(), 2U);
+    EXPECT_EQ(properties->Metadata.at("key2"), "value2");
+    ASSERT_EQ(properties->ObjectReplicationSourceProperties.size(), 1U);
+    EXPECT_EQ(properties->ObjectReplicationSourceProperties[0].PolicyId, "policy1");
+    EXPECT_EQ(properties->ObjectReplicationSourceProperties[0].Rules.size(), 2U);
+    EXPECT_EQ(properties->TagCount.GetValue(), 3);
+    EXPECT_FALSE(properties->ExpiryTime.HasValue());
+
+    for (const std::string requiredHeader :
+         {"etag", "last-modified", "x-ms-creation-time", "x-ms-blob-type", "content-length"})
+    {
+      auto headers = MakeBlobPropertiesHeaders();
+      headers.erase(requiredHeader);
+      policies.clear();
+      policies.emplace_back(std::make_unique<CannedResponsePolicy>(headers, std::string()));
+      Core::Http::HttpPipeline incompletePipeline(policies);
+      EXPECT_THROW(
+          Blobs::Details::BlobRestClient::Blob::GetProperties(
+              Core::Context(),
+              incompletePipeline,
+              Core::Http::Url("https://a.blob.core.windows.net/c/b"),
+              Blobs::Details::BlobRestClient::Blob::GetBlobPropertiesOptions()),
+          std::out_of_range);
+    }
+  }
+
+  TEST(BlobRestClientTest, DISABLED_ParseThroughput)
+  {
+    constexpr int numIterations = 20000;
+    std::vector<std::unique_ptr<Core::Http::HttpPolicy>> policies;
+    policies.emplace_back(
+        std::make_unique<CannedResponsePolicy>(MakeBlobPropertiesHeaders(), std::string()));
+    Core::Http::HttpPipeline propertiesPipeline(policies);
+    const Core::Http::Url url("https://a.blob.core.windows.net/c/b");
+
+    auto timer_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numIterations; ++i)
+    {
+      Blobs::Details::BlobRestClient::Blob::GetProperties(
+          Core::Context(),
+          propertiesPipeline,
+          url,
+          Blobs::Details::BlobRestClient::Blob::GetBlobPropertiesOptions());
+    }
+    auto timer_end = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_end - timer_start);
+    std::cout << "GetProperties response parsed in: " << elapsed.count() / numIterations << "ns"
+              << std::endl;
+
+    policies.clear();
+    policies.emplace_back(
+        std::make_unique<CannedResponsePolicy>(
+            std::map<std::string, std::string>(), MakeListBlobsBody(5000)));
+    Core::Http::HttpPipeline listPipeline(policies);
+    constexpr int numListIterations = 20;
+    timer_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numListIterations; ++i)
+    {
+      auto result = Blobs::Details::BlobRestClient::Container::ListBlobsFlat(
+          Core::Context(),
+          listPipeline,
+          url,
+          Blobs::Details::BlobRestClient::Container::ListBlobsFlatSegmentOptions());
+      EXPECT_EQ(result->Items.size(), 5000U);
+    }
+    timer_end = std::chrono::steady_clock::now();
+    elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_end - timer_start);
+    std::cout << "ListBlobs response of 5000 blobs parsed in: "
+              << elapsed.count() / numListIterations / 1000 << "us" << std::endl;
+  }
+
+}}} // namespace Azure::Storage::Test
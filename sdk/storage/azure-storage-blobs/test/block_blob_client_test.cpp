@@ -5,9 +5,12 @@
 
 #include "azure/storage/common/crypt.hpp"
 #include "azure/storage/common/file_io.hpp"
+#include "azure/storage/common/transfer_journal.hpp"
 
+#include <fstream>
 #include <future>
 #include <random>
+#include <set>
 #include <vector>
 
 namespace Azure { namespace Storage { namespace Blobs { namespace Models {
@@ -312,6 +315,26 @@ namespace Azure { namespace Storage { namespace Test {
     EXPECT_TRUE(res->UncommittedBlocks.empty());
   }
 
+  TEST_F(BlockBlobClientTest, CopyFrom)
+  {
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    Blobs::CopyBlockBlobFromOptions options;
+    options.ChunkSize = 1_MB + 5;
+    options.Concurrency = 3;
+    auto res = blockBlobClient.CopyFrom(m_blockBlobClient->GetUri() + GetSas(), options);
+    EXPECT_FALSE(res->ETag.empty());
+    auto properties = *blockBlobClient.GetProperties();
+    EXPECT_EQ(properties.ETag, res->ETag);
+    EXPECT_EQ(properties.ContentLength, static_cast<int64_t>(m_blobContent.size()));
+    EXPECT_EQ(properties.HttpHeaders, m_blobUploadOptions.HttpHeaders);
+    EXPECT_EQ(properties.Metadata, m_blobUploadOptions.Metadata);
+    EXPECT_EQ(ReadBodyStream(blockBlobClient.Download()->BodyStream), m_blobContent);
+
+    options.Metadata = std::map<std::string, std::string>{{"key", "value"}};
+    blockBlobClient.CopyFrom(m_blockBlobClient->GetUri() + GetSas(), options);
+    EXPECT_EQ(blockBlobClient.GetProperties()->Metadata, options.Metadata.GetValue());
+  }
+
   TEST_F(BlockBlobClientTest, ConcurrentDownload)
   {
     auto testDownloadToBuffer = [](int concurrency,
@@ -509,6 +532,40 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(BlockBlobClientTest, ParallelDownload)
+  {
+    auto testParallelDownload = [](int concurrency,
+                                   Azure::Core::Nullable<int64_t> offset,
+                                   Azure::Core::Nullable<int64_t> length) {
+      const int64_t blobSize = static_cast<int64_t>(m_blobContent.size());
+      int64_t begin = offset.HasValue() ? offset.GetValue() : 0;
+      int64_t end = length.HasValue() ? std::min(begin + length.GetValue(), blobSize) : blobSize;
+
+      Azure::Storage::Blobs::ParallelDownloadBlobOptions options;
+      options.Offset = offset;
+      options.Length = length;
+      options.ChunkSize = 512_KB;
+      options.Concurrency = concurrency;
+      auto res = m_blockBlobClient->ParallelDownload(options);
+      EXPECT_EQ(res->BodyStream->Length(), end - begin);
+      EXPECT_EQ(res->Metadata, m_blobUploadOptions.Metadata);
+      auto downloadContent = ReadBodyStream(res->BodyStream);
+      EXPECT_EQ(
+          downloadContent,
+          std::vector<uint8_t>(
+              m_blobContent.begin() + static_cast<std::ptrdiff_t>(begin),
+              m_blobContent.begin() + static_cast<std::ptrdiff_t>(end)));
+    };
+
+    for (int c : {1, 4})
+    {
+      testParallelDownload(c, {}, {});
+      testParallelDownload(c, 1, {});
+      testParallelDownload(c, 1_MB + 7, 3_MB);
+      testParallelDownload(c, 0, 100);
+    }
+  }
+
   TEST_F(BlockBlobClientTest, ConcurrentUploadFromNonExistingFile)
   {
     auto blockBlobClient = Azure::Storage::Blobs::BlockBlobClient::CreateFromConnectionString(
@@ -721,6 +778,30 @@ namespace Azure { namespace Storage { namespace Test {
       DeleteFile(tempFilename);
     };
 
+    auto testUploadFromStream = [&](int concurrency, int64_t blobSize) {
+      auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+
+      Azure::Storage::Blobs::UploadBlockBlobFromOptions options;
+      options.ChunkSize = 1_MB;
+      options.Concurrency = concurrency;
+      options.Metadata = m_blobUploadOptions.Metadata;
+
+      Azure::Core::Http::MemoryBodyStream contentStream(
+          blobContent.data(), static_cast<std::size_t>(blobSize));
+      auto res = blockBlobClient.UploadFrom(contentStream, options);
+      EXPECT_FALSE(res->ETag.empty());
+      auto properties = *blockBlobClient.GetProperties();
+      EXPECT_EQ(properties.ContentLength, blobSize);
+      EXPECT_EQ(properties.Metadata, options.Metadata);
+      EXPECT_EQ(properties.ETag, res->ETag);
+      std::vector<uint8_t> downloadContent(static_cast<std::size_t>(blobSize), '\x00');
+      blockBlobClient.DownloadTo(downloadContent.data(), static_cast<std::size_t>(blobSize));
+      EXPECT_EQ(
+          downloadContent,
+          std::vector<uint8_t>(
+              blobContent.begin(), blobContent.begin() + static_cast<std::size_t>(blobSize)));
+    };
+
     std::vector<std::future<void>> futures;
     for (int c : {1, 2, 5})
     {
@@ -730,6 +811,7 @@ namespace Azure { namespace Storage { namespace Test {
         ASSERT_GE(blobContent.size(), static_cast<std::size_t>(l));
         futures.emplace_back(std::async(std::launch::async, testUploadFromBuffer, c, l));
         futures.emplace_back(std::async(std::launch::async, testUploadFromFile, c, l));
+        futures.emplace_back(std::async(std::launch::async, testUploadFromStream, c, l));
       }
     }
     for (auto& f : futures)
@@ -738,6 +820,210 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(BlockBlobClientTest, ConcurrentTransactionalCrc64)
+  {
+    std::vector<uint8_t> blobContent = RandomBuffer(static_cast<std::size_t>(10_MB));
+
+    for (int64_t blobSize : {0ULL, 1ULL, 1_MB, 3_MB + 5, 10_MB})
+    {
+      const std::string expectedCrc64
+          = Base64Encode(Crc64::Hash(blobContent.data(), static_cast<std::size_t>(blobSize)));
+      auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+
+      Azure::Storage::Blobs::UploadBlockBlobFromOptions uploadOptions;
+      uploadOptions.ChunkSize = 1_MB;
+      uploadOptions.Concurrency = 4;
+      uploadOptions.UseTransactionalCrc64 = true;
+      auto uploadResult = blockBlobClient.UploadFrom(
+          blobContent.data(), static_cast<std::size_t>(blobSize), uploadOptions);
+      EXPECT_EQ(uploadResult->TransactionalContentCrc64.GetValue(), expectedCrc64);
+
+      std::string tempFilename = RandomString();
+      {
+        Azure::Storage::Details::FileWriter fileWriter(tempFilename);
+        fileWriter.Write(blobContent.data(), blobSize, 0);
+      }
+      uploadResult = blockBlobClient.UploadFrom(tempFilename, uploadOptions);
+      EXPECT_EQ(uploadResult->TransactionalContentCrc64.GetValue(), expectedCrc64);
+
+      Azure::Core::Http::MemoryBodyStream contentStream(
+          blobContent.data(), static_cast<std::size_t>(blobSize));
+      uploadResult = blockBlobClient.UploadFrom(contentStream, uploadOptions);
+      EXPECT_EQ(uploadResult->TransactionalContentCrc64.GetValue(), expectedCrc64);
+
+      Azure::Storage::Blobs::DownloadBlobToOptions downloadOptions;
+      downloadOptions.InitialChunkSize = 8_MB;
+      downloadOptions.ChunkSize = 1_MB;
+      downloadOptions.Concurrency = 4;
+      downloadOptions.UseTransactionalCrc64 = true;
+      std::vector<uint8_t> downloadContent(static_cast<std::size_t>(blobSize));
+      auto downloadResult = blockBlobClient.DownloadTo(
+          downloadContent.data(), downloadContent.size(), downloadOptions);
+      EXPECT_EQ(downloadResult->TransactionalContentCrc64.GetValue(), expectedCrc64);
+      EXPECT_EQ(
+          downloadContent,
+          std::vector<uint8_t>(
+              blobContent.begin(), blobContent.begin() + static_cast<std::size_t>(blobSize)));
+
+      downloadResult = blockBlobClient.DownloadTo(tempFilename, downloadOptions);
+      EXPECT_EQ(downloadResult->TransactionalContentCrc64.GetValue(), expectedCrc64);
+      DeleteFile(tempFilename);
+    }
+  }
+
+  TEST_F(BlockBlobClientTest, CheckpointedTransfer)
+  {
+    std::vector<uint8_t> blobContent = RandomBuffer(static_cast<std::size_t>(5_MB + 7));
+    const std::string expectedCrc64
+        = Base64Encode(Crc64::Hash(blobContent.data(), blobContent.size()));
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    const std::string checkpointFilename = RandomString();
+    std::string tempFilename = RandomString();
+    {
+      Azure::Storage::Details::FileWriter fileWriter(tempFilename);
+      fileWriter.Write(blobContent.data(), static_cast<int64_t>(blobContent.size()), 0);
+    }
+
+    // Blocks 1 and 3 were staged before the upload was interrupted, block 4 was recorded but is
+    // no longer staged.
+    {
+      Azure::Storage::Details::TransferJournal journal(
+          checkpointFilename,
+          blockBlobClient.GetUri() + " "
+              + std::to_string(
+                  Azure::Storage::Details::FileReader(tempFilename).GetLastWriteTime())
+              + " " + tempFilename,
+          static_cast<int64_t>(blobContent.size()),
+          1_MB);
+      for (int64_t i : {1, 3})
+      {
+        std::string blockId = std::to_string(i);
+        blockId = Base64Encode(std::string(64 - blockId.length(), '0') + blockId);
+        Azure::Core::Http::MemoryBodyStream blockStream(
+            blobContent.data() + i * 1_MB, static_cast<std::size_t>(1_MB));
+        blockBlobClient.StageBlock(blockId, &blockStream);
+        journal.SetChunkDone(i);
+      }
+      journal.SetChunkDone(4);
+    }
+    Azure::Storage::Blobs::UploadBlockBlobFromOptions uploadOptions;
+    uploadOptions.ChunkSize = 1_MB;
+    uploadOptions.Concurrency = 2;
+    uploadOptions.UseTransactionalCrc64 = true;
+    uploadOptions.CheckpointFileName = checkpointFilename;
+    auto uploadResult = blockBlobClient.UploadFrom(tempFilename, uploadOptions);
+    EXPECT_EQ(uploadResult->TransactionalContentCrc64.GetValue(), expectedCrc64);
+    EXPECT_FALSE(std::ifstream(checkpointFilename).good());
+
+    // Chunk 2 after the initial one was downloaded before the download was interrupted, the rest
+    // of the file holds garbage.
+    auto properties = *blockBlobClient.GetProperties();
+    {
+      Azure::Storage::Details::FileWriter fileWriter(tempFilename);
+      std::vector<uint8_t> garbage = RandomBuffer(blobContent.size());
+      fileWriter.Write(garbage.data(), static_cast<int64_t>(garbage.size()), 0);
+      fileWriter.Write(blobContent.data() + 3_MB, 1_MB, 3_MB);
+      Azure::Storage::Details::TransferJournal journal(
+          checkpointFilename,
+          properties.ETag + " 0 " + std::to_string(1_MB),
+          static_cast<int64_t>(blobContent.size()) - 1_MB,
+          1_MB);
+      journal.SetChunkDone(2);
+    }
+    Azure::Storage::Blobs::DownloadBlobToOptions downloadOptions;
+    downloadOptions.InitialChunkSize = 1_MB;
+    downloadOptions.ChunkSize = 1_MB;
+    downloadOptions.Concurrency = 2;
+    downloadOptions.UseTransactionalCrc64 = true;
+    downloadOptions.CheckpointFileName = checkpointFilename;
+    auto downloadResult = blockBlobClient.DownloadTo(tempFilename, downloadOptions);
+    EXPECT_EQ(downloadResult->TransactionalContentCrc64.GetValue(), expectedCrc64);
+    EXPECT_EQ(ReadFile(tempFilename), blobContent);
+    EXPECT_FALSE(std::ifstream(checkpointFilename).good());
+
+    // A checkpoint file of another version of the blob is started over.
+    {
+      Azure::Storage::Details::TransferJournal journal(
+          checkpointFilename,
+          "\"0x0\" 0 " + std::to_string(1_MB),
+          static_cast<int64_t>(blobContent.size()) - 1_MB,
+          1_MB);
+      journal.SetChunkDone(0);
+    }
+    {
+      Azure::Storage::Details::FileWriter fileWriter(tempFilename);
+    }
+    downloadResult = blockBlobClient.DownloadTo(tempFilename, downloadOptions);
+    EXPECT_EQ(ReadFile(tempFilename), blobContent);
+
+    // So is a checkpoint file whose destination file no longer reaches its recorded chunks.
+    {
+      Azure::Storage::Details::TransferJournal journal(
+          checkpointFilename,
+          properties.ETag + " 0 " + std::to_string(1_MB),
+          static_cast<int64_t>(blobContent.size()) - 1_MB,
+          1_MB);
+      journal.SetChunkDone(2);
+    }
+    {
+      Azure::Storage::Details::FileWriter fileWriter(tempFilename);
+      std::vector<uint8_t> garbage = RandomBuffer(static_cast<std::size_t>(2_MB));
+      fileWriter.Write(garbage.data(), static_cast<int64_t>(garbage.size()), 0);
+    }
+    downloadResult = blockBlobClient.DownloadTo(tempFilename, downloadOptions);
+    EXPECT_EQ(ReadFile(tempFilename), blobContent);
+    DeleteFile(tempFilename);
+  }
+
+  TEST_F(BlockBlobClientTest, IncrementalUpload)
+  {
+    std::vector<uint8_t> blobContent = RandomBuffer(static_cast<std::size_t>(4_MB));
+    auto blockBlobClient = m_blobContainerClient->GetBlockBlobClient(RandomString());
+    std::string tempFilename = RandomString();
+    auto writeFile = [&]() {
+      Azure::Storage::Details::FileWriter fileWriter(tempFilename);
+      fileWriter.Write(blobContent.data(), static_cast<int64_t>(blobContent.size()), 0);
+    };
+
+    for (bool contentDefinedChunking : {false, true})
+    {
+      Azure::Storage::Blobs::UploadBlockBlobFromOptions options;
+      options.ChunkSize = 256_KB;
+      options.Concurrency = 4;
+      options.IncrementalUpload = true;
+      options.UseContentDefinedChunking = contentDefinedChunking;
+      options.UseTransactionalCrc64 = true;
+      writeFile();
+      blockBlobClient.UploadFrom(tempFilename, options);
+      auto blockList = *blockBlobClient.GetBlockList();
+      EXPECT_TRUE(blockList.UncommittedBlocks.empty());
+
+      blobContent.insert(blobContent.begin() + static_cast<std::ptrdiff_t>(1_MB), 100, 'x');
+      writeFile();
+      auto uploadResult = blockBlobClient.UploadFrom(tempFilename, options);
+      EXPECT_EQ(
+          uploadResult->TransactionalContentCrc64.GetValue(),
+          Base64Encode(Crc64::Hash(blobContent.data(), blobContent.size())));
+      EXPECT_EQ(ReadBodyStream(blockBlobClient.Download()->BodyStream), blobContent);
+
+      // The blocks before the edit are reused, and with content-defined chunking most of the
+      // blocks after it too.
+      std::set<std::string> oldBlocks;
+      for (const auto& block : blockList.CommittedBlocks)
+      {
+        oldBlocks.insert(block.Name);
+      }
+      std::size_t numReused = 0;
+      auto newBlockList = *blockBlobClient.GetBlockList();
+      for (const auto& block : newBlockList.CommittedBlocks)
+      {
+        numReused += oldBlocks.count(block.Name);
+      }
+      EXPECT_GE(numReused, contentDefinedChunking ? newBlockList.CommittedBlocks.size() - 3 : 4);
+    }
+    DeleteFile(tempFilename);
+  }
+
   TEST_F(BlockBlobClientTest, DownloadError)
   {
     auto blockBlobClient = Azure::Storage::Blobs::BlockBlobClient::CreateFromConnectionString(
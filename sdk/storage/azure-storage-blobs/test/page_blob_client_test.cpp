@@ -140,6 +140,131 @@ namespace Azure { namespace Storage { namespace Test {
         0, m_pageBlobClient->GetUri() + GetSas(), 0, m_blobContent.size());
   }
 
+  TEST_F(PageBlobClientTest, CopyFrom)
+  {
+    auto pageBlobClient = m_blobContainerClient->GetPageBlobClient(RandomString());
+    Blobs::CopyPageBlobFromOptions options;
+    options.ChunkSize = 512;
+    auto res = pageBlobClient.CopyFrom(m_pageBlobClient->GetUri() + GetSas(), options);
+    EXPECT_FALSE(res->ETag.empty());
+    EXPECT_EQ(res->ContentLength, static_cast<int64_t>(m_blobContent.size()));
+    auto properties = *pageBlobClient.GetProperties();
+    EXPECT_EQ(properties.ETag, res->ETag);
+    EXPECT_EQ(properties.Metadata, m_blobUploadOptions.Metadata);
+    EXPECT_EQ(ReadBodyStream(pageBlobClient.Download()->BodyStream), m_blobContent);
+
+    // An invalid chunk size is rejected before the destination is replaced.
+    options.ChunkSize = 1000;
+    EXPECT_THROW(
+        pageBlobClient.CopyFrom(m_pageBlobClient->GetUri() + GetSas(), options),
+        std::runtime_error);
+    EXPECT_EQ(pageBlobClient.GetProperties()->ETag, properties.ETag);
+  }
+
+  TEST_F(PageBlobClientTest, SparseUploadDownload)
+  {
+    std::vector<uint8_t> blobContent(static_cast<std::size_t>(8_MB));
+    auto randomContent = RandomBuffer(static_cast<std::size_t>(1_MB));
+    std::copy(randomContent.begin(), randomContent.end(), blobContent.begin() + 100);
+    std::copy(randomContent.begin(), randomContent.end(), blobContent.begin() + 6_MB);
+
+    auto pageBlobClient = m_blobContainerClient->GetPageBlobClient(RandomString());
+    Blobs::UploadPageBlobFromOptions options;
+    options.ChunkSize = 1_MB;
+    options.Concurrency = 4;
+    options.Metadata = m_blobUploadOptions.Metadata;
+    auto res = pageBlobClient.UploadFrom(blobContent.data(), blobContent.size(), options);
+    EXPECT_EQ(res->ContentLength, static_cast<int64_t>(blobContent.size()));
+    // The pages that are all zeros aren't written.
+    auto pageRanges = *pageBlobClient.GetPageRanges();
+    int64_t populatedSize = 0;
+    for (const auto& pageRange : pageRanges.PageRanges)
+    {
+      populatedSize += pageRange.Length;
+    }
+    EXPECT_EQ(populatedSize, 2_MB + 512);
+    EXPECT_EQ(ReadBodyStream(pageBlobClient.Download()->BodyStream), blobContent);
+
+    std::string tempFilename = RandomString();
+    Blobs::DownloadPageBlobToOptions downloadOptions;
+    downloadOptions.ChunkSize = 512_KB;
+    auto downloadResult = pageBlobClient.DownloadPagesTo(tempFilename, downloadOptions);
+    EXPECT_EQ(downloadResult->ContentLength, static_cast<int64_t>(blobContent.size()));
+    EXPECT_EQ(downloadResult->Metadata, m_blobUploadOptions.Metadata);
+    EXPECT_EQ(ReadFile(tempFilename), blobContent);
+    downloadOptions.ChunkSize = 0;
+    EXPECT_THROW(pageBlobClient.DownloadPagesTo(tempFilename, downloadOptions), std::runtime_error);
+
+    pageBlobClient.UploadFrom(tempFilename, options);
+    EXPECT_EQ(ReadBodyStream(pageBlobClient.Download()->BodyStream), blobContent);
+
+    // Chunks are uploaded with single requests, so they must be whole pages of at most 4 MB.
+    for (int64_t chunkSize : {int64_t(1_MB + 100), int64_t(8_MB), int64_t(0)})
+    {
+      options.ChunkSize = chunkSize;
+      EXPECT_THROW(pageBlobClient.UploadFrom(tempFilename, options), std::runtime_error);
+      EXPECT_THROW(
+          pageBlobClient.UploadFrom(blobContent.data(), blobContent.size(), options),
+          std::runtime_error);
+    }
+    DeleteFile(tempFilename);
+  }
+
+  TEST_F(PageBlobClientTest, SyncDiff)
+  {
+    std::vector<uint8_t> blobContent(static_cast<std::size_t>(4_MB));
+    auto randomContent = RandomBuffer(static_cast<std::size_t>(3_MB));
+    std::copy(randomContent.begin(), randomContent.end(), blobContent.begin());
+
+    auto pageBlobClient = m_blobContainerClient->GetPageBlobClient(RandomString());
+    pageBlobClient.UploadFrom(blobContent.data(), blobContent.size());
+    auto baseSnapshot = pageBlobClient.CreateSnapshot()->Snapshot;
+    std::string baseFilename = RandomString();
+    pageBlobClient.WithSnapshot(baseSnapshot).DownloadPagesTo(baseFilename);
+
+    // Changes some pages, clears others and grows the blob.
+    auto changedContent = RandomBuffer(static_cast<std::size_t>(4_KB));
+    std::copy(changedContent.begin(), changedContent.end(), blobContent.begin() + 1_MB);
+    auto pageContent
+        = Azure::Core::Http::MemoryBodyStream(changedContent.data(), changedContent.size());
+    pageBlobClient.UploadPages(1_MB, &pageContent);
+    std::fill(blobContent.begin() + 2_MB, blobContent.begin() + 2_MB + 8_KB, uint8_t(0));
+    pageBlobClient.ClearPages(2_MB, 8_KB);
+    blobContent.resize(static_cast<std::size_t>(5_MB));
+    pageBlobClient.Resize(5_MB);
+    std::copy(changedContent.begin(), changedContent.end(), blobContent.begin() + 4_MB + 512);
+    pageContent.Rewind();
+    pageBlobClient.UploadPages(4_MB + 512, &pageContent);
+    auto newSnapshot = pageBlobClient.CreateSnapshot()->Snapshot;
+
+    std::string filename = RandomString();
+    pageBlobClient.WithSnapshot(baseSnapshot).DownloadPagesTo(filename);
+    auto syncResult = pageBlobClient.SyncFromSnapshotDiff(filename, baseSnapshot, newSnapshot);
+    EXPECT_EQ(syncResult->ContentLength, 5_MB);
+    EXPECT_EQ(ReadFile(filename), blobContent);
+    Blobs::SyncPageBlobFromSnapshotDiffOptions snapshotDiffOptions;
+    snapshotDiffOptions.ChunkSize = -1;
+    EXPECT_THROW(
+        pageBlobClient.SyncFromSnapshotDiff(
+            filename, baseSnapshot, newSnapshot, snapshotDiffOptions),
+        std::runtime_error);
+
+    // The reverse direction, a copy of the blob is brought up to date with the local image.
+    auto copyClient = m_blobContainerClient->GetPageBlobClient(RandomString());
+    copyClient.UploadFrom(baseFilename);
+    auto uploadResult = copyClient.SyncFromFileDiff(filename, baseFilename);
+    EXPECT_EQ(uploadResult->ContentLength, 5_MB);
+    EXPECT_EQ(ReadBodyStream(copyClient.Download()->BodyStream), blobContent);
+
+    Blobs::SyncPageBlobFromFileDiffOptions syncOptions;
+    syncOptions.ChunkSize = 1_MB + 100;
+    EXPECT_THROW(
+        copyClient.SyncFromFileDiff(filename, baseFilename, syncOptions), std::runtime_error);
+
+    DeleteFile(baseFilename);
+    DeleteFile(filename);
+  }
+
   TEST_F(PageBlobClientTest, StartCopyIncremental)
   {
     auto pageBlobClient = Azure::Storage::Blobs::PageBlobClient::CreateFromConnectionString(
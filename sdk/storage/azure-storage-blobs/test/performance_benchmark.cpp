@@ -4,6 +4,7 @@
 #include "blob_container_client_test.hpp"
 
 #include <chrono>
+#include <functional>
 #include <future>
 #include <vector>
 
@@ -106,4 +107,59 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST_F(BlobContainerClientTest, DISABLED_AppendBlobWriterPerf)
+  {
+    constexpr int concurrency = 16;
+    constexpr int recordsPerThread = 200;
+    std::vector<uint8_t> record = RandomBuffer(256);
+
+    auto measure = [&](std::function<void()> appendRecords) {
+      std::vector<std::future<void>> futures;
+      auto timer_start = std::chrono::steady_clock::now();
+      for (int i = 0; i < concurrency; ++i)
+      {
+        futures.emplace_back(std::async(std::launch::async, appendRecords));
+      }
+      for (auto& f : futures)
+      {
+        f.get();
+      }
+      auto timer_end = std::chrono::steady_clock::now();
+      return static_cast<double>(concurrency * recordsPerThread)
+          / std::chrono::duration_cast<std::chrono::milliseconds>(timer_end - timer_start).count()
+          * 1000;
+    };
+
+    {
+      auto appendBlobClient = Azure::Storage::Blobs::AppendBlobClient::CreateFromConnectionString(
+          StandardStorageConnectionString(), m_containerName, "AppendBlockPerf" + RandomString());
+      appendBlobClient.Create();
+      double speed = measure([&]() {
+        for (int i = 0; i < recordsPerThread; ++i)
+        {
+          auto recordStream = Azure::Core::Http::MemoryBodyStream(record.data(), record.size());
+          appendBlobClient.AppendBlock(&recordStream);
+        }
+      });
+      std::cout << "AppendBlock: " << speed << " appends/s" << std::endl;
+    }
+    {
+      auto appendBlobClient = Azure::Storage::Blobs::AppendBlobClient::CreateFromConnectionString(
+          StandardStorageConnectionString(),
+          m_containerName,
+          "AppendBlobWriterPerf" + RandomString());
+      appendBlobClient.Create();
+      Blobs::AppendBlobWriter writer(appendBlobClient);
+      double speed = measure([&]() {
+        for (int i = 0; i < recordsPerThread; ++i)
+        {
+          writer.Write(record.data(), record.size());
+        }
+        // Like a log shipper that needs every batch to be durable before it moves on.
+        writer.Flush().get();
+      });
+      std::cout << "AppendBlobWriter: " << speed << " appends/s" << std::endl;
+    }
+  }
+
 }}} // namespace Azure::Storage::Test
@@ -0,0 +1,138 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  class BufferPool;
+
+  /**
+   * @brief A buffer acquired from a BufferPool. It's returned to the pool when destroyed.
+   */
+  class PooledBuffer {
+  public:
+    PooledBuffer() = default;
+    PooledBuffer(PooledBuffer&& other) noexcept { *this = std::move(other); }
+    PooledBuffer& operator=(PooledBuffer&& other) noexcept;
+    ~PooledBuffer() { Release(); }
+
+    PooledBuffer(const PooledBuffer&) = delete;
+    PooledBuffer& operator=(const PooledBuffer&) = delete;
+
+    uint8_t* Data() const { return m_data; }
+
+    /**
+     * @brief The requested size. The underlying allocation may be larger.
+     */
+    std::size_t Size() const { return m_size; }
+
+    /**
+     * @brief Returns the buffer to its pool early.
+     */
+    void Release();
+
+  private:
+    friend class BufferPool;
+
+    BufferPool* m_pool = nullptr;
+    uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+    std::size_t m_sizeClass = 0;
+    std::size_t m_node = 0;
+  };
+
+  struct BufferPoolStatistics
+  {
+    /**
+     * @brief Number of buffers served from the cache.
+     */
+    int64_t Hits = 0;
+
+    /**
+     * @brief Number of buffers that had to be allocated.
+     */
+    int64_t Misses = 0;
+
+    /**
+     * @brief Bytes currently acquired and not yet released.
+     */
+    int64_t BytesInUse = 0;
+
+    /**
+     * @brief Bytes of released buffers kept for reuse.
+     */
+    int64_t CachedBytes = 0;
+
+    /**
+     * @brief Highest number of bytes allocated by the pool at any time, in use and cached.
+     */
+    int64_t PeakBytes = 0;
+  };
+
+  /**
+   * @brief A pool of transfer buffers in power-of-two size classes. Released buffers are cached up
+   * to a limit and handed out again to requests of the same class, preferably on the NUMA node
+   * they were first allocated on. On Linux, buffers of 2MiB and more are mapped directly and
+   * backed by transparent huge pages when enabled. Requests larger than the biggest size class
+   * are allocated and freed every time.
+   */
+  class BufferPool {
+  public:
+    /**
+     * @brief Creates a pool that caches at most \p maxCachedBytes of released buffers.
+     */
+    explicit BufferPool(std::size_t maxCachedBytes, bool useHugePages = true);
+
+    /**
+     * @brief Frees the cached buffers. All buffers must have been released.
+     */
+    ~BufferPool();
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    /**
+     * @brief Returns a buffer of at least \p size bytes. Its content is unspecified.
+     */
+    PooledBuffer Acquire(std::size_t size);
+
+    BufferPoolStatistics GetStatistics() const;
+
+    /**
+     * @brief Frees all cached buffers.
+     */
+    void Trim();
+
+    /**
+     * @brief Gets the process-wide pool used by parallel uploads and downloads.
+     */
+    static BufferPool& GetTransferBufferPool();
+
+  private:
+    friend class PooledBuffer;
+
+    // Size classes range from 2^12 to 2^26 bytes.
+    static constexpr std::size_t c_minSizeClassShift = 12;
+    static constexpr std::size_t c_numSizeClasses = 15;
+    static constexpr std::size_t c_maxNumaNodes = 8;
+
+    uint8_t* Allocate(std::size_t size);
+    void Free(uint8_t* data, std::size_t size);
+    void Release(PooledBuffer& buffer);
+
+    const std::size_t m_maxCachedBytes;
+    const bool m_useHugePages;
+
+    mutable std::mutex m_mutex;
+    std::array<std::array<std::vector<uint8_t*>, c_numSizeClasses>, c_maxNumaNodes> m_freeBuffers;
+    BufferPoolStatistics m_statistics;
+  };
+
+}}} // namespace Azure::Storage::Details
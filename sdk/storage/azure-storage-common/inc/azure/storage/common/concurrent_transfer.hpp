@@ -3,68 +3,112 @@
 
 #pragma once
 
-#include <atomic>
-#include <cstdlib>
+#include <chrono>
+#include <cstdint>
 #include <functional>
-#include <future>
+#include <memory>
+#include <mutex>
+
+namespace Azure { namespace Storage {
+  class TransferHandle;
+}} // namespace Azure::Storage
 
 namespace Azure { namespace Storage { namespace Details {
 
-  inline void ConcurrentTransfer(
+  /**
+   * @brief The part of a chunk a transfer function is responsible for. While it's in flight, idle
+   * workers may take over the second half of what's left of it, so the transfer function must
+   * claim every part before transferring it, and stop once nothing more is granted.
+   */
+  class ChunkRange {
+  public:
+    explicit ChunkRange(int64_t chunkId, int64_t offset, int64_t length, bool isSplitOff)
+        : m_chunkId(chunkId), m_offset(offset), m_position(offset), m_end(offset + length),
+          m_isSplitOff(isSplitOff), m_start(std::chrono::steady_clock::now())
+    {
+    }
+
+    ChunkRange(const ChunkRange&) = delete;
+    ChunkRange& operator=(const ChunkRange&) = delete;
+
+    /**
+     * @brief The chunk this range belongs to. Split-off ranges keep the id of the chunk they were
+     * split from.
+     */
+    int64_t ChunkId() const { return m_chunkId; }
+
+    bool IsSplitOff() const { return m_isSplitOff; }
+
+    int64_t Offset() const { return m_offset; }
+
+    /**
+     * @brief The current end of the range. It only ever moves towards the offset.
+     */
+    int64_t End() const;
+
+    /**
+     * @brief Claims the next, at most \p length bytes of the range. Returns the number of bytes
+     * claimed, 0 once the whole range is claimed.
+     */
+    int64_t Claim(int64_t length);
+
+    /**
+     * @brief Returns the number of bytes claimed so far.
+     */
+    int64_t ClaimedLength() const;
+
+    /**
+     * @brief Gives up the second half of the unclaimed part, if both halves are at least
+     * \p minLength bytes long, and returns its offset and length.
+     */
+    bool Split(int64_t minLength, int64_t& offset, int64_t& length);
+
+    /**
+     * @brief Estimates how long the unclaimed part will take at the rate seen so far.
+     */
+    double RemainingSeconds() const;
+
+  private:
+    const int64_t m_chunkId;
+    const int64_t m_offset;
+    int64_t m_position;
+    int64_t m_end;
+    const bool m_isSplitOff;
+    const std::chrono::steady_clock::time_point m_start;
+    mutable std::mutex m_mutex;
+  };
+
+  /**
+   * @brief Splits [offset, offset + length) into chunks of chunkSize and calls transferFunc on
+   * each of them, with at most concurrency chunks in flight. The calling thread works on chunks
+   * too, the rest are run on the shared transfer thread pool. Once a chunk fails no more chunks
+   * are started, and the first exception is rethrown after all in-flight chunks finish.
+   *
+   * If transferHandle is not null, every chunk holds a request slot of its TransferManager while
+   * it's being transferred, and the handle's progress is updated as chunks complete.
+   */
+  void ConcurrentTransfer(
       int64_t offset,
       int64_t length,
       int64_t chunkSize,
       int concurrency,
       // offset, length, chunk id, number of chunks
-      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc)
-  {
-    std::atomic<int> numWorkingThreads{concurrency};
-    std::atomic<int> nextChunkId{0};
-    std::atomic<bool> failed{false};
-
-    const auto numChunks = (length + chunkSize - 1) / chunkSize;
-
-    auto threadFunc = [&]() {
-      while (true)
-      {
-        int chunkId = nextChunkId.fetch_add(1);
-        if (chunkId >= numChunks || failed)
-        {
-          break;
-        }
-        int64_t chunkOffset = offset + chunkSize * chunkId;
-        int64_t chunkLength = std::min(length - chunkSize * chunkId, chunkSize);
-        try
-        {
-          transferFunc(chunkOffset, chunkLength, chunkId, numChunks);
-        }
-        catch (std::exception&)
-        {
-          if (failed.exchange(true) == false)
-          {
-            numWorkingThreads.fetch_sub(1);
-            throw;
-          }
-        }
-      }
-      numWorkingThreads.fetch_sub(1);
-    };
-
-    std::vector<std::future<void>> threadHandles;
-    for (int i = 0; i < concurrency - 1; ++i)
-    {
-      threadHandles.emplace_back(std::async(std::launch::async, threadFunc));
-    }
-    threadFunc();
-    for (auto& handle : threadHandles)
-    {
-      handle.get();
-    }
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+      std::shared_ptr<TransferHandle> transferHandle = nullptr);
 
-    if (numWorkingThreads != 0)
-    {
-      std::abort();
-    }
-  }
+  /**
+   * @brief Like the overload above, but once all chunks have been started, idle workers split
+   * off the second half of the unclaimed part of the in-flight chunk that's expected to finish
+   * last and transfer it themselves, as long as both halves are at least minSplitLength bytes.
+   * Progress is reported per claimed byte.
+   */
+  void ConcurrentTransfer(
+      int64_t offset,
+      int64_t length,
+      int64_t chunkSize,
+      int concurrency,
+      std::function<void(ChunkRange&)> transferFunc,
+      int64_t minSplitLength,
+      std::shared_ptr<TransferHandle> transferHandle = nullptr);
 
 }}} // namespace Azure::Storage::Details
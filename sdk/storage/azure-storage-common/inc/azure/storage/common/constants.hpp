@@ -4,6 +4,8 @@
 
 #pragma once
 
+#include <cstdint>
+
 namespace Azure { namespace Storage { namespace Details {
   constexpr static const char* c_BlobServicePackageName = "storage-blobs";
   constexpr static const char* c_DatalakeServicePackageName = "storage-files-datalake";
@@ -20,4 +22,9 @@ namespace Azure { namespace Storage { namespace Details {
   constexpr static const char* c_defaultSasVersion = "2020-02-10";
 
   constexpr int c_reliableStreamRetryCount = 3;
+  // Low enough that only connections that have practically stopped are abandoned, even when a
+  // slow link is shared by many parallel transfers.
+  constexpr int64_t c_reliableStreamMinimumThroughput = 8 * 1024;
+  constexpr int c_reliableStreamThroughputWindowSeconds = 30;
+  constexpr int c_reliableStreamMaximumIdleGapSeconds = 60;
 }}} // namespace Azure::Storage::Details
@@ -0,0 +1,42 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  /**
+   * @brief Splits a stream of bytes into chunks whose boundaries only depend on the bytes right
+   * before them, using a gear rolling hash. Inserting or removing bytes only changes the chunks
+   * around the edit, the boundaries after it move along with the content.
+   *
+   * The boundaries of the same content never change between runs, platforms or versions, so
+   * that chunks can be matched against the ones of an earlier upload.
+   */
+  class ContentDefinedChunker {
+  public:
+    /**
+     * @brief Chunks are at least \p minSize and at most \p maxSize bytes long, except the last
+     * one, and about \p averageSize bytes long on average. averageSize is rounded down to a power
+     * of two.
+     */
+    explicit ContentDefinedChunker(int64_t minSize, int64_t averageSize, int64_t maxSize);
+
+    /**
+     * @brief Scans the next \p length bytes of the stream. Returns the number of these bytes that
+     * belong to the current chunk if it ends within them, or -1 if it continues past them. The
+     * next call continues with the byte after the returned boundary.
+     */
+    int64_t FindBoundary(const uint8_t* data, int64_t length);
+
+  private:
+    int64_t m_minSize;
+    int64_t m_maxSize;
+    uint64_t m_mask = 0;
+    uint64_t m_hash = 0;
+    int64_t m_chunkLength = 0;
+  };
+
+}}} // namespace Azure::Storage::Details
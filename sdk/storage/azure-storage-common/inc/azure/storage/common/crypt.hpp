@@ -5,12 +5,32 @@
 
 #include <cstdint>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace Azure { namespace Storage {
 
   std::string Base64Encode(const std::string& text);
   std::string Base64Decode(const std::string& text);
 
+  /**
+   * @brief Gets the length of the Base64 encoding of \p length bytes, including padding.
+   */
+  constexpr std::size_t Base64EncodedLength(std::size_t length) { return (length + 2) / 3 * 4; }
+
+  /**
+   * @brief Base64 encodes \p length bytes into \p buffer, which must have room for
+   * Base64EncodedLength(length) characters. No null terminator is written.
+   *
+   * @return The number of characters written.
+   */
+  std::size_t Base64EncodeTo(const uint8_t* data, std::size_t length, char* buffer);
+
+  /**
+   * @brief Base64 encodes \p length bytes and appends the result to \p output.
+   */
+  void Base64EncodeTo(const uint8_t* data, std::size_t length, std::string& output);
+
   class Md5 {
   public:
     Md5();
@@ -32,6 +52,16 @@ namespace Azure { namespace Storage {
       return Hash(reinterpret_cast<const uint8_t*>(data.data()), data.length());
     }
 
+    /**
+     * @brief Computes the MD5 hashes of several independent buffers. On CPUs with AVX2, up to
+     * eight buffers are hashed at a time in parallel SIMD lanes.
+     *
+     * @param buffers Pointer and length of each buffer to hash.
+     * @return The MD5 hash of each buffer, in the same order.
+     */
+    static std::vector<std::string> HashBatch(
+        const std::vector<std::pair<const uint8_t*, std::size_t>>& buffers);
+
   private:
     void* m_context;
   };
@@ -63,6 +93,25 @@ namespace Azure { namespace Storage {
   namespace Details {
     std::string Sha256(const std::string& text);
     std::string HmacSha256(const std::string& text, const std::string& key);
+
+    /**
+     * @brief An HMAC-SHA256 key whose inner and outer padded states are computed once, so that
+     * signing a message only hashes the message itself. Sign can be called concurrently.
+     */
+    class HmacSha256Context {
+    public:
+      explicit HmacSha256Context(const std::string& key);
+      ~HmacSha256Context();
+
+      HmacSha256Context(const HmacSha256Context&) = delete;
+      HmacSha256Context& operator=(const HmacSha256Context&) = delete;
+
+      std::string Sign(const std::string& text) const;
+
+    private:
+      void* m_context;
+    };
+
     std::string UrlEncodeQueryParameter(const std::string& value);
     std::string UrlEncodePath(const std::string& value);
   } // namespace Details
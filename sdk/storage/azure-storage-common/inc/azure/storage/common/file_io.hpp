@@ -7,8 +7,16 @@
 #include <Windows.h>
 #endif
 
+#include "azure/storage/common/buffer_pool.hpp"
+
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <exception>
+#include <mutex>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace Azure { namespace Storage { namespace Details {
 
@@ -28,6 +36,25 @@ namespace Azure { namespace Storage { namespace Details {
 
     int64_t GetFileSize() const { return m_fileSize; }
 
+    /**
+     * @brief Returns the last modification time of the file in an OS-specific unit, which changes
+     * whenever the file is written.
+     */
+    int64_t GetLastWriteTime() const;
+
+    /**
+     * @brief Hints that the given range is about to be read, so the OS can start reading it ahead
+     * of time. Best effort, and never blocks on the disk.
+     */
+    void Prefetch(int64_t offset, int64_t length) const;
+
+    /**
+     * @brief Returns the offset of the first byte at or after \p offset that isn't in a hole of a
+     * sparse file, or the file size if there is none. Returns \p offset itself where holes can't
+     * be detected.
+     */
+    int64_t SeekData(int64_t offset) const;
+
   private:
     FileHandle m_handle;
     int64_t m_fileSize;
@@ -35,16 +62,128 @@ namespace Azure { namespace Storage { namespace Details {
 
   class FileWriter {
   public:
-    FileWriter(const std::string& filename);
-
+    /**
+     * @brief Opens or creates a file for writing. An existing file is emptied unless \p truncate
+     * is false.
+     */
+    FileWriter(const std::string& filename, bool truncate = true);
+
+    /**
+     * @brief Waits for the queued writes. Errors that weren't reported by Flush are dropped.
+     */
     ~FileWriter();
 
     FileHandle GetHandle() const { return m_handle; }
 
+    /**
+     * @brief Returns the current size of the file.
+     */
+    int64_t GetFileSize() const;
+
     void Write(const uint8_t* buffer, int64_t length, int64_t offset);
 
+    /**
+     * @brief Reserves disk space for a file of \p size bytes, so that out-of-order writes don't
+     * fragment it. Files of at least 64MiB are also kept out of the page cache once they're
+     * written. Best effort.
+     */
+    void Preallocate(int64_t size);
+
+    /**
+     * @brief Sets the size of the file, dropping anything beyond it.
+     */
+    void Truncate(int64_t size);
+
+    /**
+     * @brief Marks the file as sparse, so that ranges that are never written don't take up disk
+     * space. Files are sparse by default on POSIX file systems that support it. Best effort.
+     */
+    void SetSparse();
+
+    /**
+     * @brief Makes \p length bytes at \p offset read as zeros, releasing their disk space where
+     * the file system supports it and writing zeros otherwise.
+     */
+    void ZeroRange(int64_t offset, int64_t length);
+
+    /**
+     * @brief Returns a buffer of \p size bytes for WriteAsync from the transfer buffer pool.
+     */
+    PooledBuffer AcquireBuffer(std::size_t size)
+    {
+      return BufferPool::GetTransferBufferPool().Acquire(size);
+    }
+
+    /**
+     * @brief Queues \p buffer to be written at \p offset by a background thread, so the caller can
+     * go back to receiving data. Blocks only while too many buffers are queued. Errors are thrown
+     * by a later call to WriteAsync or Flush.
+     */
+    void WriteAsync(PooledBuffer buffer, int64_t offset);
+
+    /**
+     * @brief Waits for all queued writes and throws if any of them failed.
+     */
+    void Flush();
+
   private:
+    struct PendingWrite
+    {
+      PooledBuffer Buffer;
+      int64_t Offset;
+    };
+
+    void WriteZeros(int64_t offset, int64_t length);
+    void WriteLoop();
+    void StopWriting();
+    void ReleaseWrittenPages(int64_t offset, int64_t length);
+
     FileHandle m_handle;
+    bool m_dropPageCache = false;
+    int64_t m_lastWriteOffset = 0;
+    int64_t m_lastWriteLength = 0;
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<PendingWrite> m_queue;
+    bool m_writing = false;
+    bool m_stop = false;
+    std::exception_ptr m_error;
+    std::thread m_thread;
+  };
+
+  /**
+   * @brief A mapping of a whole file into memory. Throws std::runtime_error if the file can't be
+   * mapped, for example because it's empty or on a file system that doesn't support it, so callers
+   * can fall back to regular reads and writes.
+   */
+  class MemoryMappedFile {
+  public:
+    /**
+     * @brief Maps \p file for reading, with sequential access hints.
+     */
+    explicit MemoryMappedFile(const FileReader& file);
+
+    /**
+     * @brief Sets the size of \p file to \p size bytes and maps it for writing.
+     */
+    explicit MemoryMappedFile(const FileWriter& file, int64_t size);
+
+    MemoryMappedFile(const MemoryMappedFile&) = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    ~MemoryMappedFile();
+
+    uint8_t* Data() const { return m_data; }
+
+    int64_t Size() const { return m_size; }
+
+  private:
+    uint8_t* m_data = nullptr;
+    int64_t m_size = 0;
+#ifdef _WIN32
+    HANDLE m_mapping = NULL;
+#endif
   };
 
 }}} // namespace Azure::Storage::Details
@@ -0,0 +1,121 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  enum class JsonTokenType
+  {
+    StartObject,
+    EndObject,
+    StartArray,
+    EndArray,
+    PropertyName,
+    String,
+    Number,
+    True,
+    False,
+    Null,
+    End,
+  };
+
+  struct JsonToken
+  {
+    explicit JsonToken(JsonTokenType type, const char* value = nullptr, std::size_t length = 0)
+        : Type(type), Value(value), Length(length)
+    {
+    }
+
+    std::string ToString() const { return std::string(Value, Length); }
+
+    bool Equals(const char* text) const
+    {
+      return std::char_traits<char>::length(text) == Length
+          && std::char_traits<char>::compare(Value, text, Length) == 0;
+    }
+
+    JsonTokenType Type;
+    // For property names, strings and numbers. Not null-terminated.
+    const char* Value;
+    std::size_t Length;
+  };
+
+  /**
+   * @brief A pull parser for the JSON documents returned by the storage services. No document
+   * tree is built: tokens are returned one at a time and refer to the caller's buffer, except for
+   * strings with escape sequences, which are decoded into a scratch buffer that's reused by the
+   * next call to Read.
+   */
+  class JsonReader {
+  public:
+    /**
+     * @brief Parses \p data, which must outlive the reader.
+     */
+    explicit JsonReader(const char* data, std::size_t length) : m_data(data), m_length(length) {}
+
+    JsonToken Read();
+
+    /**
+     * @brief Reads the next token and throws if it isn't of type \p expected.
+     */
+    JsonToken Read(JsonTokenType expected);
+
+    /**
+     * @brief Returns the type of the next token without consuming it. Like Read, this invalidates
+     * the value of the previous token.
+     */
+    JsonTokenType PeekType();
+
+    std::string ReadString() { return Read(JsonTokenType::String).ToString(); }
+
+    /**
+     * @brief Reads an integer, which the services send either as a number or as a string.
+     */
+    int64_t ReadInt64();
+
+    /**
+     * @brief Reads a boolean, which the services send either as a literal or as a string.
+     */
+    bool ReadBoolean();
+
+    /**
+     * @brief Reads and discards the next value, including all nested values of an object or
+     * array.
+     */
+    void SkipValue();
+
+  private:
+    enum class State
+    {
+      Value,
+      ValueOrEndArray,
+      NameOrEndObject,
+      Name,
+      CommaOrEnd,
+      Done,
+    };
+
+    JsonToken ReadValue();
+    JsonToken ReadString(JsonTokenType type);
+    JsonToken ReadLiteral(const char* literal, JsonTokenType type);
+    JsonToken ReadNumber();
+    JsonToken CloseContainer(bool isObject);
+    void AfterValue();
+    void SkipWhitespace();
+    [[noreturn]] void ThrowParseError() const;
+
+    const char* m_data;
+    std::size_t m_length;
+    std::size_t m_pos = 0;
+    State m_state = State::Value;
+    // One entry per open container, true for objects.
+    std::vector<bool> m_containers;
+    std::string m_scratch;
+  };
+
+}}} // namespace Azure::Storage::Details
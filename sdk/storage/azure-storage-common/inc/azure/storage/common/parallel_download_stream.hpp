@@ -0,0 +1,105 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "azure/core/context.hpp"
+#include "azure/core/http/body_stream.hpp"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+
+namespace Azure { namespace Storage {
+
+  // Defines a fn signature to be used to get a bodyStream with length bytes of the content,
+  // starting at offset.
+  typedef std::function<std::unique_ptr<Azure::Core::Http::BodyStream>(
+      Azure::Core::Context const&,
+      int64_t offset,
+      int64_t length)>
+      RangeGetter;
+
+  // Options used by parallel download stream
+  struct ParallelDownloadStreamOptions
+  {
+    // The number of bytes requested by every range request.
+    int64_t ChunkSize = 4 * 1024 * 1024;
+
+    // The maximum number of ranges that are downloaded, or downloaded and not read yet, at the same
+    // time. Memory use is bounded by Concurrency * ChunkSize.
+    int Concurrency = 5;
+  };
+
+  /**
+   * @brief A body stream that's read in order, while the ranges after the read position are
+   * downloaded concurrently. Every range is downloaded into a pooled buffer with a RangeGetter
+   * callback on the transfer thread pool, and buffers are released as soon as they're read.
+   *
+   * @remark The RangeGetter callback is expected to make sure all ranges come from the same
+   * content, for example by verifying the `eTag`, and to retry failed reads.
+   */
+  class ParallelDownloadStream : public Azure::Core::Http::BodyStream {
+  public:
+    /**
+     * @brief Constructs a stream of length bytes of the content from offset.
+     *
+     * @param firstChunk An already opened stream with the first bytes of the range, which is read
+     * as it is. Null means the whole range is downloaded with rangeGetter.
+     * @param offset The offset of the range in the content.
+     * @param length The length of the range.
+     * @param rangeGetter Opens a stream for a part of the range.
+     * @param context Context for cancelling the downloads. They're also canceled when the stream
+     * is destroyed.
+     * @param options Optional parameters of the stream.
+     */
+    explicit ParallelDownloadStream(
+        std::unique_ptr<Azure::Core::Http::BodyStream> firstChunk,
+        int64_t offset,
+        int64_t length,
+        RangeGetter rangeGetter,
+        Azure::Core::Context const& context,
+        ParallelDownloadStreamOptions const& options = ParallelDownloadStreamOptions());
+
+    ~ParallelDownloadStream() override;
+
+    ParallelDownloadStream(const ParallelDownloadStream&) = delete;
+    ParallelDownloadStream& operator=(const ParallelDownloadStream&) = delete;
+
+    int64_t Length() const override { return this->m_length; }
+    void Rewind() override;
+    int64_t Read(Azure::Core::Context const& context, uint8_t* buffer, int64_t count) override;
+
+  private:
+    struct Chunk;
+
+    // Signals completed chunks to the reader.
+    struct SharedState
+    {
+      std::mutex Mutex;
+      std::condition_variable Cv;
+    };
+
+    // Starts downloading chunks until the window is full or the end of the range is reached.
+    void FillWindow();
+
+    std::unique_ptr<Azure::Core::Http::BodyStream> m_firstChunk;
+    int64_t m_firstChunkLength = 0;
+    const int64_t m_offset;
+    const int64_t m_length;
+    const RangeGetter m_rangeGetter;
+    const Azure::Core::Context m_parentContext;
+    // Canceled to abandon the chunks being downloaded, renewed by Rewind.
+    Azure::Core::Context m_context;
+    const ParallelDownloadStreamOptions m_options;
+    std::shared_ptr<SharedState> m_state;
+    // Chunks in the order they're read, the front one contains the read position.
+    std::deque<std::shared_ptr<Chunk>> m_window;
+    int64_t m_position = 0;
+    int64_t m_nextChunkOffset = 0;
+  };
+
+}} // namespace Azure::Storage
@@ -5,6 +5,8 @@
 #include "azure/core/http/body_stream.hpp"
 
 #include <algorithm>
+#include <array>
+#include <chrono>
 #include <functional>
 
 namespace Azure { namespace Storage {
@@ -26,6 +28,21 @@ namespace Azure { namespace Storage {
   {
     // configures the maximun retries to be done.
     int64_t MaxRetryRequests;
+
+    // If not zero, a connection that delivers fewer bytes per second than this over
+    // ThroughputWindow is abandoned, and reading resumes from the current offset on a new
+    // connection. Only the time spent waiting in reads counts, so a caller that's slow to consume
+    // the stream doesn't make the connection look stalled. Every new connection gets a full window
+    // before it's checked. After MaxRetryRequests such reconnections the stream is read at
+    // whatever rate it's delivered.
+    int64_t MinimumThroughput = 0;
+
+    // The period MinimumThroughput is measured over.
+    std::chrono::milliseconds ThroughputWindow = std::chrono::seconds(30);
+
+    // If not zero, a read that receives nothing for this long abandons the connection and is
+    // retried on a new one like a failed read. The inner stream must honor context cancellation.
+    std::chrono::milliseconds MaximumIdleGap = std::chrono::milliseconds(0);
   };
 
   /**
@@ -44,6 +61,8 @@ namespace Azure { namespace Storage {
   private:
     // initial bodyStream.
     std::unique_ptr<Azure::Core::Http::BodyStream> m_inner;
+    // Length of the initial bodyStream. m_inner is null between a failed read and the next one.
+    int64_t m_length;
     // Configuration for the re-triable stream
     ReliableStreamOptions const m_options;
     // callback to get a bodyStream in case Read operation fails
@@ -51,21 +70,41 @@ namespace Azure { namespace Storage {
     // Options to use when getting a new bodyStream like current offset
     HttpGetterInfo m_retryInfo;
 
+    // Bytes received by the current connection in each slice of the throughput window, indexed
+    // by slice number modulo the number of slices. Slices are measured in time spent reading.
+    static constexpr int64_t c_numThroughputSlices = 8;
+    std::array<int64_t, c_numThroughputSlices> m_sliceBytes{};
+    int64_t m_currentSlice = 0;
+    std::chrono::steady_clock::duration m_readTime{};
+    bool m_measuring = false;
+    int64_t m_numStallReconnections = 0;
+
+    // Returns true if the current connection is below the minimum throughput, given a read that
+    // took readTime.
+    bool IsStalled(int64_t bytesRead, std::chrono::steady_clock::duration readTime);
+
   public:
     explicit ReliableStream(
         std::unique_ptr<Azure::Core::Http::BodyStream> inner,
         ReliableStreamOptions const options,
         HTTPGetter httpGetter)
-        : m_inner(std::move(inner)), m_options(options), m_httpGetter(std::move(httpGetter))
+        : m_inner(std::move(inner)), m_length(m_inner->Length()), m_options(options),
+          m_httpGetter(std::move(httpGetter))
     {
     }
 
-    int64_t Length() const override { return this->m_inner->Length(); }
+    int64_t Length() const override { return this->m_length; }
     void Rewind() override
     {
-      // Rewind directly from a transportAdapter body stream (like libcurl) would throw
-      this->m_inner->Rewind();
+      // Rewind directly from a transportAdapter body stream (like libcurl) would throw. Without
+      // an inner stream, the next read opens one at offset 0.
+      if (this->m_inner)
+      {
+        this->m_inner->Rewind();
+      }
       this->m_retryInfo.Offset = 0;
+      this->m_measuring = false;
+      this->m_numStallReconnections = 0;
     }
     int64_t Read(Azure::Core::Context const& context, uint8_t* buffer, int64_t count) override;
   };
@@ -16,4 +16,36 @@ namespace Azure { namespace Storage {
 
   std::string CreateUniqueLeaseId();
 
+  namespace Details {
+    /**
+     * @brief FNV-1a hash of a string. It can be evaluated at compile time, so header and element
+     * names can be classified with a switch statement followed by a single string comparison.
+     * Names that collide within one switch fail to compile as duplicate case labels.
+     */
+    constexpr uint32_t StaticHash(const char* data, std::size_t length)
+    {
+      uint32_t hash = 2166136261U;
+      for (std::size_t i = 0; i < length; ++i)
+      {
+        hash = (hash ^ static_cast<uint8_t>(data[i])) * 16777619U;
+      }
+      return hash;
+    }
+
+    constexpr uint32_t StaticHash(const char* str)
+    {
+      uint32_t hash = 2166136261U;
+      for (; *str != '\0'; ++str)
+      {
+        hash = (hash ^ static_cast<uint8_t>(*str)) * 16777619U;
+      }
+      return hash;
+    }
+
+    /**
+     * @brief Returns true if all \p length bytes at \p data are zero.
+     */
+    bool IsAllZeros(const uint8_t* data, std::size_t length);
+  } // namespace Details
+
 }} // namespace Azure::Storage
@@ -13,6 +13,9 @@
 namespace Azure { namespace Storage {
 
   struct AccountSasBuilder;
+  namespace Details {
+    class HmacSha256Context;
+  }
   namespace Blobs {
     struct BlobSasBuilder;
   }
@@ -53,6 +56,7 @@ namespace Azure { namespace Storage {
     {
       std::lock_guard<std::mutex> guard(m_mutex);
       m_accountKey = std::move(accountKey);
+      m_signingContext.reset();
     }
 
     /**
@@ -72,8 +76,15 @@ namespace Azure { namespace Storage {
       return m_accountKey;
     }
 
+    /**
+     * @brief Gets the HMAC-SHA256 context for the decoded account key. It's created on first use
+     * and dropped when the account key is updated.
+     */
+    std::shared_ptr<const Details::HmacSha256Context> GetSigningContext() const;
+
     mutable std::mutex m_mutex;
     std::string m_accountKey;
+    mutable std::shared_ptr<const Details::HmacSha256Context> m_signingContext;
   };
 
   namespace Details {
@@ -0,0 +1,80 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  /**
+   * @brief A work-stealing thread pool. Tasks submitted from outside the pool go to a shared
+   * queue, tasks submitted from a worker go to that worker's own queue. Idle workers drain their
+   * own queue first, then the shared queue, then steal from other workers. Threads are created
+   * lazily and never exceed the configured maximum.
+   *
+   * @remark Tasks must not throw.
+   */
+  class ThreadPool {
+  public:
+    explicit ThreadPool(std::size_t maxThreads);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    void Submit(std::function<void()> task);
+
+    /**
+     * @brief Queues \p task at the back of the shared queue, even when called from a worker, so
+     * it runs after every task queued there before it.
+     */
+    void SubmitShared(std::function<void()> task);
+
+    /**
+     * @brief Changes the maximum number of threads. Lowering the limit lets surplus threads exit
+     * once they become idle.
+     */
+    void SetMaxThreads(std::size_t maxThreads);
+    std::size_t GetMaxThreads() const { return m_maxThreads; }
+
+    /**
+     * @brief Gets the process-wide pool used by parallel uploads and downloads.
+     */
+    static ThreadPool& GetTransferThreadPool();
+
+  private:
+    struct Worker
+    {
+      std::mutex Mutex;
+      std::deque<std::function<void()>> Tasks;
+      std::thread Thread;
+      bool Running = false;
+    };
+
+    void Enqueue(std::function<void()> task, bool shared);
+    void WorkerFunc(Worker* worker);
+    bool TryPopTask(Worker* worker, std::function<void()>& task);
+    void SpawnWorker();
+
+    std::atomic<std::size_t> m_maxThreads;
+    std::atomic<int64_t> m_numPendingTasks{0};
+
+    std::mutex m_mutex;
+    std::condition_variable m_cv;
+    std::deque<std::function<void()>> m_tasks;
+    std::vector<std::unique_ptr<Worker>> m_workers;
+    std::size_t m_numRunningThreads = 0;
+    std::size_t m_numIdleThreads = 0;
+    bool m_stopped = false;
+  };
+
+}}} // namespace Azure::Storage::Details
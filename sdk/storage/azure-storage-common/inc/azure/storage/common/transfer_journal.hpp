@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include <cstdint>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  /**
+   * @brief Records which chunks of a transfer are complete in a checkpoint file, so that an
+   * interrupted transfer can be resumed without transferring them again.
+   *
+   * The file starts with the identity of the transfer, for example the ETag of the source, and its
+   * layout, followed by the ID of every completed chunk on a line of its own. Lines are appended
+   * and flushed as chunks complete, so the file survives the process being killed. A partly
+   * written last line is ignored.
+   */
+  class TransferJournal {
+  public:
+    /**
+     * @brief Opens the journal in \p fileName. If it was written for the same identity, length and
+     * chunk size, the chunks it records are considered complete. Otherwise it's started over.
+     */
+    explicit TransferJournal(
+        const std::string& fileName,
+        const std::string& identity,
+        int64_t length,
+        int64_t chunkSize);
+
+    TransferJournal(const TransferJournal&) = delete;
+    TransferJournal& operator=(const TransferJournal&) = delete;
+
+    /**
+     * @brief Returns true if an existing journal of the same transfer was opened.
+     */
+    bool IsResumed() const { return m_resumed; }
+
+    /**
+     * @brief Returns true if the chunk was recorded as complete when the journal was opened.
+     */
+    bool IsChunkDone(int64_t chunkId) const;
+
+    /**
+     * @brief Records that a chunk is complete. Safe to call from several threads.
+     */
+    void SetChunkDone(int64_t chunkId);
+
+    /**
+     * @brief Closes and deletes the journal file once the transfer has completed.
+     */
+    void Remove();
+
+  private:
+    std::string m_fileName;
+    std::vector<bool> m_doneChunks;
+    bool m_resumed = false;
+    std::mutex m_mutex;
+    std::ofstream m_stream;
+  };
+
+}}} // namespace Azure::Storage::Details
@@ -0,0 +1,216 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#pragma once
+
+#include "azure/core/context.hpp"
+#include "azure/core/nullable.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Azure { namespace Storage {
+
+  class TransferHandle;
+
+  namespace Details {
+    struct TransferManagerState;
+    struct BoundContexts;
+    class TransferSlot;
+    void SubmitTransferTask(
+        std::shared_ptr<TransferHandle> handle,
+        std::function<void()> task,
+        bool shared);
+  } // namespace Details
+
+  /**
+   * @brief Priority of a transfer. Requests of interactive transfers are always scheduled ahead of
+   * requests of bulk transfers sharing the same TransferManager.
+   */
+  enum class TransferPriority
+  {
+    Interactive,
+    Bulk,
+  };
+
+  /**
+   * @brief Optional parameters for TransferManager.
+   */
+  struct TransferManagerOptions
+  {
+    /**
+     * @brief The maximum number of requests that may be in flight across all transfers of the
+     * manager.
+     */
+    int MaxConcurrentRequests = 16;
+
+    /**
+     * @brief The maximum aggregate throughput of all transfers of the manager, in bytes per second.
+     * Null means no limit.
+     */
+    Azure::Core::Nullable<int64_t> MaxBytesPerSecond;
+  };
+
+  /**
+   * @brief Controls and reports the progress of a single parallel upload or download. Pass it in
+   * the TransferHandle field of the upload or download options.
+   */
+  class TransferHandle {
+  public:
+    /**
+     * @brief Gets the priority of this transfer.
+     */
+    TransferPriority GetPriority() const { return m_priority; }
+
+    /**
+     * @brief Stops issuing new requests for this transfer until Resume is called. Requests already
+     * in flight are allowed to complete. Tasks of the transfer that are about to start on the
+     * transfer thread pool are put aside instead of occupying a pool thread.
+     */
+    void Pause();
+
+    /**
+     * @brief Resumes a paused transfer.
+     */
+    void Resume();
+
+    /**
+     * @brief Cancels the transfer. In-flight requests are aborted and the upload or download
+     * throws.
+     */
+    void Cancel();
+
+    /**
+     * @brief Returns true if the transfer is paused.
+     */
+    bool IsPaused() const { return m_paused; }
+
+    /**
+     * @brief Returns true if the transfer was cancelled.
+     */
+    bool IsCancelled() const { return m_cancelled; }
+
+    /**
+     * @brief Gets the number of bytes transferred so far.
+     */
+    int64_t GetBytesTransferred() const { return m_bytesTransferred; }
+
+    /**
+     * @brief Gets the total number of bytes of the transfer, or 0 if it's not known yet.
+     */
+    int64_t GetTotalBytes() const { return m_totalBytes; }
+
+    /**
+     * @brief Binds a context to this transfer so that cancelling the transfer cancels requests
+     * sent with the returned context.
+     *
+     * @param context The context passed by the caller of the upload or download.
+     * @return A child context of \p context.
+     */
+    Azure::Core::Context BindContext(const Azure::Core::Context& context);
+
+    /**
+     * @brief Sets the total number of bytes of the transfer once it's known.
+     */
+    void SetTotalBytes(int64_t totalBytes) { m_totalBytes = totalBytes; }
+
+  private:
+    explicit TransferHandle(
+        std::shared_ptr<Details::TransferManagerState> manager,
+        TransferPriority priority);
+
+    // Queues the tasks put aside while the transfer was paused.
+    void SubmitParkedTasks();
+
+    std::shared_ptr<Details::TransferManagerState> m_manager;
+    const TransferPriority m_priority;
+    std::atomic<bool> m_paused{false};
+    std::atomic<bool> m_cancelled{false};
+    std::atomic<int64_t> m_bytesTransferred{0};
+    std::atomic<int64_t> m_totalBytes{0};
+
+    // Guarded by the mutex of the manager.
+    std::vector<std::function<void()>> m_parkedTasks;
+    std::shared_ptr<Details::BoundContexts> m_boundContexts;
+
+    friend class TransferManager;
+    friend class Details::TransferSlot;
+    friend void Details::SubmitTransferTask(
+        std::shared_ptr<TransferHandle> handle,
+        std::function<void()> task,
+        bool shared);
+  };
+
+  /**
+   * @brief Shares a global request budget and an optional bandwidth cap between all transfers
+   * created from it.
+   */
+  class TransferManager {
+  public:
+    explicit TransferManager(const TransferManagerOptions& options = TransferManagerOptions());
+
+    /**
+     * @brief Creates a handle for a new transfer scheduled by this manager.
+     *
+     * @param priority Priority of the transfer.
+     */
+    std::shared_ptr<TransferHandle> CreateTransfer(
+        TransferPriority priority = TransferPriority::Bulk);
+
+  private:
+    std::shared_ptr<Details::TransferManagerState> m_state;
+  };
+
+  namespace Details {
+
+    /**
+     * @brief Holds one request slot of a transfer. The constructor blocks while the transfer is
+     * paused, the request budget is exhausted or the bandwidth cap is reached, and throws if the
+     * transfer is cancelled. \p bytes is charged against the bandwidth cap. Constructing it with a
+     * null handle is a no-op.
+     */
+    class TransferSlot {
+    public:
+      explicit TransferSlot(std::shared_ptr<TransferHandle> handle, int64_t bytes);
+      ~TransferSlot();
+
+      TransferSlot(const TransferSlot&) = delete;
+      TransferSlot& operator=(const TransferSlot&) = delete;
+
+      /**
+       * @brief Adds \p bytesTransferred to the progress of the transfer and releases the slot
+       * early.
+       */
+      void Complete(int64_t bytesTransferred);
+
+    private:
+      void Release();
+
+      std::shared_ptr<TransferHandle> m_handle;
+    };
+
+    /**
+     * @brief Runs \p task on the transfer thread pool. If the transfer of \p handle is paused
+     * when the task is about to start, it's put aside instead of blocking a pool thread, and
+     * queued again once the transfer is resumed or cancelled. \p shared queues the task with
+     * ThreadPool::SubmitShared. A null handle just submits the task.
+     */
+    void SubmitTransferTask(
+        std::shared_ptr<TransferHandle> handle,
+        std::function<void()> task,
+        bool shared = false);
+
+    inline Azure::Core::Context BindTransferContext(
+        const std::shared_ptr<TransferHandle>& handle,
+        const Azure::Core::Context& context)
+    {
+      return handle ? handle->BindContext(context) : context;
+    }
+
+  } // namespace Details
+
+}} // namespace Azure::Storage
@@ -3,12 +3,12 @@
 
 #pragma once
 
+#include "azure/core/context.hpp"
+#include "azure/core/http/body_stream.hpp"
+
 #include <functional>
 #include <string>
-
-struct _xmlTextReader;
-struct _xmlTextWriter;
-struct _xmlBuffer;
+#include <vector>
 
 namespace Azure { namespace Storage { namespace Details {
 
@@ -33,30 +33,137 @@ namespace Azure { namespace Storage { namespace Details {
     const char* Value;
   };
 
+  /**
+   * @brief A non-validating pull parser for the XML documents returned by the storage services.
+   * The document is parsed in place: names and values are null-terminated and entity-decoded
+   * inside the reader's buffer. DTDs are not supported.
+   */
   class XmlReader {
   public:
+    /**
+     * @brief Parses a document that's already in memory. The document is copied once, and the
+     * pointers in the returned nodes stay valid for the lifetime of the reader.
+     */
     explicit XmlReader(const char* data, std::size_t length);
+
+    /**
+     * @brief Parses a document as it's read from \p stream. Only the part of the document that
+     * hasn't been parsed yet is buffered, and the pointers in a returned node are only valid until
+     * the next call to Read.
+     */
+    explicit XmlReader(const Azure::Core::Context& context, Azure::Core::Http::BodyStream& stream);
+
     ~XmlReader();
 
     XmlNode Read();
 
   private:
-    _xmlTextReader* m_reader = nullptr;
-    bool m_readingAttributes = false;
+    struct NeedMoreData
+    {
+    };
+
+    struct AttributeRange
+    {
+      std::size_t NameBegin;
+      std::size_t NameEnd;
+      std::size_t ValueBegin;
+      std::size_t ValueEnd;
+    };
+
+    XmlNode ReadNode();
+    XmlNode ParseStartTag();
+    std::size_t ParseName();
+    std::size_t DecodeInPlace(std::size_t begin, std::size_t end);
+    void SkipWhitespace();
+    bool FillBuffer();
+    [[noreturn]] void ThrowUnexpectedEnd() const;
+    [[noreturn]] void ThrowParseError() const;
+
+    // Offsets into m_buffer rather than pointers, so that the reader can be moved and the buffer
+    // can grow.
+    std::string m_buffer;
+    std::size_t m_pos = 0;
+    // Set when the '<' at m_pos was overwritten by the terminator of the preceding text.
+    bool m_tagOpened = false;
+    bool m_lastWasStartTag = false;
+    // Names of the open elements. Strings are reused to keep their capacity.
+    std::vector<std::string> m_openTags;
+    std::size_t m_depth = 0;
+    std::vector<AttributeRange> m_attributes;
+    std::size_t m_nextAttribute = 0;
+
+    Azure::Core::Context m_context;
+    Azure::Core::Http::BodyStream* m_stream = nullptr;
+    bool m_streamEnded = true;
   };
 
+  /**
+   * @brief Serializes an XML document straight into a string. Names and values are copied and
+   * escaped as they're written, so nodes may point to temporaries.
+   */
   class XmlWriter {
   public:
-    explicit XmlWriter();
-    ~XmlWriter();
+    /**
+     * @param sizeHint The expected size of the document in bytes, used to preallocate the
+     * buffer.
+     */
+    explicit XmlWriter(std::size_t sizeHint = 0);
 
     void Write(XmlNode node);
 
+    /**
+     * @brief Returns the document written so far and leaves the writer's buffer empty.
+     */
     std::string GetDocument();
 
   private:
-    _xmlBuffer* m_buffer = nullptr;
-    _xmlTextWriter* m_writer = nullptr;
+    void CloseStartTag();
+    void WriteEscaped(const char* text, bool isAttribute);
+
+    std::string m_buffer;
+    // Names of the open elements. Strings are reused to keep their capacity.
+    std::vector<std::string> m_openTags;
+    std::size_t m_depth = 0;
+    // The '>' of the last start tag hasn't been written yet, so attributes can still follow.
+    bool m_startTagOpen = false;
+
+    friend class XmlBodyStream;
+  };
+
+  /**
+   * @brief A request body that serializes an XML document part by part as the transport reads
+   * it, so a large document is never held in memory as a whole.
+   *
+   * @remark \p writePart writes the nodes of the part with the given index and returns true if
+   * more parts follow. Every part is written once up front to compute the length of the body.
+   * The first 64 KB or so of the document are kept from that pass, so a small document is never
+   * serialized again. The parts after that are written again each time they're read, so a large
+   * document costs about twice the CPU of serializing it once. \p writePart must write the same
+   * nodes every time.
+   */
+  class XmlBodyStream : public Azure::Core::Http::BodyStream {
+  public:
+    explicit XmlBodyStream(std::function<bool(XmlWriter&, std::size_t)> writePart);
+
+    int64_t Length() const override { return m_length; }
+
+    void Rewind() override;
+
+    int64_t Read(const Azure::Core::Context& context, uint8_t* buffer, int64_t count) override;
+
+  private:
+    std::function<bool(XmlWriter&, std::size_t)> m_writePart;
+    int64_t m_length = 0;
+    // The start of the document as written when the length was computed, and the state of the
+    // writer after it, where reading continues.
+    std::string m_bufferedDocument;
+    XmlWriter m_bufferedWriter;
+    std::size_t m_numBufferedParts = 0;
+    bool m_allPartsBuffered = false;
+    XmlWriter m_writer;
+    std::size_t m_offset = 0;
+    std::size_t m_nextPart = 0;
+    bool m_lastPartWritten = false;
   };
 
 }}} // namespace Azure::Storage::Details
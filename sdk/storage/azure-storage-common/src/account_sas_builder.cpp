@@ -101,8 +101,7 @@ namespace Azure { namespace Storage {
         + "\n" + (IPRange.HasValue() ? IPRange.GetValue() : "") + "\n" + protocol + "\n"
         + Details::c_defaultSasVersion + "\n";
 
-    std::string signature
-        = Base64Encode(Details::HmacSha256(stringToSign, Base64Decode(credential.GetAccountKey())));
+    std::string signature = Base64Encode(credential.GetSigningContext()->Sign(stringToSign));
 
     Azure::Core::Http::Url builder;
     builder.AppendQueryParameter(
@@ -0,0 +1,220 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/buffer_pool.hpp"
+
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+#include <algorithm>
+#include <new>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  namespace {
+    constexpr std::size_t c_hugePageSize = 2 * 1024 * 1024;
+
+    std::size_t GetCurrentNumaNode()
+    {
+#if defined(__linux__) && defined(SYS_getcpu)
+      unsigned int cpu = 0;
+      unsigned int node = 0;
+      if (syscall(SYS_getcpu, &cpu, &node, nullptr) == 0)
+      {
+        return node;
+      }
+#endif
+      return 0;
+    }
+  } // namespace
+
+  constexpr std::size_t BufferPool::c_minSizeClassShift;
+  constexpr std::size_t BufferPool::c_numSizeClasses;
+  constexpr std::size_t BufferPool::c_maxNumaNodes;
+
+  PooledBuffer& PooledBuffer::operator=(PooledBuffer&& other) noexcept
+  {
+    if (this != &other)
+    {
+      Release();
+      m_pool = other.m_pool;
+      m_data = other.m_data;
+      m_size = other.m_size;
+      m_sizeClass = other.m_sizeClass;
+      m_node = other.m_node;
+      other.m_pool = nullptr;
+      other.m_data = nullptr;
+      other.m_size = 0;
+    }
+    return *this;
+  }
+
+  void PooledBuffer::Release()
+  {
+    if (m_pool != nullptr && m_data != nullptr)
+    {
+      m_pool->Release(*this);
+    }
+    m_pool = nullptr;
+    m_data = nullptr;
+    m_size = 0;
+  }
+
+  BufferPool::BufferPool(std::size_t maxCachedBytes, bool useHugePages)
+      : m_maxCachedBytes(maxCachedBytes), m_useHugePages(useHugePages)
+  {
+  }
+
+  BufferPool::~BufferPool() { Trim(); }
+
+  BufferPool& BufferPool::GetTransferBufferPool()
+  {
+    // Enough for the chunk buffers of a few concurrent transfers. Never destroyed, so buffers can
+    // still be released by threads that outlive static destruction.
+    constexpr std::size_t c_maxCachedBytes = 128 * 1024 * 1024;
+    static BufferPool* pool = new BufferPool(c_maxCachedBytes);
+    return *pool;
+  }
+
+  uint8_t* BufferPool::Allocate(std::size_t size)
+  {
+#if defined(__linux__)
+    if (m_useHugePages && size >= c_hugePageSize)
+    {
+      void* data = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+      if (data == MAP_FAILED)
+      {
+        throw std::bad_alloc();
+      }
+#if defined(MADV_HUGEPAGE)
+      madvise(data, size, MADV_HUGEPAGE);
+#endif
+      return static_cast<uint8_t*>(data);
+    }
+#endif
+    return static_cast<uint8_t*>(::operator new(size));
+  }
+
+  void BufferPool::Free(uint8_t* data, std::size_t size)
+  {
+#if defined(__linux__)
+    if (m_useHugePages && size >= c_hugePageSize)
+    {
+      munmap(data, size);
+      return;
+    }
+#endif
+    ::operator delete(data);
+  }
+
+  PooledBuffer BufferPool::Acquire(std::size_t size)
+  {
+    std::size_t sizeClass = 0;
+    while (sizeClass < c_numSizeClasses
+           && (std::size_t(1) << (sizeClass + c_minSizeClassShift)) < size)
+    {
+      ++sizeClass;
+    }
+    const std::size_t allocationSize
+        = sizeClass < c_numSizeClasses ? std::size_t(1) << (sizeClass + c_minSizeClassShift) : size;
+    const std::size_t node = GetCurrentNumaNode() % c_maxNumaNodes;
+
+    PooledBuffer buffer;
+    buffer.m_size = size;
+    buffer.m_sizeClass = sizeClass;
+    buffer.m_node = node;
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      if (sizeClass < c_numSizeClasses)
+      {
+        // A buffer from another node is still cheaper than a new allocation.
+        for (std::size_t i = 0; i < c_maxNumaNodes && buffer.m_data == nullptr; ++i)
+        {
+          auto& freeBuffers = m_freeBuffers[(node + i) % c_maxNumaNodes][sizeClass];
+          if (!freeBuffers.empty())
+          {
+            buffer.m_data = freeBuffers.back();
+            buffer.m_node = (node + i) % c_maxNumaNodes;
+            freeBuffers.pop_back();
+          }
+        }
+      }
+      m_statistics.BytesInUse += static_cast<int64_t>(allocationSize);
+      if (buffer.m_data != nullptr)
+      {
+        ++m_statistics.Hits;
+        m_statistics.CachedBytes -= static_cast<int64_t>(allocationSize);
+        buffer.m_pool = this;
+        return buffer;
+      }
+      ++m_statistics.Misses;
+      m_statistics.PeakBytes = std::max(
+          m_statistics.PeakBytes, m_statistics.BytesInUse + m_statistics.CachedBytes);
+    }
+
+    try
+    {
+      // Pages are placed on the node of the thread that first touches them, which is usually the
+      // one that acquired the buffer.
+      buffer.m_data = Allocate(allocationSize);
+    }
+    catch (...)
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      m_statistics.BytesInUse -= static_cast<int64_t>(allocationSize);
+      throw;
+    }
+    buffer.m_pool = this;
+    return buffer;
+  }
+
+  void BufferPool::Release(PooledBuffer& buffer)
+  {
+    const std::size_t allocationSize = buffer.m_sizeClass < c_numSizeClasses
+        ? std::size_t(1) << (buffer.m_sizeClass + c_minSizeClassShift)
+        : buffer.m_size;
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      m_statistics.BytesInUse -= static_cast<int64_t>(allocationSize);
+      if (buffer.m_sizeClass < c_numSizeClasses
+          && static_cast<std::size_t>(m_statistics.CachedBytes) + allocationSize
+              <= m_maxCachedBytes)
+      {
+        m_freeBuffers[buffer.m_node][buffer.m_sizeClass].push_back(buffer.m_data);
+        m_statistics.CachedBytes += static_cast<int64_t>(allocationSize);
+        return;
+      }
+    }
+    Free(buffer.m_data, allocationSize);
+  }
+
+  BufferPoolStatistics BufferPool::GetStatistics() const
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_statistics;
+  }
+
+  void BufferPool::Trim()
+  {
+    std::array<std::array<std::vector<uint8_t*>, c_numSizeClasses>, c_maxNumaNodes> freeBuffers;
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      std::swap(freeBuffers, m_freeBuffers);
+      m_statistics.CachedBytes = 0;
+    }
+    for (auto& node : freeBuffers)
+    {
+      for (std::size_t sizeClass = 0; sizeClass < c_numSizeClasses; ++sizeClass)
+      {
+        for (uint8_t* data : node[sizeClass])
+        {
+          Free(data, std::size_t(1) << (sizeClass + c_minSizeClassShift));
+        }
+      }
+    }
+  }
+
+}}} // namespace Azure::Storage::Details
@@ -0,0 +1,276 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/concurrent_transfer.hpp"
+
+#include "azure/storage/common/transfer_manager.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  namespace {
+    // Split points are rounded to this, so ranges stay aligned to file system blocks.
+    constexpr int64_t c_splitAlignment = 4 * 1024;
+
+    struct TransferState
+    {
+      std::function<void(ChunkRange&)> TransferFunc;
+      std::shared_ptr<Storage::TransferHandle> Handle;
+      int64_t Offset = 0;
+      int64_t Length = 0;
+      int64_t ChunkSize = 0;
+      int64_t NumChunks = 0;
+      int64_t MinSplitLength = 0;
+      std::atomic<int64_t> NextChunkId{0};
+      std::atomic<bool> Failed{false};
+
+      std::mutex Mutex;
+      std::condition_variable Cv;
+      // The number of pool tasks that are running, tasks that haven't started yet aren't waited
+      // for.
+      int NumWorkers = 0;
+      // Set once the calling thread has run out of chunks. Tasks that start afterwards have
+      // nothing to do.
+      bool Finished = false;
+      std::exception_ptr FirstException;
+      std::vector<ChunkRange*> InFlightRanges;
+
+      // Splits off the end of the in-flight range that's expected to finish last.
+      std::unique_ptr<ChunkRange> SplitSlowestRange()
+      {
+        std::lock_guard<std::mutex> guard(Mutex);
+        std::vector<std::pair<double, ChunkRange*>> candidates;
+        candidates.reserve(InFlightRanges.size());
+        for (auto range : InFlightRanges)
+        {
+          candidates.emplace_back(range->RemainingSeconds(), range);
+        }
+        std::sort(
+            candidates.begin(),
+            candidates.end(),
+            [](const std::pair<double, ChunkRange*>& lhs,
+               const std::pair<double, ChunkRange*>& rhs) { return lhs.first > rhs.first; });
+        for (const auto& candidate : candidates)
+        {
+          int64_t offset = 0;
+          int64_t length = 0;
+          if (candidate.second->Split(MinSplitLength, offset, length))
+          {
+            auto range = std::make_unique<ChunkRange>(
+                candidate.second->ChunkId(), offset, length, true);
+            InFlightRanges.push_back(range.get());
+            return range;
+          }
+        }
+        return nullptr;
+      }
+
+      // Runs one chunk, returns false if there's nothing left to do.
+      bool RunChunk()
+      {
+        if (Failed)
+        {
+          return false;
+        }
+        std::unique_ptr<ChunkRange> range;
+        // The bytes of a split-off range were already accounted for by the range it was split
+        // from.
+        int64_t chunkLength = 0;
+        int64_t chunkId = NextChunkId.fetch_add(1);
+        if (chunkId < NumChunks)
+        {
+          chunkLength = std::min(Length - ChunkSize * chunkId, ChunkSize);
+          range = std::make_unique<ChunkRange>(
+              chunkId, Offset + ChunkSize * chunkId, chunkLength, false);
+          std::lock_guard<std::mutex> guard(Mutex);
+          InFlightRanges.push_back(range.get());
+        }
+        else if (MinSplitLength > 0)
+        {
+          range = SplitSlowestRange();
+        }
+        if (!range)
+        {
+          return false;
+        }
+
+        bool succeeded = true;
+        try
+        {
+          TransferSlot slot(Handle, chunkLength);
+          TransferFunc(*range);
+          slot.Complete(range->ClaimedLength());
+        }
+        catch (...)
+        {
+          succeeded = false;
+          if (Failed.exchange(true) == false)
+          {
+            std::lock_guard<std::mutex> guard(Mutex);
+            FirstException = std::current_exception();
+          }
+        }
+        std::lock_guard<std::mutex> guard(Mutex);
+        InFlightRanges.erase(std::find(InFlightRanges.begin(), InFlightRanges.end(), range.get()));
+        return succeeded;
+      }
+    };
+
+    void RunOnThreadPool(std::shared_ptr<TransferState> state, bool requeue)
+    {
+      // Each task transfers a single chunk and then queues itself at the back of the shared
+      // queue, behind the tasks of other transfers, so transfers sharing the pool make progress in
+      // turn. Tasks of a paused transfer are put aside until it's resumed.
+      auto task = [state]() {
+        {
+          std::lock_guard<std::mutex> guard(state->Mutex);
+          if (state->Finished)
+          {
+            return;
+          }
+          ++state->NumWorkers;
+        }
+        const bool hasMoreChunks = state->RunChunk();
+        {
+          std::lock_guard<std::mutex> guard(state->Mutex);
+          if (--state->NumWorkers == 0)
+          {
+            state->Cv.notify_all();
+          }
+        }
+        if (hasMoreChunks)
+        {
+          RunOnThreadPool(state, true);
+        }
+      };
+      SubmitTransferTask(state->Handle, std::move(task), requeue);
+    }
+  } // namespace
+
+  int64_t ChunkRange::Claim(int64_t length)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    length = std::min(length, m_end - m_position);
+    m_position += length;
+    return length;
+  }
+
+  int64_t ChunkRange::End() const
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_end;
+  }
+
+  int64_t ChunkRange::ClaimedLength() const
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    return m_position - m_offset;
+  }
+
+  bool ChunkRange::Split(int64_t minLength, int64_t& offset, int64_t& length)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    int64_t splitOffset = m_position + (m_end - m_position) / 2;
+    splitOffset = (splitOffset + c_splitAlignment - 1) / c_splitAlignment * c_splitAlignment;
+    if (splitOffset - m_position < minLength || m_end - splitOffset < minLength)
+    {
+      return false;
+    }
+    offset = splitOffset;
+    length = m_end - splitOffset;
+    m_end = splitOffset;
+    return true;
+  }
+
+  double ChunkRange::RemainingSeconds() const
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - m_start);
+    const int64_t claimed = m_position - m_offset;
+    const int64_t unclaimed = m_end - m_position;
+    if (unclaimed == 0)
+    {
+      return 0.0;
+    }
+    if (claimed == 0)
+    {
+      // Hasn't started yet.
+      return std::numeric_limits<double>::infinity();
+    }
+    return static_cast<double>(unclaimed) * elapsed.count() / static_cast<double>(claimed);
+  }
+
+  void ConcurrentTransfer(
+      int64_t offset,
+      int64_t length,
+      int64_t chunkSize,
+      int concurrency,
+      std::function<void(ChunkRange&)> transferFunc,
+      int64_t minSplitLength,
+      std::shared_ptr<TransferHandle> transferHandle)
+  {
+    auto state = std::make_shared<TransferState>();
+    state->TransferFunc = std::move(transferFunc);
+    state->Handle = std::move(transferHandle);
+    state->Offset = offset;
+    state->Length = length;
+    state->ChunkSize = chunkSize;
+    state->NumChunks = (length + chunkSize - 1) / chunkSize;
+    state->MinSplitLength = minSplitLength;
+
+    // The calling thread is one of the workers, so a transfer always makes progress even if the
+    // thread pool is saturated.
+    int numPoolWorkers
+        = static_cast<int>(std::min<int64_t>(std::max(concurrency, 1) - 1, state->NumChunks - 1));
+    for (int i = 0; i < numPoolWorkers; ++i)
+    {
+      RunOnThreadPool(state, false);
+    }
+
+    while (state->RunChunk())
+    {
+    }
+
+    // Every chunk has been started. Only the tasks that are running are waited for, the ones still
+    // queued are abandoned, since the pool may be too busy to ever start them.
+    std::unique_lock<std::mutex> guard(state->Mutex);
+    state->Finished = true;
+    state->Cv.wait(guard, [&state]() { return state->NumWorkers == 0; });
+    if (state->FirstException)
+    {
+      std::rethrow_exception(state->FirstException);
+    }
+  }
+
+  void ConcurrentTransfer(
+      int64_t offset,
+      int64_t length,
+      int64_t chunkSize,
+      int concurrency,
+      std::function<void(int64_t, int64_t, int64_t, int64_t)> transferFunc,
+      std::shared_ptr<TransferHandle> transferHandle)
+  {
+    const int64_t numChunks = (length + chunkSize - 1) / chunkSize;
+    ConcurrentTransfer(
+        offset,
+        length,
+        chunkSize,
+        concurrency,
+        [&transferFunc, numChunks](ChunkRange& range) {
+          const int64_t chunkOffset = range.Offset();
+          const int64_t chunkLength = range.Claim(std::numeric_limits<int64_t>::max());
+          transferFunc(chunkOffset, chunkLength, range.ChunkId(), numChunks);
+        },
+        0,
+        std::move(transferHandle));
+  }
+
+}}} // namespace Azure::Storage::Details
@@ -0,0 +1,83 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/content_defined_chunker.hpp"
+
+#include <algorithm>
+#include <array>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  namespace {
+    // The hash shifts left by one bit per byte, so it only depends on the last 64 bytes.
+    constexpr int64_t c_hashWindow = 64;
+
+    // Boundaries depend on this table, it must never change.
+    const std::array<uint64_t, 256>& GearTable()
+    {
+      static const std::array<uint64_t, 256> table = [] {
+        std::array<uint64_t, 256> t;
+        // SplitMix64
+        uint64_t state = 0x6A09E667F3BCC908ULL;
+        for (auto& entry : t)
+        {
+          state += 0x9E3779B97F4A7C15ULL;
+          uint64_t z = state;
+          z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+          z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+          entry = z ^ (z >> 31);
+        }
+        return t;
+      }();
+      return table;
+    }
+  } // namespace
+
+  ContentDefinedChunker::ContentDefinedChunker(
+      int64_t minSize,
+      int64_t averageSize,
+      int64_t maxSize)
+      : m_minSize(std::max<int64_t>(minSize, 1)), m_maxSize(std::max(maxSize, m_minSize))
+  {
+    int bits = 0;
+    while (bits < 63 && (int64_t(2) << bits) <= averageSize)
+    {
+      ++bits;
+    }
+    // The low bits of the hash only depend on the last few bytes, the high bits are used.
+    if (bits > 0)
+    {
+      m_mask = ((uint64_t(1) << bits) - 1) << (64 - bits);
+    }
+  }
+
+  int64_t ContentDefinedChunker::FindBoundary(const uint8_t* data, int64_t length)
+  {
+    const auto& gearTable = GearTable();
+    int64_t i = 0;
+    while (i < length)
+    {
+      // A chunk can't end before its minimum size, so the bytes that would be shifted out of the
+      // hash by then aren't hashed at all.
+      const int64_t skip = std::min(length - i, m_minSize - c_hashWindow - m_chunkLength);
+      if (skip > 0)
+      {
+        i += skip;
+        m_chunkLength += skip;
+        continue;
+      }
+
+      m_hash = (m_hash << 1) + gearTable[data[i]];
+      ++i;
+      ++m_chunkLength;
+      if ((m_chunkLength >= m_minSize && (m_hash & m_mask) == 0) || m_chunkLength >= m_maxSize)
+      {
+        m_hash = 0;
+        m_chunkLength = 0;
+        return i;
+      }
+    }
+    return -1;
+  }
+
+}}} // namespace Azure::Storage::Details
@@ -7,15 +7,43 @@
 #include <Windows.h>
 #include <bcrypt.h>
 #else
-#include <openssl/bio.h>
-#include <openssl/buffer.h>
 #include <openssl/evp.h>
 #include <openssl/hmac.h>
 #include <openssl/md5.h>
 #include <openssl/sha.h>
 #endif
 
+#if defined(__x86_64__) || defined(_M_X64)
+#define AZURE_STORAGE_CRC64_CLMUL_X86
+#define AZURE_STORAGE_MD5_AVX2
+#define AZURE_STORAGE_BASE64_SSSE3
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#include <immintrin.h>
+#if defined(__GNUC__) || defined(__clang__)
+#define AZURE_STORAGE_CRC64_TARGET __attribute__((target("pclmul")))
+#define AZURE_STORAGE_MD5_TARGET __attribute__((target("avx2")))
+#define AZURE_STORAGE_BASE64_TARGET __attribute__((target("ssse3")))
+#endif
+#elif defined(__aarch64__) && (defined(__ARM_FEATURE_CRYPTO) || defined(__ARM_FEATURE_AES))
+#define AZURE_STORAGE_CRC64_PMULL_ARM
+#include <arm_neon.h>
+#endif
+#if !defined(AZURE_STORAGE_CRC64_TARGET)
+#define AZURE_STORAGE_CRC64_TARGET
+#endif
+#if !defined(AZURE_STORAGE_MD5_TARGET)
+#define AZURE_STORAGE_MD5_TARGET
+#endif
+#if !defined(AZURE_STORAGE_BASE64_TARGET)
+#define AZURE_STORAGE_BASE64_TARGET
+#endif
+
 #include <algorithm>
+#include <array>
+#include <memory>
+#include <new>
 #include <stdexcept>
 #include <vector>
 
@@ -237,6 +265,88 @@ namespace Azure { namespace Storage {
 
       return hash;
     }
+
+    struct HmacSha256ContextImpl
+    {
+      std::string buffer;
+      BCRYPT_HASH_HANDLE hashHandle = nullptr;
+      std::size_t contextSize = 0;
+      std::size_t hashLength = 0;
+    };
+
+    HmacSha256Context::HmacSha256Context(const std::string& key)
+    {
+      static AlgorithmProviderInstance AlgorithmProvider(AlgorithmType::HmacSha256);
+
+      HmacSha256ContextImpl* context = new HmacSha256ContextImpl;
+      m_context = context;
+      context->buffer.resize(AlgorithmProvider.ContextSize);
+      context->contextSize = AlgorithmProvider.ContextSize;
+      context->hashLength = AlgorithmProvider.HashLength;
+
+      NTSTATUS status = BCryptCreateHash(
+          AlgorithmProvider.Handle,
+          &context->hashHandle,
+          reinterpret_cast<PUCHAR>(&context->buffer[0]),
+          static_cast<ULONG>(context->buffer.size()),
+          reinterpret_cast<PUCHAR>(const_cast<char*>(&key[0])),
+          static_cast<ULONG>(key.length()),
+          0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        delete context;
+        throw std::runtime_error("BCryptCreateHash failed");
+      }
+    }
+
+    HmacSha256Context::~HmacSha256Context()
+    {
+      HmacSha256ContextImpl* context = static_cast<HmacSha256ContextImpl*>(m_context);
+      BCryptDestroyHash(context->hashHandle);
+      delete context;
+    }
+
+    std::string HmacSha256Context::Sign(const std::string& text) const
+    {
+      const HmacSha256ContextImpl* context = static_cast<const HmacSha256ContextImpl*>(m_context);
+
+      // The keyed hash object is never fed any data, each signature works on a duplicate of it.
+      std::string buffer;
+      buffer.resize(context->contextSize);
+      BCRYPT_HASH_HANDLE hashHandle;
+      NTSTATUS status = BCryptDuplicateHash(
+          context->hashHandle,
+          &hashHandle,
+          reinterpret_cast<PUCHAR>(&buffer[0]),
+          static_cast<ULONG>(buffer.size()),
+          0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptDuplicateHash failed");
+      }
+
+      status = BCryptHashData(
+          hashHandle,
+          reinterpret_cast<PBYTE>(const_cast<char*>(&text[0])),
+          static_cast<ULONG>(text.length()),
+          0);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        BCryptDestroyHash(hashHandle);
+        throw std::runtime_error("BCryptHashData failed");
+      }
+
+      std::string hash;
+      hash.resize(context->hashLength);
+      status = BCryptFinishHash(
+          hashHandle, reinterpret_cast<PUCHAR>(&hash[0]), static_cast<ULONG>(hash.length()), 0);
+      BCryptDestroyHash(hashHandle);
+      if (!BCRYPT_SUCCESS(status))
+      {
+        throw std::runtime_error("BCryptFinishHash failed");
+      }
+      return hash;
+    }
   } // namespace Details
 
   struct Md5HashContext
@@ -308,43 +418,6 @@ namespace Azure { namespace Storage {
     return hash;
   }
 
-  std::string Base64Encode(const std::string& text)
-  {
-    std::string encoded;
-    // According to RFC 4648, the encoded length should be ceiling(n / 3) * 4
-    DWORD encodedLength = static_cast<DWORD>((text.length() + 2) / 3 * 4);
-    encoded.resize(encodedLength);
-
-    CryptBinaryToStringA(
-        reinterpret_cast<const BYTE*>(text.data()),
-        static_cast<DWORD>(text.length()),
-        CRYPT_STRING_BASE64 | CRYPT_STRING_NOCRLF,
-        static_cast<LPSTR>(&encoded[0]),
-        &encodedLength);
-
-    return encoded;
-  }
-
-  std::string Base64Decode(const std::string& text)
-  {
-    std::string decoded;
-    // According to RFC 4648, the encoded length should be ceiling(n / 3) * 4, so we can infer an
-    // upper bound here
-    DWORD decodedLength = DWORD(text.length() / 4 * 3);
-    decoded.resize(decodedLength);
-
-    CryptStringToBinaryA(
-        text.data(),
-        static_cast<DWORD>(text.length()),
-        CRYPT_STRING_BASE64 | CRYPT_STRING_STRICT,
-        reinterpret_cast<BYTE*>(&decoded[0]),
-        &decodedLength,
-        nullptr,
-        nullptr);
-    decoded.resize(decodedLength);
-    return decoded;
-  }
-
 #else
 
   namespace Details {
@@ -375,6 +448,90 @@ namespace Azure { namespace Storage {
       return std::string(hash, hashLength);
     }
 
+    namespace {
+      struct EvpMdCtxDeleter
+      {
+        void operator()(EVP_MD_CTX* context) const { EVP_MD_CTX_free(context); }
+      };
+      using EvpMdCtxPtr = std::unique_ptr<EVP_MD_CTX, EvpMdCtxDeleter>;
+
+      EvpMdCtxPtr NewEvpMdCtx()
+      {
+        EvpMdCtxPtr context(EVP_MD_CTX_new());
+        if (!context)
+        {
+          throw std::bad_alloc();
+        }
+        return context;
+      }
+    } // namespace
+
+    struct HmacSha256ContextImpl
+    {
+      // SHA256 states that have already absorbed the inner and outer padded keys, copied for every
+      // signature.
+      EvpMdCtxPtr Inner;
+      EvpMdCtxPtr Outer;
+    };
+
+    HmacSha256Context::HmacSha256Context(const std::string& key)
+    {
+      // RFC 2104: keys longer than the block size are hashed first, shorter ones are zero padded.
+      unsigned char paddedKey[SHA256_CBLOCK] = {};
+      if (key.length() > sizeof(paddedKey))
+      {
+        SHA256(reinterpret_cast<const unsigned char*>(key.data()), key.length(), paddedKey);
+      }
+      else
+      {
+        std::copy(key.begin(), key.end(), paddedKey);
+      }
+
+      unsigned char innerPad[SHA256_CBLOCK];
+      unsigned char outerPad[SHA256_CBLOCK];
+      for (std::size_t i = 0; i < sizeof(paddedKey); ++i)
+      {
+        innerPad[i] = static_cast<unsigned char>(paddedKey[i] ^ 0x36);
+        outerPad[i] = static_cast<unsigned char>(paddedKey[i] ^ 0x5c);
+      }
+
+      auto context = std::make_unique<HmacSha256ContextImpl>();
+      context->Inner = NewEvpMdCtx();
+      context->Outer = NewEvpMdCtx();
+      if (EVP_DigestInit_ex(context->Inner.get(), EVP_sha256(), nullptr) != 1
+          || EVP_DigestUpdate(context->Inner.get(), innerPad, sizeof(innerPad)) != 1
+          || EVP_DigestInit_ex(context->Outer.get(), EVP_sha256(), nullptr) != 1
+          || EVP_DigestUpdate(context->Outer.get(), outerPad, sizeof(outerPad)) != 1)
+      {
+        throw std::runtime_error("failed to initialize hmac-sha256 context");
+      }
+      m_context = context.release();
+    }
+
+    HmacSha256Context::~HmacSha256Context()
+    {
+      delete static_cast<HmacSha256ContextImpl*>(m_context);
+    }
+
+    std::string HmacSha256Context::Sign(const std::string& text) const
+    {
+      const HmacSha256ContextImpl* context = static_cast<const HmacSha256ContextImpl*>(m_context);
+
+      unsigned char hash[SHA256_DIGEST_LENGTH];
+      unsigned int hashLength = 0;
+      auto digest = NewEvpMdCtx();
+      if (EVP_MD_CTX_copy_ex(digest.get(), context->Inner.get()) != 1
+          || EVP_DigestUpdate(digest.get(), text.data(), text.length()) != 1
+          || EVP_DigestFinal_ex(digest.get(), hash, &hashLength) != 1
+          || EVP_MD_CTX_copy_ex(digest.get(), context->Outer.get()) != 1
+          || EVP_DigestUpdate(digest.get(), hash, sizeof(hash)) != 1
+          || EVP_DigestFinal_ex(digest.get(), hash, &hashLength) != 1)
+      {
+        throw std::runtime_error("failed to compute hmac-sha256");
+      }
+      return std::string(std::begin(hash), std::end(hash));
+    }
+
   } // namespace Details
 
   Md5::Md5()
@@ -404,41 +561,305 @@ namespace Azure { namespace Storage {
     return std::string(std::begin(hash), std::end(hash));
   }
 
+#endif
+
+  namespace {
+    constexpr char Base64EncodeTable[]
+        = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+    // Maps a character to its 6-bit value, or to -1 if it isn't part of the alphabet.
+    const int8_t* GetBase64DecodeTable()
+    {
+      static const auto table = []() {
+        std::array<int8_t, 256> t;
+        t.fill(-1);
+        for (int i = 0; i < 64; ++i)
+        {
+          t[static_cast<uint8_t>(Base64EncodeTable[i])] = static_cast<int8_t>(i);
+        }
+        return t;
+      }();
+      return table.data();
+    }
+
+    std::size_t Base64EncodeScalar(const uint8_t* data, std::size_t length, char* buffer)
+    {
+      char* out = buffer;
+      std::size_t i = 0;
+      for (; i + 3 <= length; i += 3)
+      {
+        uint32_t v = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8) | data[i + 2];
+        *out++ = Base64EncodeTable[(v >> 18) & 0x3f];
+        *out++ = Base64EncodeTable[(v >> 12) & 0x3f];
+        *out++ = Base64EncodeTable[(v >> 6) & 0x3f];
+        *out++ = Base64EncodeTable[v & 0x3f];
+      }
+      if (i + 1 == length)
+      {
+        uint32_t v = uint32_t(data[i]) << 16;
+        *out++ = Base64EncodeTable[(v >> 18) & 0x3f];
+        *out++ = Base64EncodeTable[(v >> 12) & 0x3f];
+        *out++ = '=';
+        *out++ = '=';
+      }
+      else if (i + 2 == length)
+      {
+        uint32_t v = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8);
+        *out++ = Base64EncodeTable[(v >> 18) & 0x3f];
+        *out++ = Base64EncodeTable[(v >> 12) & 0x3f];
+        *out++ = Base64EncodeTable[(v >> 6) & 0x3f];
+        *out++ = '=';
+      }
+      return static_cast<std::size_t>(out - buffer);
+    }
+
+    [[noreturn]] void ThrowInvalidBase64()
+    {
+      throw std::runtime_error("invalid base64 encoded string");
+    }
+
+    // Decodes a complete, unpadded run of characters whose length is a multiple of 4.
+    std::size_t Base64DecodeScalar(const char* text, std::size_t length, uint8_t* buffer)
+    {
+      const int8_t* table = GetBase64DecodeTable();
+      uint8_t* out = buffer;
+      for (std::size_t i = 0; i < length; i += 4)
+      {
+        int32_t a = table[static_cast<uint8_t>(text[i])];
+        int32_t b = table[static_cast<uint8_t>(text[i + 1])];
+        int32_t c = table[static_cast<uint8_t>(text[i + 2])];
+        int32_t d = table[static_cast<uint8_t>(text[i + 3])];
+        if ((a | b | c | d) < 0)
+        {
+          ThrowInvalidBase64();
+        }
+        uint32_t v = (uint32_t(a) << 18) | (uint32_t(b) << 12) | (uint32_t(c) << 6) | uint32_t(d);
+        *out++ = static_cast<uint8_t>(v >> 16);
+        *out++ = static_cast<uint8_t>(v >> 8);
+        *out++ = static_cast<uint8_t>(v);
+      }
+      return static_cast<std::size_t>(out - buffer);
+    }
+
+#if defined(AZURE_STORAGE_BASE64_SSSE3)
+    // The SSSE3 kernels follow Wojciech Mula's vectorized base64 algorithms: every 12 input bytes
+    // are shuffled into 16 lanes of 6-bit indices, which are translated to ASCII with a nibble
+    // lookup, and the reverse for decoding.
+    AZURE_STORAGE_BASE64_TARGET std::size_t Base64EncodeSsse3(
+        const uint8_t* data,
+        std::size_t length,
+        char* buffer)
+    {
+      const __m128i shuffle = _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1);
+      const __m128i shiftLut = _mm_setr_epi8(
+          'a' - 26,
+          '0' - 52,
+          '0' - 52,
+          '0' - 52,
+          '0' - 52,
+          '0' - 52,
+          '0' - 52,
+          '0' - 52,
+          '0' - 52,
+          '0' - 52,
+          '0' - 52,
+          '+' - 62,
+          '/' - 63,
+          'A',
+          0,
+          0);
+
+      std::size_t i = 0;
+      char* out = buffer;
+      // Each iteration reads 16 bytes but only consumes 12.
+      for (; i + 16 <= length; i += 12)
+      {
+        __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + i));
+        in = _mm_shuffle_epi8(in, shuffle);
+        const __m128i t0 = _mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00));
+        const __m128i t1 = _mm_mulhi_epu16(t0, _mm_set1_epi32(0x04000040));
+        const __m128i t2 = _mm_and_si128(in, _mm_set1_epi32(0x003f03f0));
+        const __m128i t3 = _mm_mullo_epi16(t2, _mm_set1_epi32(0x01000010));
+        const __m128i indices = _mm_or_si128(t1, t3);
+
+        __m128i result = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+        const __m128i less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+        result = _mm_or_si128(result, _mm_and_si128(less, _mm_set1_epi8(13)));
+        result = _mm_add_epi8(_mm_shuffle_epi8(shiftLut, result), indices);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), result);
+        out += 16;
+      }
+      out += Base64EncodeScalar(data + i, length - i, out);
+      return static_cast<std::size_t>(out - buffer);
+    }
+
+    // Decodes as many 16-character groups as possible, leaving at least 8 characters so that
+    // padding is handled by the scalar code and the 16-byte stores stay inside the buffer. Returns
+    // the number of characters consumed.
+    AZURE_STORAGE_BASE64_TARGET std::size_t Base64DecodeSsse3(
+        const char* text,
+        std::size_t length,
+        uint8_t* buffer)
+    {
+      const __m128i lutLo = _mm_setr_epi8(
+          0x15,
+          0x11,
+          0x11,
+          0x11,
+          0x11,
+          0x11,
+          0x11,
+          0x11,
+          0x11,
+          0x11,
+          0x13,
+          0x1a,
+          0x1b,
+          0x1b,
+          0x1b,
+          0x1a);
+      const __m128i lutHi = _mm_setr_epi8(
+          0x10,
+          0x10,
+          0x01,
+          0x02,
+          0x04,
+          0x08,
+          0x04,
+          0x08,
+          0x10,
+          0x10,
+          0x10,
+          0x10,
+          0x10,
+          0x10,
+          0x10,
+          0x10);
+      const __m128i lutRoll = _mm_setr_epi8(
+          0,
+          16,
+          19,
+          4,
+          -65,
+          -65,
+          -71,
+          -71,
+          0,
+          0,
+          0,
+          0,
+          0,
+          0,
+          0,
+          0);
+      const __m128i nibbleMask = _mm_set1_epi8(0x0f);
+      const __m128i pack
+          = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+      std::size_t i = 0;
+      uint8_t* out = buffer;
+      for (; i + 24 <= length; i += 16)
+      {
+        const __m128i in = _mm_loadu_si128(reinterpret_cast<const __m128i*>(text + i));
+        const __m128i hiNibbles = _mm_and_si128(_mm_srli_epi32(in, 4), nibbleMask);
+        const __m128i loNibbles = _mm_and_si128(in, nibbleMask);
+        const __m128i lo = _mm_shuffle_epi8(lutLo, loNibbles);
+        const __m128i hi = _mm_shuffle_epi8(lutHi, hiNibbles);
+        if (_mm_movemask_epi8(_mm_cmpgt_epi8(_mm_and_si128(lo, hi), _mm_setzero_si128())) != 0)
+        {
+          ThrowInvalidBase64();
+        }
+        const __m128i eq2f = _mm_cmpeq_epi8(in, _mm_set1_epi8(0x2f));
+        const __m128i roll = _mm_shuffle_epi8(lutRoll, _mm_add_epi8(eq2f, hiNibbles));
+        const __m128i values = _mm_add_epi8(in, roll);
+
+        const __m128i merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+        const __m128i packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out), _mm_shuffle_epi8(packed, pack));
+        out += 12;
+      }
+      return i;
+    }
+
+    bool Base64Ssse3Supported()
+    {
+#if defined(_MSC_VER)
+      int cpuInfo[4];
+      __cpuid(cpuInfo, 1);
+      return (cpuInfo[2] & (1 << 9)) != 0;
+#else
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("ssse3") != 0;
+#endif
+    }
+#endif
+  } // namespace
+
+  std::size_t Base64EncodeTo(const uint8_t* data, std::size_t length, char* buffer)
+  {
+#if defined(AZURE_STORAGE_BASE64_SSSE3)
+    static const bool ssse3Supported = Base64Ssse3Supported();
+    if (ssse3Supported)
+    {
+      return Base64EncodeSsse3(data, length, buffer);
+    }
+#endif
+    return Base64EncodeScalar(data, length, buffer);
+  }
+
+  void Base64EncodeTo(const uint8_t* data, std::size_t length, std::string& output)
+  {
+    const std::size_t offset = output.length();
+    output.resize(offset + Base64EncodedLength(length));
+    Base64EncodeTo(data, length, &output[offset]);
+  }
+
   std::string Base64Encode(const std::string& text)
   {
-    BIO* bio = BIO_new(BIO_s_mem());
-    bio = BIO_push(BIO_new(BIO_f_base64()), bio);
-    BIO_set_flags(bio, BIO_FLAGS_BASE64_NO_NL);
-    BIO_write(bio, text.data(), static_cast<int>(text.length()));
-    BIO_flush(bio);
-    BUF_MEM* bufferPtr;
-    BIO_get_mem_ptr(bio, &bufferPtr);
-    BIO_set_close(bio, BIO_NOCLOSE);
-    BIO_free_all(bio);
-
-    return std::string(bufferPtr->data, bufferPtr->length);
+    std::string encoded;
+    Base64EncodeTo(reinterpret_cast<const uint8_t*>(text.data()), text.length(), encoded);
+    return encoded;
   }
 
   std::string Base64Decode(const std::string& text)
   {
+    std::size_t length = text.length();
+    if (length % 4 == 0 && length != 0 && text[length - 1] == '=')
+    {
+      length -= text[length - 2] == '=' ? 2 : 1;
+    }
+    if (length % 4 == 1)
+    {
+      ThrowInvalidBase64();
+    }
+
     std::string decoded;
-    // According to RFC 4648, the encoded length should be ceiling(n / 3) * 4, so we can infer an
-    // upper bound here
-    std::size_t maxDecodedLength = text.length() / 4 * 3;
-    decoded.resize(maxDecodedLength);
-
-    BIO* bio = BIO_new_mem_buf(text.data(), -1);
-    bio = BIO_push(BIO_new(BIO_f_base64()), bio);
-    BIO_set_flags(bio, BIO_FLAGS_BASE64_NO_NL);
-    int decodedLength = BIO_read(bio, &decoded[0], static_cast<int>(text.length()));
-    BIO_free_all(bio);
-
-    decoded.resize(decodedLength);
+    decoded.resize(length / 4 * 3 + (length % 4 == 0 ? 0 : length % 4 - 1));
+    uint8_t* out = reinterpret_cast<uint8_t*>(&decoded[0]);
+    std::size_t consumed = 0;
+#if defined(AZURE_STORAGE_BASE64_SSSE3)
+    static const bool ssse3Supported = Base64Ssse3Supported();
+    if (ssse3Supported)
+    {
+      consumed = Base64DecodeSsse3(text.data(), length, out);
+      out += consumed / 4 * 3;
+    }
+#endif
+    const std::size_t fullLength = length / 4 * 4;
+    out += Base64DecodeScalar(text.data() + consumed, fullLength - consumed, out);
+
+    // The last group of 2 or 3 characters, which was followed by padding or left unpadded.
+    if (fullLength != length)
+    {
+      char lastGroup[4] = {'A', 'A', 'A', 'A'};
+      std::copy(text.begin() + fullLength, text.begin() + length, lastGroup);
+      uint8_t lastBytes[3];
+      Base64DecodeScalar(lastGroup, 4, lastBytes);
+      std::copy(lastBytes, lastBytes + length - fullLength - 1, out);
+    }
     return decoded;
   }
 
-#endif
-
   static constexpr uint64_t Crc64Poly = 0x9A6C9329AC4BC9B5ULL;
   static constexpr uint64_t Crc64MU1[] = {
       0x0000000000000000ULL, 0x7f6ef0c830358979ULL, 0xfedde190606b12f2ULL, 0x81b31158505e9b8bULL,
@@ -1070,12 +1491,8 @@ namespace Azure { namespace Storage {
     return vr[0] ^ vr[1];
   }
 
-  void Crc64::Update(const uint8_t* data, std::size_t length)
+  static uint64_t Crc64UpdateTable(uint64_t uCrc, const uint8_t* data, std::size_t length)
   {
-    m_length += length;
-
-    uint64_t uCrc = m_context ^ ~0ULL;
-
     uint64_t pData = 0;
 
     size_t uStop = length - (length % 32);
@@ -1215,7 +1632,164 @@ namespace Azure { namespace Storage {
     {
       uCrc = (uCrc >> 8) ^ Crc64MU1[(uCrc ^ data[pData]) & 0xff];
     }
-    m_context = uCrc ^ ~0ULL;
+    return uCrc;
+  }
+
+#if defined(AZURE_STORAGE_CRC64_CLMUL_X86) || defined(AZURE_STORAGE_CRC64_PMULL_ARM)
+  /*
+   * Carry-less multiplication folding, as described in Intel's "Fast CRC Computation for Generic
+   * Polynomials Using PCLMULQDQ Instruction". Eight 128-bit lanes are folded 128 bytes at a time,
+   * then merged into a single lane, which is reduced to 64 bits with the table. Each pair of
+   * constants folds a 128-bit value across the given distance so that its CRC stays the same.
+   */
+  static constexpr uint64_t Crc64FoldBy128[] = {0xa1ca681e733f9c40ULL, 0x5f852fb61e8d92dcULL};
+  static constexpr uint64_t Crc64FoldBy16[] = {0xeadc41fd2ba3d420ULL, 0x21e9761e252621acULL};
+  static constexpr uint64_t Crc64MergeLanes[][2] = {
+      {0xd083dd594d96319dULL, 0x946588403d4adcbcULL}, // 112 bytes
+      {0x3c255f5ebc414423ULL, 0x34f5a24e22d66e90ULL}, // 96 bytes
+      {0x7b0ab10dd0f809feULL, 0x03363823e6e791e5ULL}, // 80 bytes
+      {0x0c32cdb31e18a84aULL, 0x62242240ace5045aULL}, // 64 bytes
+      {0xbdd7ac0ee1a4a0f0ULL, 0xa3ffdc1fe8e82a8bULL}, // 48 bytes
+      {0xb0bc2e589204f500ULL, 0xe1e0bb9d45d7a44cULL}, // 32 bytes
+      {0xeadc41fd2ba3d420ULL, 0x21e9761e252621acULL}, // 16 bytes
+  };
+
+#if defined(AZURE_STORAGE_CRC64_CLMUL_X86)
+  using Crc64Vector = __m128i;
+
+  AZURE_STORAGE_CRC64_TARGET static inline Crc64Vector Crc64Load(const uint8_t* data)
+  {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+  }
+
+  AZURE_STORAGE_CRC64_TARGET static inline void Crc64Store(uint8_t* data, Crc64Vector x)
+  {
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data), x);
+  }
+
+  AZURE_STORAGE_CRC64_TARGET static inline Crc64Vector Crc64Xor(Crc64Vector a, Crc64Vector b)
+  {
+    return _mm_xor_si128(a, b);
+  }
+
+  AZURE_STORAGE_CRC64_TARGET static inline Crc64Vector Crc64FromCrc(uint64_t crc)
+  {
+    return _mm_set_epi64x(0, static_cast<int64_t>(crc));
+  }
+
+  AZURE_STORAGE_CRC64_TARGET static inline Crc64Vector Crc64Fold(Crc64Vector x, const uint64_t* k)
+  {
+    const __m128i kv = _mm_set_epi64x(static_cast<int64_t>(k[1]), static_cast<int64_t>(k[0]));
+    return _mm_xor_si128(_mm_clmulepi64_si128(x, kv, 0x00), _mm_clmulepi64_si128(x, kv, 0x11));
+  }
+
+  static bool Crc64ClmulSupported()
+  {
+#if defined(_MSC_VER)
+    int cpuInfo[4];
+    __cpuid(cpuInfo, 1);
+    return (cpuInfo[2] & (1 << 1)) != 0;
+#else
+    __builtin_cpu_init();
+    return __builtin_cpu_supports("pclmul") != 0;
+#endif
+  }
+#else
+  using Crc64Vector = uint8x16_t;
+
+  static inline Crc64Vector Crc64Load(const uint8_t* data) { return vld1q_u8(data); }
+
+  static inline void Crc64Store(uint8_t* data, Crc64Vector x) { vst1q_u8(data, x); }
+
+  static inline Crc64Vector Crc64Xor(Crc64Vector a, Crc64Vector b) { return veorq_u8(a, b); }
+
+  static inline Crc64Vector Crc64FromCrc(uint64_t crc)
+  {
+    return vreinterpretq_u8_u64(vcombine_u64(vcreate_u64(crc), vcreate_u64(0)));
+  }
+
+  static inline Crc64Vector Crc64Fold(Crc64Vector x, const uint64_t* k)
+  {
+    uint64x2_t x64 = vreinterpretq_u64_u8(x);
+    poly128_t lo = vmull_p64(vgetq_lane_u64(x64, 0), k[0]);
+    poly128_t hi = vmull_p64(vgetq_lane_u64(x64, 1), k[1]);
+    return veorq_u8(vreinterpretq_u8_p128(lo), vreinterpretq_u8_p128(hi));
+  }
+
+  // PMULL is guaranteed by the compile-time target.
+  static bool Crc64ClmulSupported() { return true; }
+#endif
+
+  AZURE_STORAGE_CRC64_TARGET static uint64_t Crc64UpdateClmul(
+      uint64_t uCrc,
+      const uint8_t* data,
+      std::size_t length)
+  {
+    constexpr std::size_t c_numLanes = 8;
+    constexpr std::size_t c_laneSize = 16;
+    constexpr std::size_t c_stride = c_numLanes * c_laneSize;
+    if (length < c_stride)
+    {
+      return Crc64UpdateTable(uCrc, data, length);
+    }
+
+    Crc64Vector x[c_numLanes];
+    for (std::size_t i = 0; i < c_numLanes; ++i)
+    {
+      x[i] = Crc64Load(data + i * c_laneSize);
+    }
+    x[0] = Crc64Xor(x[0], Crc64FromCrc(uCrc));
+    data += c_stride;
+    length -= c_stride;
+
+    while (length >= c_stride)
+    {
+      for (std::size_t i = 0; i < c_numLanes; ++i)
+      {
+        x[i] = Crc64Xor(Crc64Fold(x[i], Crc64FoldBy128), Crc64Load(data + i * c_laneSize));
+      }
+      data += c_stride;
+      length -= c_stride;
+    }
+
+    Crc64Vector r = x[c_numLanes - 1];
+    for (std::size_t i = 0; i < c_numLanes - 1; ++i)
+    {
+      r = Crc64Xor(r, Crc64Fold(x[i], Crc64MergeLanes[i]));
+    }
+    while (length >= c_laneSize)
+    {
+      r = Crc64Xor(Crc64Fold(r, Crc64FoldBy16), Crc64Load(data));
+      data += c_laneSize;
+      length -= c_laneSize;
+    }
+
+    uint8_t remainder[c_laneSize];
+    Crc64Store(remainder, r);
+    uCrc = Crc64UpdateTable(0, remainder, c_laneSize);
+    return Crc64UpdateTable(uCrc, data, length);
+  }
+#endif
+
+  using Crc64UpdateFunc = uint64_t (*)(uint64_t, const uint8_t*, std::size_t);
+
+  static Crc64UpdateFunc GetCrc64UpdateFunc()
+  {
+#if defined(AZURE_STORAGE_CRC64_CLMUL_X86) || defined(AZURE_STORAGE_CRC64_PMULL_ARM)
+    if (Crc64ClmulSupported())
+    {
+      return Crc64UpdateClmul;
+    }
+#endif
+    return Crc64UpdateTable;
+  }
+
+  void Crc64::Update(const uint8_t* data, std::size_t length)
+  {
+    m_length += length;
+
+    static const auto updateFunc = GetCrc64UpdateFunc();
+    m_context = updateFunc(m_context ^ ~0ULL, data, length) ^ ~0ULL;
   }
 
   void Crc64::Concatenate(const Crc64& other)
@@ -1258,4 +1832,235 @@ namespace Azure { namespace Storage {
     return binary;
   }
 
+#if defined(AZURE_STORAGE_MD5_AVX2)
+  namespace {
+    constexpr uint32_t Md5K[64] = {
+        0xd76aa478, 0xe8c7b756, 0x242070db, 0xc1bdceee, 0xf57c0faf, 0x4787c62a, 0xa8304613,
+        0xfd469501, 0x698098d8, 0x8b44f7af, 0xffff5bb1, 0x895cd7be, 0x6b901122, 0xfd987193,
+        0xa679438e, 0x49b40821, 0xf61e2562, 0xc040b340, 0x265e5a51, 0xe9b6c7aa, 0xd62f105d,
+        0x02441453, 0xd8a1e681, 0xe7d3fbc8, 0x21e1cde6, 0xc33707d6, 0xf4d50d87, 0x455a14ed,
+        0xa9e3e905, 0xfcefa3f8, 0x676f02d9, 0x8d2a4c8a, 0xfffa3942, 0x8771f681, 0x6d9d6122,
+        0xfde5380c, 0xa4beea44, 0x4bdecfa9, 0xf6bb4b60, 0xbebfbc70, 0x289b7ec6, 0xeaa127fa,
+        0xd4ef3085, 0x04881d05, 0xd9d4d039, 0xe6db99e5, 0x1fa27cf8, 0xc4ac5665, 0xf4292244,
+        0x432aff97, 0xab9423a7, 0xfc93a039, 0x655b59c3, 0x8f0ccc92, 0xffeff47d, 0x85845dd1,
+        0x6fa87e4f, 0xfe2ce6e0, 0xa3014314, 0x4e0811a1, 0xf7537e82, 0xbd3af235, 0x2ad7d2bb,
+        0xeb86d391,
+    };
+    constexpr int Md5Shift[4][4]
+        = {{7, 12, 17, 22}, {5, 9, 14, 20}, {4, 11, 16, 23}, {6, 10, 15, 21}};
+    constexpr uint32_t Md5InitialState[4] = {0x67452301, 0xefcdab89, 0x98badcfe, 0x10325476};
+    constexpr std::size_t c_md5BlockSize = 64;
+    constexpr std::size_t c_md5NumLanes = 8;
+
+    // One buffer being hashed in a SIMD lane. The last one or two blocks, which contain the
+    // padding and the length, are prepared in Tail.
+    struct Md5LaneJob
+    {
+      const uint8_t* Data = nullptr;
+      std::size_t NumDataBlocks = 0;
+      std::size_t NumBlocks = 0;
+      std::size_t NextBlock = 0;
+      std::size_t BufferIndex = 0;
+      uint8_t Tail[2 * c_md5BlockSize];
+
+      void Reset(const uint8_t* data, std::size_t length, std::size_t bufferIndex)
+      {
+        Data = data;
+        NumDataBlocks = length / c_md5BlockSize;
+        NextBlock = 0;
+        BufferIndex = bufferIndex;
+
+        std::size_t tailLength = length % c_md5BlockSize;
+        std::size_t numTailBlocks = tailLength + 1 + 8 <= c_md5BlockSize ? 1 : 2;
+        NumBlocks = NumDataBlocks + numTailBlocks;
+        std::fill(std::begin(Tail), std::end(Tail), uint8_t(0));
+        std::copy(data + NumDataBlocks * c_md5BlockSize, data + length, Tail);
+        Tail[tailLength] = 0x80;
+        uint64_t bitLength = static_cast<uint64_t>(length) * 8;
+        for (std::size_t i = 0; i < 8; ++i)
+        {
+          Tail[numTailBlocks * c_md5BlockSize - 8 + i] = static_cast<uint8_t>(bitLength >> (8 * i));
+        }
+      }
+
+      const uint8_t* CurrentBlock() const
+      {
+        return NextBlock < NumDataBlocks ? Data + NextBlock * c_md5BlockSize
+                                         : Tail + (NextBlock - NumDataBlocks) * c_md5BlockSize;
+      }
+    };
+
+    AZURE_STORAGE_MD5_TARGET inline __m256i Md5Rotl(__m256i x, int s)
+    {
+      return _mm256_or_si256(_mm256_slli_epi32(x, s), _mm256_srli_epi32(x, 32 - s));
+    }
+
+    // Compresses one block per lane. m holds word i of every lane's block in m[i].
+    AZURE_STORAGE_MD5_TARGET void Md5CompressAvx2(
+        uint32_t (*state)[c_md5NumLanes],
+        const __m256i* m)
+    {
+      __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[0]));
+      __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[1]));
+      __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[2]));
+      __m256i d = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(state[3]));
+      const __m256i a0 = a, b0 = b, c0 = c, d0 = d;
+      const __m256i ones = _mm256_set1_epi32(-1);
+
+      for (int i = 0; i < 64; ++i)
+      {
+        __m256i f;
+        int g;
+        if (i < 16)
+        {
+          f = _mm256_or_si256(_mm256_and_si256(b, c), _mm256_andnot_si256(b, d));
+          g = i;
+        }
+        else if (i < 32)
+        {
+          f = _mm256_or_si256(_mm256_and_si256(b, d), _mm256_andnot_si256(d, c));
+          g = (5 * i + 1) % 16;
+        }
+        else if (i < 48)
+        {
+          f = _mm256_xor_si256(_mm256_xor_si256(b, c), d);
+          g = (3 * i + 5) % 16;
+        }
+        else
+        {
+          f = _mm256_xor_si256(c, _mm256_or_si256(b, _mm256_xor_si256(d, ones)));
+          g = (7 * i) % 16;
+        }
+        f = _mm256_add_epi32(
+            _mm256_add_epi32(f, a),
+            _mm256_add_epi32(_mm256_set1_epi32(static_cast<int>(Md5K[i])), m[g]));
+        a = d;
+        d = c;
+        c = b;
+        b = _mm256_add_epi32(b, Md5Rotl(f, Md5Shift[i / 16][i % 4]));
+      }
+
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[0]), _mm256_add_epi32(a, a0));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[1]), _mm256_add_epi32(b, b0));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[2]), _mm256_add_epi32(c, c0));
+      _mm256_storeu_si256(reinterpret_cast<__m256i*>(state[3]), _mm256_add_epi32(d, d0));
+    }
+
+    AZURE_STORAGE_MD5_TARGET void Md5HashBatchAvx2(
+        const std::vector<std::pair<const uint8_t*, std::size_t>>& buffers,
+        std::vector<std::string>& hashes)
+    {
+      // Longest buffers first, so that lanes finish at about the same time.
+      std::vector<std::size_t> order(buffers.size());
+      for (std::size_t i = 0; i < order.size(); ++i)
+      {
+        order[i] = i;
+      }
+      std::stable_sort(order.begin(), order.end(), [&buffers](std::size_t lhs, std::size_t rhs) {
+        return buffers[lhs].second > buffers[rhs].second;
+      });
+
+      uint32_t state[4][c_md5NumLanes];
+      Md5LaneJob lanes[c_md5NumLanes];
+      bool laneActive[c_md5NumLanes] = {};
+      std::size_t nextBuffer = 0;
+      auto startNextBuffer = [&](std::size_t lane) {
+        if (nextBuffer == order.size())
+        {
+          laneActive[lane] = false;
+          return;
+        }
+        std::size_t bufferIndex = order[nextBuffer++];
+        lanes[lane].Reset(buffers[bufferIndex].first, buffers[bufferIndex].second, bufferIndex);
+        for (int i = 0; i < 4; ++i)
+        {
+          state[i][lane] = Md5InitialState[i];
+        }
+        laneActive[lane] = true;
+      };
+      for (std::size_t lane = 0; lane < c_md5NumLanes; ++lane)
+      {
+        startNextBuffer(lane);
+      }
+
+      alignas(32) uint32_t words[16][c_md5NumLanes] = {};
+      __m256i m[16];
+      while (std::any_of(std::begin(laneActive), std::end(laneActive), [](bool b) { return b; }))
+      {
+        for (std::size_t lane = 0; lane < c_md5NumLanes; ++lane)
+        {
+          if (!laneActive[lane])
+          {
+            continue;
+          }
+          const uint8_t* block = lanes[lane].CurrentBlock();
+          for (std::size_t i = 0; i < 16; ++i)
+          {
+            const uint8_t* p = block + i * 4;
+            words[i][lane] = uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16)
+                | (uint32_t(p[3]) << 24);
+          }
+        }
+        for (std::size_t i = 0; i < 16; ++i)
+        {
+          m[i] = _mm256_load_si256(reinterpret_cast<const __m256i*>(words[i]));
+        }
+        Md5CompressAvx2(state, m);
+
+        for (std::size_t lane = 0; lane < c_md5NumLanes; ++lane)
+        {
+          if (!laneActive[lane] || ++lanes[lane].NextBlock != lanes[lane].NumBlocks)
+          {
+            continue;
+          }
+          std::string hash(16, '\0');
+          for (std::size_t i = 0; i < 16; ++i)
+          {
+            hash[i] = static_cast<char>((state[i / 4][lane] >> (8 * (i % 4))) & 0xff);
+          }
+          hashes[lanes[lane].BufferIndex] = std::move(hash);
+          startNextBuffer(lane);
+        }
+      }
+    }
+
+    bool Md5Avx2Supported()
+    {
+#if defined(_MSC_VER)
+      int cpuInfo[4];
+      __cpuid(cpuInfo, 1);
+      const bool osxsave = (cpuInfo[2] & (1 << 27)) != 0;
+      if (!osxsave || (_xgetbv(0) & 0x6) != 0x6)
+      {
+        return false;
+      }
+      __cpuidex(cpuInfo, 7, 0);
+      return (cpuInfo[1] & (1 << 5)) != 0;
+#else
+      __builtin_cpu_init();
+      return __builtin_cpu_supports("avx2") != 0;
+#endif
+    }
+  } // namespace
+#endif
+
+  std::vector<std::string> Md5::HashBatch(
+      const std::vector<std::pair<const uint8_t*, std::size_t>>& buffers)
+  {
+    std::vector<std::string> hashes(buffers.size());
+#if defined(AZURE_STORAGE_MD5_AVX2)
+    static const bool avx2Supported = Md5Avx2Supported();
+    if (avx2Supported && buffers.size() > 1)
+    {
+      Md5HashBatchAvx2(buffers, hashes);
+      return hashes;
+    }
+#endif
+    for (std::size_t i = 0; i < buffers.size(); ++i)
+    {
+      hashes[i] = Hash(buffers[i].first, buffers[i].second);
+    }
+    return hashes;
+  }
+
 }} // namespace Azure::Storage
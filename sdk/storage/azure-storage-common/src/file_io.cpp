@@ -3,18 +3,32 @@
 
 #include "azure/storage/common/file_io.hpp"
 
-#ifndef _WIN32
+#include "azure/storage/common/storage_common.hpp"
+
+#ifdef _WIN32
+#include <winioctl.h>
+#else
 #include <fcntl.h>
+#include <sys/mman.h>
 #include <sys/stat.h>
 #include <sys/types.h>
 #include <unistd.h>
 #endif
 
+#include <algorithm>
+#include <cerrno>
 #include <limits>
 #include <stdexcept>
 
 namespace Azure { namespace Storage { namespace Details {
 
+  namespace {
+    // Enough to keep the disk busy while the network threads fill the next buffers, without
+    // letting a slow disk buffer an unbounded amount of data.
+    constexpr std::size_t c_maxQueuedWrites = 4;
+    constexpr int64_t c_dropPageCacheThreshold = 64 * 1024 * 1024;
+  } // namespace
+
 #ifdef _WIN32
   FileReader::FileReader(const std::string& filename)
   {
@@ -43,14 +57,60 @@ namespace Azure { namespace Storage { namespace Details {
 
   FileReader::~FileReader() { CloseHandle(m_handle); }
 
-  FileWriter::FileWriter(const std::string& filename)
+  int64_t FileReader::GetLastWriteTime() const
+  {
+    FILETIME lastWriteTime;
+    if (!GetFileTime(m_handle, nullptr, nullptr, &lastWriteTime))
+    {
+      throw std::runtime_error("failed to get modification time of file");
+    }
+    return static_cast<int64_t>(
+        (static_cast<uint64_t>(lastWriteTime.dwHighDateTime) << 32)
+        | lastWriteTime.dwLowDateTime);
+  }
+
+  void FileReader::Prefetch(int64_t offset, int64_t length) const { unused(offset, length); }
+
+  int64_t FileReader::SeekData(int64_t offset) const
+  {
+    if (offset >= m_fileSize)
+    {
+      return m_fileSize;
+    }
+    FILE_ALLOCATED_RANGE_BUFFER queryRange;
+    queryRange.FileOffset.QuadPart = offset;
+    queryRange.Length.QuadPart = m_fileSize - offset;
+    // Only the first allocated range is needed.
+    FILE_ALLOCATED_RANGE_BUFFER allocatedRange;
+    DWORD bytesReturned = 0;
+    if (!DeviceIoControl(
+            m_handle,
+            FSCTL_QUERY_ALLOCATED_RANGES,
+            &queryRange,
+            sizeof(queryRange),
+            &allocatedRange,
+            sizeof(allocatedRange),
+            &bytesReturned,
+            nullptr)
+        && GetLastError() != ERROR_MORE_DATA)
+    {
+      return offset;
+    }
+    if (bytesReturned < sizeof(allocatedRange))
+    {
+      return m_fileSize;
+    }
+    return std::max(offset, static_cast<int64_t>(allocatedRange.FileOffset.QuadPart));
+  }
+
+  FileWriter::FileWriter(const std::string& filename, bool truncate)
   {
     m_handle = CreateFile(
         filename.data(),
-        GENERIC_WRITE,
+        GENERIC_READ | GENERIC_WRITE,
         FILE_SHARE_READ | FILE_SHARE_WRITE,
         nullptr,
-        CREATE_ALWAYS,
+        truncate ? CREATE_ALWAYS : OPEN_ALWAYS,
         FILE_ATTRIBUTE_NORMAL,
         NULL);
     if (m_handle == INVALID_HANDLE_VALUE)
@@ -59,7 +119,68 @@ namespace Azure { namespace Storage { namespace Details {
     }
   }
 
-  FileWriter::~FileWriter() { CloseHandle(m_handle); }
+  FileWriter::~FileWriter()
+  {
+    StopWriting();
+    CloseHandle(m_handle);
+  }
+
+  int64_t FileWriter::GetFileSize() const
+  {
+    LARGE_INTEGER fileSize;
+    if (!GetFileSizeEx(m_handle, &fileSize))
+    {
+      throw std::runtime_error("failed to get size of file");
+    }
+    return fileSize.QuadPart;
+  }
+
+  void FileWriter::Preallocate(int64_t size)
+  {
+    FILE_ALLOCATION_INFO allocationInfo;
+    allocationInfo.AllocationSize.QuadPart = size;
+    SetFileInformationByHandle(
+        m_handle, FileAllocationInfo, &allocationInfo, sizeof(allocationInfo));
+  }
+
+  void FileWriter::Truncate(int64_t size)
+  {
+    LARGE_INTEGER distance;
+    distance.QuadPart = size;
+    if (!SetFilePointerEx(m_handle, distance, nullptr, FILE_BEGIN) || !SetEndOfFile(m_handle))
+    {
+      throw std::runtime_error("failed to resize file");
+    }
+  }
+
+  void FileWriter::SetSparse()
+  {
+    DWORD bytesReturned = 0;
+    DeviceIoControl(
+        m_handle, FSCTL_SET_SPARSE, nullptr, 0, nullptr, 0, &bytesReturned, nullptr);
+  }
+
+  void FileWriter::ZeroRange(int64_t offset, int64_t length)
+  {
+    FILE_ZERO_DATA_INFORMATION zeroDataInfo;
+    zeroDataInfo.FileOffset.QuadPart = offset;
+    zeroDataInfo.BeyondFinalZero.QuadPart = offset + length;
+    DWORD bytesReturned = 0;
+    if (!DeviceIoControl(
+            m_handle,
+            FSCTL_SET_ZERO_DATA,
+            &zeroDataInfo,
+            sizeof(zeroDataInfo),
+            nullptr,
+            0,
+            &bytesReturned,
+            nullptr))
+    {
+      WriteZeros(offset, length);
+    }
+  }
+
+  void FileWriter::ReleaseWrittenPages(int64_t offset, int64_t length) { unused(offset, length); }
 
   void FileWriter::Write(const uint8_t* buffer, int64_t length, int64_t offset)
   {
@@ -80,6 +201,57 @@ namespace Azure { namespace Storage { namespace Details {
       throw std::runtime_error("failed to write file");
     }
   }
+
+  MemoryMappedFile::MemoryMappedFile(const FileReader& file) : m_size(file.GetFileSize())
+  {
+    if (m_size == 0)
+    {
+      throw std::runtime_error("failed to map file");
+    }
+    m_mapping = CreateFileMapping(file.GetHandle(), nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (m_mapping == NULL)
+    {
+      throw std::runtime_error("failed to map file");
+    }
+    m_data = static_cast<uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_READ, 0, 0, 0));
+    if (m_data == nullptr)
+    {
+      CloseHandle(m_mapping);
+      throw std::runtime_error("failed to map file");
+    }
+  }
+
+  MemoryMappedFile::MemoryMappedFile(const FileWriter& file, int64_t size) : m_size(size)
+  {
+    if (m_size == 0)
+    {
+      throw std::runtime_error("failed to map file");
+    }
+    // The mapping extends the file to its size.
+    m_mapping = CreateFileMapping(
+        file.GetHandle(),
+        nullptr,
+        PAGE_READWRITE,
+        static_cast<DWORD>(static_cast<uint64_t>(size) >> 32),
+        static_cast<DWORD>(static_cast<uint64_t>(size)),
+        nullptr);
+    if (m_mapping == NULL)
+    {
+      throw std::runtime_error("failed to map file");
+    }
+    m_data = static_cast<uint8_t*>(MapViewOfFile(m_mapping, FILE_MAP_WRITE, 0, 0, 0));
+    if (m_data == nullptr)
+    {
+      CloseHandle(m_mapping);
+      throw std::runtime_error("failed to map file");
+    }
+  }
+
+  MemoryMappedFile::~MemoryMappedFile()
+  {
+    UnmapViewOfFile(m_data);
+    CloseHandle(m_mapping);
+  }
 #else
   FileReader::FileReader(const std::string& filename)
   {
@@ -94,21 +266,154 @@ namespace Azure { namespace Storage { namespace Details {
       close(m_handle);
       throw std::runtime_error("failed to get size of file");
     }
+#if defined(__linux__)
+    posix_fadvise(m_handle, 0, 0, POSIX_FADV_SEQUENTIAL);
+#endif
   }
 
   FileReader::~FileReader() { close(m_handle); }
 
-  FileWriter::FileWriter(const std::string& filename)
+  int64_t FileReader::GetLastWriteTime() const
+  {
+    struct stat fileStat;
+    if (fstat(m_handle, &fileStat) != 0)
+    {
+      throw std::runtime_error("failed to get modification time of file");
+    }
+#if defined(__APPLE__)
+    const int64_t nanoseconds = fileStat.st_mtimespec.tv_nsec;
+#else
+    const int64_t nanoseconds = fileStat.st_mtim.tv_nsec;
+#endif
+    return static_cast<int64_t>(fileStat.st_mtime) * 1000000000 + nanoseconds;
+  }
+
+  void FileReader::Prefetch(int64_t offset, int64_t length) const
+  {
+#if defined(__linux__)
+    posix_fadvise(
+        m_handle, static_cast<off_t>(offset), static_cast<off_t>(length), POSIX_FADV_WILLNEED);
+#else
+    unused(offset, length);
+#endif
+  }
+
+  int64_t FileReader::SeekData(int64_t offset) const
+  {
+    if (offset >= m_fileSize)
+    {
+      return m_fileSize;
+    }
+#if defined(SEEK_DATA)
+    off_t dataOffset = lseek(m_handle, static_cast<off_t>(offset), SEEK_DATA);
+    if (dataOffset == -1)
+    {
+      // ENXIO means there's only a hole after offset.
+      return errno == ENXIO ? m_fileSize : offset;
+    }
+    return std::min(static_cast<int64_t>(dataOffset), m_fileSize);
+#else
+    return offset;
+#endif
+  }
+
+  FileWriter::FileWriter(const std::string& filename, bool truncate)
   {
+    // Opened for reading too, since writable mappings need it.
     m_handle = open(
-        filename.data(), O_WRONLY | O_CREAT | O_TRUNC, S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
+        filename.data(),
+        O_RDWR | O_CREAT | (truncate ? O_TRUNC : 0),
+        S_IRUSR | S_IWUSR | S_IRGRP | S_IROTH);
     if (m_handle == -1)
     {
       throw std::runtime_error("failed to open file");
     }
   }
 
-  FileWriter::~FileWriter() { close(m_handle); }
+  FileWriter::~FileWriter()
+  {
+    StopWriting();
+    close(m_handle);
+  }
+
+  int64_t FileWriter::GetFileSize() const
+  {
+    struct stat fileStat;
+    if (fstat(m_handle, &fileStat) != 0)
+    {
+      throw std::runtime_error("failed to get size of file");
+    }
+    return static_cast<int64_t>(fileStat.st_size);
+  }
+
+  void FileWriter::Preallocate(int64_t size)
+  {
+#if defined(__linux__)
+    // Unlike posix_fallocate, this fails instead of writing zeros where it isn't supported, and
+    // the file size is left alone so an interrupted download doesn't look complete.
+    fallocate(m_handle, FALLOC_FL_KEEP_SIZE, 0, static_cast<off_t>(size));
+    m_dropPageCache = size >= c_dropPageCacheThreshold;
+#else
+    unused(size);
+#endif
+  }
+
+  void FileWriter::Truncate(int64_t size)
+  {
+    if (ftruncate(m_handle, static_cast<off_t>(size)) != 0)
+    {
+      throw std::runtime_error("failed to resize file");
+    }
+  }
+
+  void FileWriter::SetSparse() {}
+
+  void FileWriter::ZeroRange(int64_t offset, int64_t length)
+  {
+#if defined(__linux__) && defined(FALLOC_FL_PUNCH_HOLE)
+    if (fallocate(
+            m_handle,
+            FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE,
+            static_cast<off_t>(offset),
+            static_cast<off_t>(length))
+        == 0)
+    {
+      return;
+    }
+#endif
+    WriteZeros(offset, length);
+  }
+
+  void FileWriter::ReleaseWrittenPages(int64_t offset, int64_t length)
+  {
+#if defined(__linux__)
+    if (!m_dropPageCache)
+    {
+      return;
+    }
+    // Dirty pages can't be dropped, so start the writeback of this range and drop the previous
+    // one once it's on disk. Waiting here also keeps a slow disk from accumulating dirty pages.
+    sync_file_range(
+        m_handle, static_cast<off_t>(offset), static_cast<off_t>(length), SYNC_FILE_RANGE_WRITE);
+    if (m_lastWriteLength != 0)
+    {
+      sync_file_range(
+          m_handle,
+          static_cast<off_t>(m_lastWriteOffset),
+          static_cast<off_t>(m_lastWriteLength),
+          SYNC_FILE_RANGE_WAIT_BEFORE | SYNC_FILE_RANGE_WRITE | SYNC_FILE_RANGE_WAIT_AFTER);
+      posix_fadvise(
+          m_handle,
+          static_cast<off_t>(m_lastWriteOffset),
+          static_cast<off_t>(m_lastWriteLength),
+          POSIX_FADV_DONTNEED);
+    }
+    m_lastWriteOffset = offset;
+    m_lastWriteLength = length;
+#else
+    unused(offset, length);
+#endif
+  }
 
   void FileWriter::Write(const uint8_t* buffer, int64_t length, int64_t offset)
   {
@@ -124,6 +429,146 @@ namespace Azure { namespace Storage { namespace Details {
       throw std::runtime_error("failed to write file");
     }
   }
+
+  MemoryMappedFile::MemoryMappedFile(const FileReader& file) : m_size(file.GetFileSize())
+  {
+    if (m_size == 0 || static_cast<uint64_t>(m_size) > std::numeric_limits<size_t>::max())
+    {
+      throw std::runtime_error("failed to map file");
+    }
+    void* data
+        = mmap(nullptr, static_cast<size_t>(m_size), PROT_READ, MAP_SHARED, file.GetHandle(), 0);
+    if (data == MAP_FAILED)
+    {
+      throw std::runtime_error("failed to map file");
+    }
+    m_data = static_cast<uint8_t*>(data);
+    madvise(data, static_cast<size_t>(m_size), MADV_SEQUENTIAL);
+#if defined(MADV_HUGEPAGE)
+    // Only takes effect where the file system supports huge pages in the page cache.
+    madvise(data, static_cast<size_t>(m_size), MADV_HUGEPAGE);
+#endif
+  }
+
+  MemoryMappedFile::MemoryMappedFile(const FileWriter& file, int64_t size) : m_size(size)
+  {
+    if (m_size == 0 || static_cast<uint64_t>(m_size) > std::numeric_limits<size_t>::max()
+        || ftruncate(file.GetHandle(), static_cast<off_t>(size)) != 0)
+    {
+      throw std::runtime_error("failed to map file");
+    }
+    void* data = mmap(
+        nullptr,
+        static_cast<size_t>(m_size),
+        PROT_READ | PROT_WRITE,
+        MAP_SHARED,
+        file.GetHandle(),
+        0);
+    if (data == MAP_FAILED)
+    {
+      throw std::runtime_error("failed to map file");
+    }
+    m_data = static_cast<uint8_t*>(data);
+  }
+
+  MemoryMappedFile::~MemoryMappedFile() { munmap(m_data, static_cast<size_t>(m_size)); }
 #endif
 
+  void FileWriter::WriteZeros(int64_t offset, int64_t length)
+  {
+    constexpr int64_t c_zeroBufferSize = 1024 * 1024;
+    const std::vector<uint8_t> zeros(
+        static_cast<std::size_t>(std::min(length, c_zeroBufferSize)), uint8_t(0));
+    while (length > 0)
+    {
+      const int64_t writeSize = std::min(length, c_zeroBufferSize);
+      Write(zeros.data(), writeSize, offset);
+      offset += writeSize;
+      length -= writeSize;
+    }
+  }
+
+  void FileWriter::WriteAsync(PooledBuffer buffer, int64_t offset)
+  {
+    std::unique_lock<std::mutex> guard(m_mutex);
+    if (!m_thread.joinable())
+    {
+      m_thread = std::thread(&FileWriter::WriteLoop, this);
+    }
+    m_cv.wait(guard, [this]() { return m_queue.size() < c_maxQueuedWrites || m_error; });
+    if (m_error)
+    {
+      std::rethrow_exception(m_error);
+    }
+    m_queue.push_back(PendingWrite{std::move(buffer), offset});
+    m_cv.notify_all();
+  }
+
+  void FileWriter::Flush()
+  {
+    std::unique_lock<std::mutex> guard(m_mutex);
+    m_cv.wait(guard, [this]() { return m_queue.empty() && !m_writing; });
+    if (m_error)
+    {
+      std::rethrow_exception(m_error);
+    }
+  }
+
+  void FileWriter::WriteLoop()
+  {
+    std::unique_lock<std::mutex> guard(m_mutex);
+    while (true)
+    {
+      m_cv.wait(guard, [this]() { return m_stop || !m_queue.empty(); });
+      if (m_queue.empty())
+      {
+        return;
+      }
+      PendingWrite write = std::move(m_queue.front());
+      m_queue.pop_front();
+      const bool failed = static_cast<bool>(m_error);
+      m_writing = true;
+      guard.unlock();
+
+      std::exception_ptr error;
+      if (!failed)
+      {
+        const auto length = static_cast<int64_t>(write.Buffer.Size());
+        try
+        {
+          Write(write.Buffer.Data(), length, write.Offset);
+          ReleaseWrittenPages(write.Offset, length);
+        }
+        catch (...)
+        {
+          error = std::current_exception();
+        }
+      }
+      // Back to the pool before a waiting writer acquires its next buffer.
+      write.Buffer.Release();
+
+      guard.lock();
+      m_writing = false;
+      if (error && !m_error)
+      {
+        m_error = error;
+      }
+      m_cv.notify_all();
+    }
+  }
+
+  void FileWriter::StopWriting()
+  {
+    if (!m_thread.joinable())
+    {
+      return;
+    }
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      m_stop = true;
+    }
+    m_cv.notify_all();
+    m_thread.join();
+  }
+
 }}} // namespace Azure::Storage::Details
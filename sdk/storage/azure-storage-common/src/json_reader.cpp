@@ -0,0 +1,445 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/json_reader.hpp"
+
+#include <cstring>
+#include <stdexcept>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  namespace {
+    bool IsDigit(char c) { return c >= '0' && c <= '9'; }
+
+    int HexValue(char c)
+    {
+      if (c >= '0' && c <= '9')
+      {
+        return c - '0';
+      }
+      if (c >= 'a' && c <= 'f')
+      {
+        return c - 'a' + 10;
+      }
+      if (c >= 'A' && c <= 'F')
+      {
+        return c - 'A' + 10;
+      }
+      return -1;
+    }
+
+    void AppendUtf8(uint32_t codePoint, std::string& out)
+    {
+      if (codePoint < 0x80)
+      {
+        out += static_cast<char>(codePoint);
+      }
+      else if (codePoint < 0x800)
+      {
+        out += static_cast<char>(0xc0 | (codePoint >> 6));
+        out += static_cast<char>(0x80 | (codePoint & 0x3f));
+      }
+      else if (codePoint < 0x10000)
+      {
+        out += static_cast<char>(0xe0 | (codePoint >> 12));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+        out += static_cast<char>(0x80 | (codePoint & 0x3f));
+      }
+      else
+      {
+        out += static_cast<char>(0xf0 | (codePoint >> 18));
+        out += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+        out += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+        out += static_cast<char>(0x80 | (codePoint & 0x3f));
+      }
+    }
+  } // namespace
+
+  void JsonReader::ThrowParseError() const { throw std::runtime_error("failed to parse json"); }
+
+  void JsonReader::SkipWhitespace()
+  {
+    while (m_pos < m_length
+           && (m_data[m_pos] == ' ' || m_data[m_pos] == '\t' || m_data[m_pos] == '\n'
+               || m_data[m_pos] == '\r'))
+    {
+      ++m_pos;
+    }
+  }
+
+  void JsonReader::AfterValue()
+  {
+    m_state = m_containers.empty() ? State::Done : State::CommaOrEnd;
+  }
+
+  JsonToken JsonReader::CloseContainer(bool isObject)
+  {
+    ++m_pos;
+    m_containers.pop_back();
+    AfterValue();
+    return JsonToken{isObject ? JsonTokenType::EndObject : JsonTokenType::EndArray};
+  }
+
+  JsonToken JsonReader::Read()
+  {
+    SkipWhitespace();
+    if (m_state == State::Done)
+    {
+      if (m_pos != m_length)
+      {
+        ThrowParseError();
+      }
+      return JsonToken{JsonTokenType::End};
+    }
+    if (m_pos == m_length)
+    {
+      ThrowParseError();
+    }
+
+    if (m_state == State::CommaOrEnd)
+    {
+      const bool isObject = m_containers.back();
+      if (m_data[m_pos] == (isObject ? '}' : ']'))
+      {
+        return CloseContainer(isObject);
+      }
+      if (m_data[m_pos] != ',')
+      {
+        ThrowParseError();
+      }
+      ++m_pos;
+      SkipWhitespace();
+      if (m_pos == m_length)
+      {
+        ThrowParseError();
+      }
+      m_state = isObject ? State::Name : State::Value;
+    }
+
+    const char c = m_data[m_pos];
+    if (m_state == State::NameOrEndObject && c == '}')
+    {
+      return CloseContainer(true);
+    }
+    if (m_state == State::ValueOrEndArray && c == ']')
+    {
+      return CloseContainer(false);
+    }
+    if (m_state == State::NameOrEndObject || m_state == State::Name)
+    {
+      if (c != '"')
+      {
+        ThrowParseError();
+      }
+      JsonToken token = ReadString(JsonTokenType::PropertyName);
+      SkipWhitespace();
+      if (m_pos == m_length || m_data[m_pos] != ':')
+      {
+        ThrowParseError();
+      }
+      ++m_pos;
+      m_state = State::Value;
+      return token;
+    }
+    return ReadValue();
+  }
+
+  JsonToken JsonReader::Read(JsonTokenType expected)
+  {
+    JsonToken token = Read();
+    if (token.Type != expected)
+    {
+      ThrowParseError();
+    }
+    return token;
+  }
+
+  JsonTokenType JsonReader::PeekType()
+  {
+    const std::size_t pos = m_pos;
+    const State state = m_state;
+    const JsonTokenType type = Read().Type;
+    if (type == JsonTokenType::StartObject || type == JsonTokenType::StartArray)
+    {
+      m_containers.pop_back();
+    }
+    else if (type == JsonTokenType::EndObject || type == JsonTokenType::EndArray)
+    {
+      m_containers.push_back(type == JsonTokenType::EndObject);
+    }
+    m_pos = pos;
+    m_state = state;
+    return type;
+  }
+
+  int64_t JsonReader::ReadInt64()
+  {
+    const JsonToken token = Read();
+    if ((token.Type != JsonTokenType::Number && token.Type != JsonTokenType::String)
+        || token.Length == 0)
+    {
+      ThrowParseError();
+    }
+    const bool negative = token.Value[0] == '-';
+    std::size_t i = negative ? 1 : 0;
+    if (i == token.Length)
+    {
+      ThrowParseError();
+    }
+    uint64_t value = 0;
+    for (; i < token.Length; ++i)
+    {
+      if (!IsDigit(token.Value[i]) || value > (UINT64_MAX - 9) / 10)
+      {
+        ThrowParseError();
+      }
+      value = value * 10 + static_cast<uint64_t>(token.Value[i] - '0');
+    }
+    if (value > static_cast<uint64_t>(INT64_MAX) + (negative ? 1 : 0))
+    {
+      ThrowParseError();
+    }
+    return negative ? static_cast<int64_t>(0 - value) : static_cast<int64_t>(value);
+  }
+
+  bool JsonReader::ReadBoolean()
+  {
+    const JsonToken token = Read();
+    if (token.Type == JsonTokenType::True
+        || (token.Type == JsonTokenType::String && token.Equals("true")))
+    {
+      return true;
+    }
+    if (token.Type == JsonTokenType::False
+        || (token.Type == JsonTokenType::String && token.Equals("false")))
+    {
+      return false;
+    }
+    ThrowParseError();
+  }
+
+  JsonToken JsonReader::ReadValue()
+  {
+    switch (m_data[m_pos])
+    {
+      case '{':
+        ++m_pos;
+        m_containers.push_back(true);
+        m_state = State::NameOrEndObject;
+        return JsonToken{JsonTokenType::StartObject};
+      case '[':
+        ++m_pos;
+        m_containers.push_back(false);
+        m_state = State::ValueOrEndArray;
+        return JsonToken{JsonTokenType::StartArray};
+      case '"': {
+        JsonToken token = ReadString(JsonTokenType::String);
+        AfterValue();
+        return token;
+      }
+      case 't':
+        return ReadLiteral("true", JsonTokenType::True);
+      case 'f':
+        return ReadLiteral("false", JsonTokenType::False);
+      case 'n':
+        return ReadLiteral("null", JsonTokenType::Null);
+      default:
+        return ReadNumber();
+    }
+  }
+
+  JsonToken JsonReader::ReadLiteral(const char* literal, JsonTokenType type)
+  {
+    const std::size_t length = std::strlen(literal);
+    if (m_length - m_pos < length || std::memcmp(m_data + m_pos, literal, length) != 0)
+    {
+      ThrowParseError();
+    }
+    m_pos += length;
+    AfterValue();
+    return JsonToken{type};
+  }
+
+  JsonToken JsonReader::ReadNumber()
+  {
+    const std::size_t begin = m_pos;
+    auto skipDigits = [this]() {
+      const std::size_t digitsBegin = m_pos;
+      while (m_pos < m_length && IsDigit(m_data[m_pos]))
+      {
+        ++m_pos;
+      }
+      if (m_pos == digitsBegin)
+      {
+        ThrowParseError();
+      }
+    };
+
+    if (m_data[m_pos] == '-')
+    {
+      ++m_pos;
+    }
+    skipDigits();
+    if (m_pos < m_length && m_data[m_pos] == '.')
+    {
+      ++m_pos;
+      skipDigits();
+    }
+    if (m_pos < m_length && (m_data[m_pos] == 'e' || m_data[m_pos] == 'E'))
+    {
+      ++m_pos;
+      if (m_pos < m_length && (m_data[m_pos] == '+' || m_data[m_pos] == '-'))
+      {
+        ++m_pos;
+      }
+      skipDigits();
+    }
+    AfterValue();
+    return JsonToken{JsonTokenType::Number, m_data + begin, m_pos - begin};
+  }
+
+  JsonToken JsonReader::ReadString(JsonTokenType type)
+  {
+    // m_pos is at the opening quote.
+    const std::size_t begin = ++m_pos;
+    while (m_pos < m_length && m_data[m_pos] != '"' && m_data[m_pos] != '\\')
+    {
+      if (static_cast<unsigned char>(m_data[m_pos]) < 0x20)
+      {
+        ThrowParseError();
+      }
+      ++m_pos;
+    }
+    if (m_pos == m_length)
+    {
+      ThrowParseError();
+    }
+    if (m_data[m_pos] == '"')
+    {
+      // No escape sequences, so the token refers to the input.
+      return JsonToken{type, m_data + begin, m_pos++ - begin};
+    }
+
+    m_scratch.assign(m_data + begin, m_pos - begin);
+    auto readHex4 = [this]() {
+      if (m_length - m_pos < 4)
+      {
+        ThrowParseError();
+      }
+      uint32_t value = 0;
+      for (int i = 0; i < 4; ++i)
+      {
+        const int digit = HexValue(m_data[m_pos++]);
+        if (digit < 0)
+        {
+          ThrowParseError();
+        }
+        value = (value << 4) | static_cast<uint32_t>(digit);
+      }
+      return value;
+    };
+    while (true)
+    {
+      if (m_pos == m_length)
+      {
+        ThrowParseError();
+      }
+      const char c = m_data[m_pos++];
+      if (c == '"')
+      {
+        break;
+      }
+      if (static_cast<unsigned char>(c) < 0x20)
+      {
+        ThrowParseError();
+      }
+      if (c != '\\')
+      {
+        m_scratch += c;
+        continue;
+      }
+      if (m_pos == m_length)
+      {
+        ThrowParseError();
+      }
+      switch (m_data[m_pos++])
+      {
+        case '"':
+          m_scratch += '"';
+          break;
+        case '\\':
+          m_scratch += '\\';
+          break;
+        case '/':
+          m_scratch += '/';
+          break;
+        case 'b':
+          m_scratch += '\b';
+          break;
+        case 'f':
+          m_scratch += '\f';
+          break;
+        case 'n':
+          m_scratch += '\n';
+          break;
+        case 'r':
+          m_scratch += '\r';
+          break;
+        case 't':
+          m_scratch += '\t';
+          break;
+        case 'u': {
+          uint32_t codePoint = readHex4();
+          if (codePoint >= 0xd800 && codePoint < 0xdc00)
+          {
+            // A high surrogate must be followed by an escaped low surrogate.
+            if (m_length - m_pos < 2 || m_data[m_pos] != '\\' || m_data[m_pos + 1] != 'u')
+            {
+              ThrowParseError();
+            }
+            m_pos += 2;
+            const uint32_t lowSurrogate = readHex4();
+            if (lowSurrogate < 0xdc00 || lowSurrogate >= 0xe000)
+            {
+              ThrowParseError();
+            }
+            codePoint = 0x10000 + ((codePoint - 0xd800) << 10) + (lowSurrogate - 0xdc00);
+          }
+          else if (codePoint >= 0xdc00 && codePoint < 0xe000)
+          {
+            ThrowParseError();
+          }
+          AppendUtf8(codePoint, m_scratch);
+          break;
+        }
+        default:
+          ThrowParseError();
+      }
+    }
+    return JsonToken{type, m_scratch.data(), m_scratch.length()};
+  }
+
+  void JsonReader::SkipValue()
+  {
+    std::size_t depth = 0;
+    do
+    {
+      const JsonToken token = Read();
+      if (token.Type == JsonTokenType::StartObject || token.Type == JsonTokenType::StartArray)
+      {
+        ++depth;
+      }
+      else if (token.Type == JsonTokenType::EndObject || token.Type == JsonTokenType::EndArray)
+      {
+        --depth;
+      }
+      else if (
+          token.Type == JsonTokenType::End
+          || (depth == 0 && token.Type == JsonTokenType::PropertyName))
+      {
+        ThrowParseError();
+      }
+    } while (depth != 0);
+  }
+
+}}} // namespace Azure::Storage::Details
@@ -0,0 +1,168 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/parallel_download_stream.hpp"
+
+#include "azure/storage/common/buffer_pool.hpp"
+#include "azure/storage/common/thread_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <stdexcept>
+
+using Azure::Core::Context;
+using Azure::Core::Http::BodyStream;
+
+namespace Azure { namespace Storage {
+
+  namespace {
+    // How often a reader waiting for a chunk checks whether its context was canceled.
+    constexpr std::chrono::milliseconds c_cancellationPollInterval(100);
+  } // namespace
+
+  struct ParallelDownloadStream::Chunk
+  {
+    // Offset in the stream, not in the content.
+    int64_t Offset = 0;
+    int64_t Length = 0;
+    Details::PooledBuffer Buffer;
+    bool Done = false;
+    std::exception_ptr Exception;
+  };
+
+  ParallelDownloadStream::ParallelDownloadStream(
+      std::unique_ptr<BodyStream> firstChunk,
+      int64_t offset,
+      int64_t length,
+      RangeGetter rangeGetter,
+      Context const& context,
+      ParallelDownloadStreamOptions const& options)
+      : m_firstChunk(std::move(firstChunk)), m_offset(offset), m_length(length),
+        m_rangeGetter(std::move(rangeGetter)), m_parentContext(context),
+        m_context(context.WithDeadline(Context::time_point::max())), m_options(options),
+        m_state(std::make_shared<SharedState>())
+  {
+    if (this->m_firstChunk)
+    {
+      this->m_firstChunkLength = std::min(this->m_firstChunk->Length(), this->m_length);
+      this->m_nextChunkOffset = this->m_firstChunkLength;
+    }
+    FillWindow();
+  }
+
+  ParallelDownloadStream::~ParallelDownloadStream()
+  {
+    // Chunks still being downloaded hold on to what they need, they finish on their own.
+    this->m_context.Cancel();
+  }
+
+  void ParallelDownloadStream::FillWindow()
+  {
+    const int64_t chunkSize = std::max<int64_t>(this->m_options.ChunkSize, 1);
+    const std::size_t windowSize
+        = static_cast<std::size_t>(std::max(this->m_options.Concurrency, 1));
+    while (this->m_window.size() < windowSize && this->m_nextChunkOffset < this->m_length)
+    {
+      auto chunk = std::make_shared<Chunk>();
+      chunk->Offset = this->m_nextChunkOffset;
+      chunk->Length = std::min(chunkSize, this->m_length - this->m_nextChunkOffset);
+      this->m_nextChunkOffset += chunk->Length;
+      this->m_window.push_back(chunk);
+
+      Details::ThreadPool::GetTransferThreadPool().Submit(
+          [chunk,
+           state = this->m_state,
+           rangeGetter = this->m_rangeGetter,
+           context = this->m_context,
+           offset = this->m_offset]() {
+            std::exception_ptr exception;
+            try
+            {
+              context.ThrowIfCanceled();
+              auto stream = rangeGetter(context, offset + chunk->Offset, chunk->Length);
+              chunk->Buffer = Details::BufferPool::GetTransferBufferPool().Acquire(
+                  static_cast<std::size_t>(chunk->Length));
+              if (BodyStream::ReadToCount(context, *stream, chunk->Buffer.Data(), chunk->Length)
+                  != chunk->Length)
+              {
+                throw std::runtime_error("error when reading body stream");
+              }
+            }
+            catch (...)
+            {
+              exception = std::current_exception();
+            }
+            std::lock_guard<std::mutex> guard(state->Mutex);
+            chunk->Exception = exception;
+            chunk->Done = true;
+            state->Cv.notify_all();
+          });
+    }
+  }
+
+  void ParallelDownloadStream::Rewind()
+  {
+    // The first chunk's stream may not be rewindable, so everything is downloaded again.
+    this->m_context.Cancel();
+    this->m_context = this->m_parentContext.WithDeadline(Context::time_point::max());
+    this->m_window.clear();
+    this->m_firstChunk.reset();
+    this->m_firstChunkLength = 0;
+    this->m_position = 0;
+    this->m_nextChunkOffset = 0;
+    FillWindow();
+  }
+
+  int64_t ParallelDownloadStream::Read(Context const& context, uint8_t* buffer, int64_t count)
+  {
+    if (this->m_position >= this->m_length || count <= 0)
+    {
+      return 0;
+    }
+
+    if (this->m_position < this->m_firstChunkLength)
+    {
+      int64_t readBytes = this->m_firstChunk->Read(
+          context, buffer, std::min(count, this->m_firstChunkLength - this->m_position));
+      if (readBytes == 0)
+      {
+        throw std::runtime_error("error when reading body stream");
+      }
+      this->m_position += readBytes;
+      if (this->m_position == this->m_firstChunkLength)
+      {
+        this->m_firstChunk.reset();
+      }
+      return readBytes;
+    }
+
+    auto chunk = this->m_window.front();
+    {
+      std::unique_lock<std::mutex> guard(this->m_state->Mutex);
+      while (!chunk->Done)
+      {
+        this->m_state->Cv.wait_for(guard, c_cancellationPollInterval);
+        context.ThrowIfCanceled();
+      }
+    }
+    if (chunk->Exception)
+    {
+      std::rethrow_exception(chunk->Exception);
+    }
+
+    const int64_t chunkPosition = this->m_position - chunk->Offset;
+    const int64_t readBytes = std::min(count, chunk->Length - chunkPosition);
+    std::memcpy(
+        buffer, chunk->Buffer.Data() + chunkPosition, static_cast<std::size_t>(readBytes));
+    this->m_position += readBytes;
+    if (chunkPosition + readBytes == chunk->Length)
+    {
+      this->m_window.pop_front();
+      FillWindow();
+    }
+    return readBytes;
+  }
+
+}} // namespace Azure::Storage
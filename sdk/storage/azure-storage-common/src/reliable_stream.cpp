@@ -9,6 +9,58 @@ using Azure::Core::Http::BodyStream;
 
 namespace Azure { namespace Storage {
 
+  constexpr int64_t ReliableStream::c_numThroughputSlices;
+
+  bool ReliableStream::IsStalled(
+      int64_t bytesRead,
+      std::chrono::steady_clock::duration readTime)
+  {
+    if (this->m_options.MinimumThroughput <= 0
+        || this->m_numStallReconnections >= this->m_options.MaxRetryRequests)
+    {
+      return false;
+    }
+    if (!this->m_measuring)
+    {
+      // The window starts with the first read on a connection, not when it's opened.
+      this->m_measuring = true;
+      this->m_readTime = std::chrono::steady_clock::duration::zero();
+      this->m_currentSlice = 0;
+      this->m_sliceBytes.fill(0);
+    }
+    this->m_readTime += readTime;
+
+    const auto sliceDuration = std::max(
+        this->m_options.ThroughputWindow / c_numThroughputSlices, std::chrono::milliseconds(1));
+    const int64_t slice = this->m_readTime / sliceDuration;
+    if (slice - this->m_currentSlice >= c_numThroughputSlices)
+    {
+      this->m_sliceBytes.fill(0);
+    }
+    else
+    {
+      for (int64_t i = this->m_currentSlice + 1; i <= slice; ++i)
+      {
+        this->m_sliceBytes[static_cast<std::size_t>(i % c_numThroughputSlices)] = 0;
+      }
+    }
+    this->m_currentSlice = slice;
+    this->m_sliceBytes[static_cast<std::size_t>(slice % c_numThroughputSlices)] += bytesRead;
+    if (slice < c_numThroughputSlices)
+    {
+      return false;
+    }
+
+    // The slices cover at least all but the last slice of the window.
+    int64_t windowBytes = 0;
+    for (auto bytes : this->m_sliceBytes)
+    {
+      windowBytes += bytes;
+    }
+    const auto measuredDuration = sliceDuration * (c_numThroughputSlices - 1);
+    return windowBytes * 1000 < this->m_options.MinimumThroughput * measuredDuration.count();
+  }
+
   int64_t ReliableStream::Read(Context const& context, uint8_t* buffer, int64_t count)
   {
     for (int64_t intent = 1;; intent++)
@@ -21,20 +73,45 @@ namespace Azure { namespace Storage {
         // As m_inner is unique_pr, it will be destructed on reassignment, cleaning up network
         // session.
         this->m_inner = this->m_httpGetter(context, this->m_retryInfo);
+        this->m_measuring = false;
       }
       try
       {
-        auto const readBytes = this->m_inner->Read(context, buffer, count);
+        int64_t readBytes = 0;
+        const auto readStart = std::chrono::steady_clock::now();
+        if (this->m_options.MaximumIdleGap.count() > 0)
+        {
+          // The deadline cancels a read that's waiting on the network for too long.
+          auto readContext = context.WithDeadline(
+              std::chrono::system_clock::now() + this->m_options.MaximumIdleGap);
+          readBytes = this->m_inner->Read(readContext, buffer, count);
+        }
+        else
+        {
+          readBytes = this->m_inner->Read(context, buffer, count);
+        }
         // update offset
         this->m_retryInfo.Offset += readBytes;
+        if (readBytes != 0
+            && IsStalled(readBytes, std::chrono::steady_clock::now() - readStart))
+        {
+          // Keep what was read and continue on a new connection on the next read.
+          this->m_inner.reset();
+          ++this->m_numStallReconnections;
+        }
         return readBytes;
       }
       catch (std::runtime_error const& e)
       {
+        if (context.CancelWhen() < std::chrono::system_clock::now())
+        {
+          // Canceled by the caller, not by the idle deadline.
+          throw;
+        }
         // forget about the inner stream. We will need to request a new one
         // As m_inner is unique_pr, it will be destructed on reassignment (cleaning up network
         // session).
-        this->m_inner.release();
+        this->m_inner.reset();
         (void)e; // todo: maybe log the exception in the future?
         if (intent == this->m_options.MaxRetryRequests)
         {
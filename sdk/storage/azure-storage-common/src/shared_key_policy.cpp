@@ -9,31 +9,51 @@
 
 #include <algorithm>
 #include <cctype>
+#include <cstring>
 
 namespace Azure { namespace Storage {
+
+  namespace {
+    void AppendQueryComponent(std::string& buffer, const std::string& component)
+    {
+      if (component.find_first_of("%+") == std::string::npos)
+      {
+        buffer += component;
+      }
+      else
+      {
+        buffer += Azure::Core::Http::Url::Decode(component);
+      }
+    }
+  } // namespace
+
   std::string SharedKeyPolicy::GetSignature(const Core::Http::Request& request) const
   {
-    std::string string_to_sign;
-    string_to_sign += Azure::Core::Http::HttpMethodToString(request.GetMethod()) + "\n";
+    // The string to sign is built in a per-thread buffer that keeps its capacity between requests.
+    thread_local std::string string_to_sign;
+    string_to_sign.clear();
+    string_to_sign += Azure::Core::Http::HttpMethodToString(request.GetMethod());
+    string_to_sign += '\n';
 
-    const auto& headers = request.GetHeaders();
-    for (std::string headerName :
-         {"Content-Encoding",
-          "Content-Language",
-          "Content-Length",
-          "Content-MD5",
-          "Content-Type",
-          "Date",
-          "If-Modified-Since",
-          "If-Match",
-          "If-None-Match",
-          "If-Unmodified-Since",
-          "Range"})
+    // Header names are stored in lower case.
+    const auto headers = request.GetHeaders();
+    for (const char* headerName :
+         {"content-encoding",
+          "content-language",
+          "content-length",
+          "content-md5",
+          "content-type",
+          "date",
+          "if-modified-since",
+          "if-match",
+          "if-none-match",
+          "if-unmodified-since",
+          "range"})
     {
-      auto ite = headers.find(Azure::Core::Strings::ToLower(headerName));
+      auto ite = headers.find(headerName);
       if (ite != headers.end())
       {
-        if (headerName == "Content-Length" && ite->second == "0")
+        if (std::strcmp(headerName, "content-length") == 0 && ite->second == "0")
         {
           // do nothing
         }
@@ -42,44 +62,59 @@ namespace Azure { namespace Storage {
           string_to_sign += ite->second;
         }
       }
-      string_to_sign += "\n";
+      string_to_sign += '\n';
     }
 
-    // canonicalized headers
+    // canonicalized headers, the header map is already sorted
     const std::string prefix = "x-ms-";
-    std::vector<std::pair<std::string, std::string>> ordered_kv;
     for (auto ite = headers.lower_bound(prefix);
-         ite != headers.end() && ite->first.substr(0, prefix.length()) == prefix;
+         ite != headers.end() && ite->first.compare(0, prefix.length(), prefix) == 0;
          ++ite)
     {
-      std::string key = Azure::Core::Strings::ToLower(ite->first);
-      ordered_kv.emplace_back(std::make_pair(std::move(key), ite->second));
-    }
-    std::sort(ordered_kv.begin(), ordered_kv.end());
-    for (const auto& p : ordered_kv)
-    {
-      string_to_sign += p.first + ":" + p.second + "\n";
+      string_to_sign += ite->first;
+      string_to_sign += ':';
+      string_to_sign += ite->second;
+      string_to_sign += '\n';
     }
-    ordered_kv.clear();
 
     // canonicalized resource
-    string_to_sign += "/" + m_credential->AccountName + "/" + request.GetUrl().GetPath() + "\n";
-    for (const auto& query : request.GetUrl().GetQueryParameters())
+    string_to_sign += '/';
+    string_to_sign += m_credential->AccountName;
+    string_to_sign += '/';
+    string_to_sign += request.GetUrl().GetPath();
+    string_to_sign += '\n';
+    const auto queryParameters = request.GetUrl().GetQueryParameters();
+    std::vector<std::pair<std::string, const std::string*>> ordered_kv;
+    ordered_kv.reserve(queryParameters.size());
+    for (const auto& query : queryParameters)
     {
-      std::string key = Azure::Core::Strings::ToLower(query.first);
-      ordered_kv.emplace_back(std::make_pair(
-          Azure::Core::Http::Url::Decode(key), Azure::Core::Http::Url::Decode(query.second)));
+      std::string key;
+      AppendQueryComponent(key, Azure::Core::Strings::ToLower(query.first));
+      ordered_kv.emplace_back(std::move(key), &query.second);
     }
-    std::sort(ordered_kv.begin(), ordered_kv.end());
+    std::sort(
+        ordered_kv.begin(),
+        ordered_kv.end(),
+        [](const std::pair<std::string, const std::string*>& lhs,
+           const std::pair<std::string, const std::string*>& rhs) {
+          if (lhs.first != rhs.first)
+          {
+            return lhs.first < rhs.first;
+          }
+          return Azure::Core::Http::Url::Decode(*lhs.second)
+              < Azure::Core::Http::Url::Decode(*rhs.second);
+        });
     for (const auto& p : ordered_kv)
     {
-      string_to_sign += p.first + ":" + p.second + "\n";
+      string_to_sign += p.first;
+      string_to_sign += ':';
+      AppendQueryComponent(string_to_sign, *p.second);
+      string_to_sign += '\n';
     }
 
     // remove last linebreak
     string_to_sign.pop_back();
 
-    return Base64Encode(
-        Details::HmacSha256(string_to_sign, Base64Decode(m_credential->GetAccountKey())));
+    return Base64Encode(m_credential->GetSigningContext()->Sign(string_to_sign));
   }
 }} // namespace Azure::Storage
@@ -5,6 +5,12 @@
 
 #include "azure/core/uuid.hpp"
 
+#if defined(__x86_64__) || defined(_M_X64)
+#include <emmintrin.h>
+#endif
+
+#include <cstring>
+
 namespace Azure { namespace Storage {
 
   std::string CreateUniqueLeaseId()
@@ -13,4 +19,44 @@ namespace Azure { namespace Storage {
     return uuid.GetUuidString();
   }
 
+  namespace Details {
+    bool IsAllZeros(const uint8_t* data, std::size_t length)
+    {
+      std::size_t i = 0;
+#if defined(__x86_64__) || defined(_M_X64)
+      // SSE2 is part of x86-64. 64 bytes are checked at a time, so data that isn't zero is
+      // usually rejected within the first iteration.
+      const __m128i zero = _mm_setzero_si128();
+      for (; i + 64 <= length; i += 64)
+      {
+        const __m128i* p = reinterpret_cast<const __m128i*>(data + i);
+        __m128i v = _mm_or_si128(
+            _mm_or_si128(_mm_loadu_si128(p), _mm_loadu_si128(p + 1)),
+            _mm_or_si128(_mm_loadu_si128(p + 2), _mm_loadu_si128(p + 3)));
+        if (_mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)) != 0xFFFF)
+        {
+          return false;
+        }
+      }
+#endif
+      for (; i + sizeof(uint64_t) <= length; i += sizeof(uint64_t))
+      {
+        uint64_t word;
+        std::memcpy(&word, data + i, sizeof(word));
+        if (word != 0)
+        {
+          return false;
+        }
+      }
+      for (; i < length; ++i)
+      {
+        if (data[i] != 0)
+        {
+          return false;
+        }
+      }
+      return true;
+    }
+  } // namespace Details
+
 }} // namespace Azure::Storage
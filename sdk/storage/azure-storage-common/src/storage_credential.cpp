@@ -3,8 +3,25 @@
 
 #include "azure/storage/common/storage_credential.hpp"
 
+#include "azure/storage/common/crypt.hpp"
+
 #include <algorithm>
 
+namespace Azure { namespace Storage {
+
+  std::shared_ptr<const Details::HmacSha256Context> SharedKeyCredential::GetSigningContext() const
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (!m_signingContext)
+    {
+      m_signingContext
+          = std::make_shared<const Details::HmacSha256Context>(Base64Decode(m_accountKey));
+    }
+    return m_signingContext;
+  }
+
+}} // namespace Azure::Storage
+
 namespace Azure { namespace Storage { namespace Details {
 
   ConnectionStringParts ParseConnectionString(const std::string& connectionString)
@@ -5,7 +5,7 @@
 
 #include "azure/core/http/policy.hpp"
 #include "azure/storage/common/constants.hpp"
-#include "azure/storage/common/json.hpp"
+#include "azure/storage/common/json_reader.hpp"
 #include "azure/storage/common/storage_common.hpp"
 #include "azure/storage/common/xml_wrapper.hpp"
 
@@ -110,9 +110,35 @@ namespace Azure { namespace Storage {
           response->GetHeaders().at(Details::c_HttpHeaderContentType).find("json")
           != std::string::npos)
       {
-        auto jsonParser = nlohmann::json::parse(bodyBuffer);
-        errorCode = jsonParser["error"]["code"].get<std::string>();
-        message = jsonParser["error"]["message"].get<std::string>();
+        Details::JsonReader reader(
+            reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size());
+        reader.Read(Details::JsonTokenType::StartObject);
+        for (auto token = reader.Read(); token.Type != Details::JsonTokenType::EndObject;
+             token = reader.Read())
+        {
+          if (!token.Equals("error"))
+          {
+            reader.SkipValue();
+            continue;
+          }
+          reader.Read(Details::JsonTokenType::StartObject);
+          for (token = reader.Read(); token.Type != Details::JsonTokenType::EndObject;
+               token = reader.Read())
+          {
+            if (token.Equals("code"))
+            {
+              errorCode = reader.ReadString();
+            }
+            else if (token.Equals("message"))
+            {
+              message = reader.ReadString();
+            }
+            else
+            {
+              reader.SkipValue();
+            }
+          }
+        }
       }
       else
       {
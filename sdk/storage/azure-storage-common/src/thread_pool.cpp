@@ -0,0 +1,211 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/thread_pool.hpp"
+
+#include <algorithm>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  namespace {
+    // The pool and the worker the current thread belongs to, if any.
+    thread_local ThreadPool* t_currentPool = nullptr;
+    thread_local void* t_currentWorker = nullptr;
+  } // namespace
+
+  ThreadPool::ThreadPool(std::size_t maxThreads)
+      : m_maxThreads(std::max<std::size_t>(maxThreads, 1))
+  {
+  }
+
+  ThreadPool::~ThreadPool()
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      m_stopped = true;
+    }
+    m_cv.notify_all();
+    for (auto& worker : m_workers)
+    {
+      if (worker->Thread.joinable() && worker->Thread.get_id() != std::this_thread::get_id())
+      {
+        worker->Thread.join();
+      }
+      else if (worker->Thread.joinable())
+      {
+        worker->Thread.detach();
+      }
+    }
+  }
+
+  ThreadPool& ThreadPool::GetTransferThreadPool()
+  {
+    static ThreadPool pool([]() {
+      // Transfers are mostly waiting on the network, so allow a few threads per core.
+      constexpr std::size_t c_minThreads = 32;
+      constexpr std::size_t c_threadsPerCore = 4;
+      return std::max<std::size_t>(
+          c_minThreads, c_threadsPerCore * std::thread::hardware_concurrency());
+    }());
+    return pool;
+  }
+
+  void ThreadPool::Submit(std::function<void()> task) { Enqueue(std::move(task), false); }
+
+  void ThreadPool::SubmitShared(std::function<void()> task) { Enqueue(std::move(task), true); }
+
+  void ThreadPool::Enqueue(std::function<void()> task, bool shared)
+  {
+    if (t_currentPool == this && !shared)
+    {
+      Worker* worker = static_cast<Worker*>(t_currentWorker);
+      std::lock_guard<std::mutex> guard(worker->Mutex);
+      worker->Tasks.push_back(std::move(task));
+      ++m_numPendingTasks;
+    }
+    else
+    {
+      std::lock_guard<std::mutex> guard(m_mutex);
+      m_tasks.push_back(std::move(task));
+      ++m_numPendingTasks;
+    }
+
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (m_numIdleThreads != 0)
+    {
+      m_cv.notify_one();
+    }
+    else if (m_numRunningThreads < m_maxThreads && !m_stopped)
+    {
+      SpawnWorker();
+    }
+  }
+
+  void ThreadPool::SetMaxThreads(std::size_t maxThreads)
+  {
+    m_maxThreads = std::max<std::size_t>(maxThreads, 1);
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_cv.notify_all();
+    while (!m_stopped && m_numRunningThreads < m_maxThreads
+        && static_cast<int64_t>(m_numRunningThreads - m_numIdleThreads) < m_numPendingTasks)
+    {
+      SpawnWorker();
+    }
+  }
+
+  void ThreadPool::SpawnWorker()
+  {
+    // m_mutex must be held by the caller.
+    Worker* worker = nullptr;
+    for (auto& w : m_workers)
+    {
+      if (!w->Running)
+      {
+        worker = w.get();
+        break;
+      }
+    }
+    if (worker == nullptr)
+    {
+      m_workers.emplace_back(std::make_unique<Worker>());
+      worker = m_workers.back().get();
+    }
+    else if (worker->Thread.joinable())
+    {
+      // The previous thread in this slot has exited, or is about to.
+      worker->Thread.join();
+    }
+    worker->Running = true;
+    ++m_numRunningThreads;
+    worker->Thread = std::thread([this, worker]() { WorkerFunc(worker); });
+  }
+
+  bool ThreadPool::TryPopTask(Worker* worker, std::function<void()>& task)
+  {
+    if (m_numPendingTasks == 0)
+    {
+      return false;
+    }
+    {
+      std::lock_guard<std::mutex> guard(worker->Mutex);
+      if (!worker->Tasks.empty())
+      {
+        task = std::move(worker->Tasks.front());
+        worker->Tasks.pop_front();
+        --m_numPendingTasks;
+        return true;
+      }
+    }
+    std::lock_guard<std::mutex> guard(m_mutex);
+    if (!m_tasks.empty())
+    {
+      task = std::move(m_tasks.front());
+      m_tasks.pop_front();
+      --m_numPendingTasks;
+      return true;
+    }
+    for (auto& victim : m_workers)
+    {
+      if (victim.get() == worker)
+      {
+        continue;
+      }
+      std::lock_guard<std::mutex> victimGuard(victim->Mutex);
+      if (!victim->Tasks.empty())
+      {
+        task = std::move(victim->Tasks.back());
+        victim->Tasks.pop_back();
+        --m_numPendingTasks;
+        return true;
+      }
+    }
+    return false;
+  }
+
+  void ThreadPool::WorkerFunc(Worker* worker)
+  {
+    t_currentPool = this;
+    t_currentWorker = worker;
+
+    std::function<void()> task;
+    while (true)
+    {
+      if (TryPopTask(worker, task))
+      {
+        try
+        {
+          task();
+        }
+        catch (...)
+        {
+        }
+        task = nullptr;
+        continue;
+      }
+
+      std::unique_lock<std::mutex> guard(m_mutex);
+      bool surplus = false;
+      if (m_numRunningThreads > m_maxThreads)
+      {
+        std::lock_guard<std::mutex> workerGuard(worker->Mutex);
+        surplus = worker->Tasks.empty();
+      }
+      if (m_stopped || surplus)
+      {
+        --m_numRunningThreads;
+        worker->Running = false;
+        return;
+      }
+      if (m_numPendingTasks != 0)
+      {
+        continue;
+      }
+      ++m_numIdleThreads;
+      m_cv.wait(guard, [this]() {
+        return m_stopped || m_numPendingTasks != 0 || m_numRunningThreads > m_maxThreads;
+      });
+      --m_numIdleThreads;
+    }
+  }
+
+}}} // namespace Azure::Storage::Details
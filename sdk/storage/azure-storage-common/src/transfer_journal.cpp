@@ -0,0 +1,119 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/transfer_journal.hpp"
+
+#include <cstdio>
+#include <stdexcept>
+
+namespace Azure { namespace Storage { namespace Details {
+
+  namespace {
+    constexpr const char* c_journalMagic = "azure-storage-transfer-journal-1";
+
+    std::string JournalLayout(int64_t length, int64_t chunkSize)
+    {
+      return std::to_string(length) + " " + std::to_string(chunkSize);
+    }
+  } // namespace
+
+  TransferJournal::TransferJournal(
+      const std::string& fileName,
+      const std::string& identity,
+      int64_t length,
+      int64_t chunkSize)
+      : m_fileName(fileName)
+  {
+    const int64_t numChunks = chunkSize > 0 ? (length + chunkSize - 1) / chunkSize : 0;
+    m_doneChunks.resize(static_cast<std::size_t>(numChunks));
+    bool partialLine = false;
+
+    {
+      std::ifstream existing(fileName);
+      std::string magic;
+      std::string existingIdentity;
+      std::string layout;
+      if (std::getline(existing, magic) && magic == c_journalMagic
+          && std::getline(existing, existingIdentity) && existingIdentity == identity
+          && std::getline(existing, layout) && layout == JournalLayout(length, chunkSize))
+      {
+        m_resumed = true;
+        std::string line;
+        while (std::getline(existing, line))
+        {
+          if (existing.eof())
+          {
+            // The last line wasn't completely written.
+            partialLine = !line.empty();
+            break;
+          }
+          int64_t chunkId = -1;
+          try
+          {
+            std::size_t parsedLength = 0;
+            chunkId = std::stoll(line, &parsedLength);
+            if (parsedLength != line.size())
+            {
+              continue;
+            }
+          }
+          catch (std::exception&)
+          {
+            continue;
+          }
+          if (chunkId >= 0 && chunkId < numChunks)
+          {
+            m_doneChunks[static_cast<std::size_t>(chunkId)] = true;
+          }
+        }
+      }
+    }
+
+    if (m_resumed)
+    {
+      m_stream.open(fileName, std::ios::out | std::ios::app);
+      if (partialLine)
+      {
+        // Invalidates it, so that it is never read as a chunk ID.
+        m_stream << "#\n";
+      }
+    }
+    else
+    {
+      m_stream.open(fileName, std::ios::out | std::ios::trunc);
+      m_stream << c_journalMagic << '\n'
+               << identity << '\n'
+               << JournalLayout(length, chunkSize) << '\n';
+      m_stream.flush();
+    }
+    if (!m_stream)
+    {
+      throw std::runtime_error("failed to open checkpoint file");
+    }
+  }
+
+  bool TransferJournal::IsChunkDone(int64_t chunkId) const
+  {
+    return chunkId >= 0 && chunkId < static_cast<int64_t>(m_doneChunks.size())
+        && m_doneChunks[static_cast<std::size_t>(chunkId)];
+  }
+
+  void TransferJournal::SetChunkDone(int64_t chunkId)
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_stream << chunkId << '\n';
+    m_stream.flush();
+    if (!m_stream)
+    {
+      throw std::runtime_error("failed to write checkpoint file");
+    }
+  }
+
+  void TransferJournal::Remove()
+  {
+    std::lock_guard<std::mutex> guard(m_mutex);
+    m_stream.close();
+    std::remove(m_fileName.data());
+  }
+
+}}} // namespace Azure::Storage::Details
@@ -0,0 +1,317 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/transfer_manager.hpp"
+
+#include "azure/storage/common/thread_pool.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <map>
+#include <stdexcept>
+
+namespace Azure { namespace Storage {
+
+  namespace Details {
+
+    struct TransferManagerState
+    {
+      explicit TransferManagerState(const TransferManagerOptions& options)
+          : MaxConcurrentRequests(std::max(options.MaxConcurrentRequests, 1)),
+            MaxBytesPerSecond(
+                options.MaxBytesPerSecond.HasValue() ? options.MaxBytesPerSecond.GetValue() : 0),
+            Tokens(static_cast<double>(MaxBytesPerSecond)),
+            LastRefill(std::chrono::steady_clock::now())
+      {
+      }
+
+      const int MaxConcurrentRequests;
+      const int64_t MaxBytesPerSecond;
+
+      std::mutex Mutex;
+      std::condition_variable Cv;
+      int NumInFlightRequests = 0;
+      int NumWaitingInteractive = 0;
+
+      // Token bucket for the bandwidth cap. It holds at most one second worth of bytes and may go
+      // into debt, so a request bigger than the bucket just delays the following ones.
+      double Tokens;
+      std::chrono::steady_clock::time_point LastRefill;
+
+      void RefillTokens()
+      {
+        auto now = std::chrono::steady_clock::now();
+        double elapsedSeconds = std::chrono::duration<double>(now - LastRefill).count();
+        LastRefill = now;
+        Tokens = std::min(
+            Tokens + elapsedSeconds * static_cast<double>(MaxBytesPerSecond),
+            static_cast<double>(MaxBytesPerSecond));
+      }
+    };
+
+    // The contexts bound to a transfer, so that cancelling the transfer cancels them.
+    struct BoundContexts
+    {
+      std::mutex Mutex;
+      bool Cancelled = false;
+      uint64_t NextId = 0;
+      std::map<uint64_t, Azure::Core::Context> Contexts;
+    };
+
+    namespace {
+      constexpr const char* c_boundContextKey = "AzureStorageTransferBinding";
+
+      // Lives in the context returned by BindContext and forgets the bound context once every copy
+      // of it is gone, so bound contexts don't pile up on a handle that's reused.
+      struct ContextBinding : public Azure::Core::ValueBase
+      {
+        ContextBinding(std::shared_ptr<BoundContexts> boundContexts, uint64_t id)
+            : Owner(std::move(boundContexts)), Id(id)
+        {
+        }
+
+        ~ContextBinding() override
+        {
+          std::lock_guard<std::mutex> guard(Owner->Mutex);
+          Owner->Contexts.erase(Id);
+        }
+
+        std::shared_ptr<BoundContexts> Owner;
+        uint64_t Id;
+      };
+    } // namespace
+
+    TransferSlot::TransferSlot(std::shared_ptr<TransferHandle> handle, int64_t bytes)
+        : m_handle(std::move(handle))
+    {
+      if (!m_handle)
+      {
+        return;
+      }
+
+      auto& state = *m_handle->m_manager;
+      const bool interactive = m_handle->GetPriority() == TransferPriority::Interactive;
+
+      std::unique_lock<std::mutex> guard(state.Mutex);
+      auto throwIfCancelled = [this]() {
+        if (m_handle->IsCancelled())
+        {
+          throw Azure::Core::OperationCanceledException("Transfer was cancelled.");
+        }
+      };
+
+      // An interactive transfer only holds back bulk transfers while it's waiting for a request
+      // slot, not while it's paused, cancelled or waiting for the bandwidth cap.
+      bool waitingInteractive = false;
+      auto setWaitingInteractive = [&](bool waiting) {
+        if (interactive && waiting != waitingInteractive)
+        {
+          state.NumWaitingInteractive += waiting ? 1 : -1;
+          waitingInteractive = waiting;
+          if (!waiting)
+          {
+            state.Cv.notify_all();
+          }
+        }
+      };
+      bool holdsSlot = false;
+      try
+      {
+        while (true)
+        {
+          throwIfCancelled();
+          const bool paused = m_handle->IsPaused();
+          setWaitingInteractive(!paused);
+          if (!paused && state.NumInFlightRequests < state.MaxConcurrentRequests
+              && (interactive || state.NumWaitingInteractive == 0))
+          {
+            break;
+          }
+          state.Cv.wait(guard);
+        }
+        setWaitingInteractive(false);
+        // The slot is taken before waiting for bandwidth, so the request budget isn't exceeded by
+        // requests that got past the check meanwhile.
+        ++state.NumInFlightRequests;
+        holdsSlot = true;
+
+        if (state.MaxBytesPerSecond > 0)
+        {
+          while (true)
+          {
+            state.RefillTokens();
+            if (state.Tokens >= 0)
+            {
+              state.Tokens -= static_cast<double>(bytes);
+              break;
+            }
+            auto wait = std::chrono::duration<double>(
+                -state.Tokens / static_cast<double>(state.MaxBytesPerSecond));
+            state.Cv.wait_for(guard, wait);
+            throwIfCancelled();
+          }
+        }
+      }
+      catch (...)
+      {
+        setWaitingInteractive(false);
+        if (holdsSlot)
+        {
+          --state.NumInFlightRequests;
+          state.Cv.notify_all();
+        }
+        m_handle.reset();
+        throw;
+      }
+    }
+
+    TransferSlot::~TransferSlot() { Release(); }
+
+    void TransferSlot::Complete(int64_t bytesTransferred)
+    {
+      if (m_handle)
+      {
+        m_handle->m_bytesTransferred += bytesTransferred;
+      }
+      Release();
+    }
+
+    void TransferSlot::Release()
+    {
+      if (!m_handle)
+      {
+        return;
+      }
+      auto& state = *m_handle->m_manager;
+      {
+        std::lock_guard<std::mutex> guard(state.Mutex);
+        --state.NumInFlightRequests;
+      }
+      state.Cv.notify_all();
+      m_handle.reset();
+    }
+
+    void SubmitTransferTask(
+        std::shared_ptr<TransferHandle> handle,
+        std::function<void()> task,
+        bool shared)
+    {
+      auto runUnlessPaused = [handle, task]() {
+        if (handle)
+        {
+          std::lock_guard<std::mutex> guard(handle->m_manager->Mutex);
+          if (handle->IsPaused() && !handle->IsCancelled())
+          {
+            handle->m_parkedTasks.push_back(
+                [handle, task]() { SubmitTransferTask(handle, task, true); });
+            return;
+          }
+        }
+        task();
+      };
+      auto& threadPool = ThreadPool::GetTransferThreadPool();
+      if (shared)
+      {
+        threadPool.SubmitShared(std::move(runUnlessPaused));
+      }
+      else
+      {
+        threadPool.Submit(std::move(runUnlessPaused));
+      }
+    }
+
+  } // namespace Details
+
+  TransferHandle::TransferHandle(
+      std::shared_ptr<Details::TransferManagerState> manager,
+      TransferPriority priority)
+      : m_manager(std::move(manager)), m_priority(priority),
+        m_boundContexts(std::make_shared<Details::BoundContexts>())
+  {
+  }
+
+  void TransferHandle::Pause()
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_manager->Mutex);
+      m_paused = true;
+    }
+    // Paused interactive requests stop holding back bulk requests.
+    m_manager->Cv.notify_all();
+  }
+
+  void TransferHandle::Resume()
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_manager->Mutex);
+      m_paused = false;
+    }
+    m_manager->Cv.notify_all();
+    SubmitParkedTasks();
+  }
+
+  void TransferHandle::Cancel()
+  {
+    {
+      std::lock_guard<std::mutex> guard(m_manager->Mutex);
+      m_cancelled = true;
+    }
+    m_manager->Cv.notify_all();
+    // Parked tasks run to find out the transfer is cancelled.
+    SubmitParkedTasks();
+
+    std::lock_guard<std::mutex> guard(m_boundContexts->Mutex);
+    m_boundContexts->Cancelled = true;
+    for (auto& context : m_boundContexts->Contexts)
+    {
+      context.second.Cancel();
+    }
+  }
+
+  void TransferHandle::SubmitParkedTasks()
+  {
+    std::vector<std::function<void()>> parkedTasks;
+    {
+      std::lock_guard<std::mutex> guard(m_manager->Mutex);
+      parkedTasks.swap(m_parkedTasks);
+    }
+    for (auto& task : parkedTasks)
+    {
+      task();
+    }
+  }
+
+  Azure::Core::Context TransferHandle::BindContext(const Azure::Core::Context& context)
+  {
+    auto childContext = context.WithDeadline(Azure::Core::Context::time_point::max());
+    uint64_t id = 0;
+    {
+      std::lock_guard<std::mutex> guard(m_boundContexts->Mutex);
+      if (m_boundContexts->Cancelled)
+      {
+        childContext.Cancel();
+        return childContext;
+      }
+      id = m_boundContexts->NextId++;
+      m_boundContexts->Contexts.emplace(id, childContext);
+    }
+    // The handle keeps the cancellable context, the caller gets a child of it holding the binding.
+    return childContext.WithValue(
+        Details::c_boundContextKey,
+        std::unique_ptr<Azure::Core::ValueBase>(
+            std::make_unique<Details::ContextBinding>(m_boundContexts, id)));
+  }
+
+  TransferManager::TransferManager(const TransferManagerOptions& options)
+      : m_state(std::make_shared<Details::TransferManagerState>(options))
+  {
+  }
+
+  std::shared_ptr<TransferHandle> TransferManager::CreateTransfer(TransferPriority priority)
+  {
+    return std::shared_ptr<TransferHandle>(new TransferHandle(m_state, priority));
+  }
+
+}} // namespace Azure::Storage
@@ -3,162 +3,681 @@
 
 #include "azure/storage/common/xml_wrapper.hpp"
 
-#include "libxml/xmlreader.h"
-#include "libxml/xmlwriter.h"
-
-#include <limits>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
 #include <stdexcept>
 
 namespace Azure { namespace Storage { namespace Details {
 
-  struct XmlGlobalInitializer
+  namespace {
+    bool IsXmlWhitespace(char c) { return c == ' ' || c == '\t' || c == '\n' || c == '\r'; }
+
+    bool IsNameTerminator(char c)
+    {
+      return IsXmlWhitespace(c) || c == '>' || c == '/' || c == '=' || c == '<' || c == '\0';
+    }
+
+    std::size_t EncodeUtf8(uint32_t codePoint, char* out)
+    {
+      if (codePoint < 0x80)
+      {
+        out[0] = static_cast<char>(codePoint);
+        return 1;
+      }
+      if (codePoint < 0x800)
+      {
+        out[0] = static_cast<char>(0xc0 | (codePoint >> 6));
+        out[1] = static_cast<char>(0x80 | (codePoint & 0x3f));
+        return 2;
+      }
+      if (codePoint < 0x10000)
+      {
+        out[0] = static_cast<char>(0xe0 | (codePoint >> 12));
+        out[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+        out[2] = static_cast<char>(0x80 | (codePoint & 0x3f));
+        return 3;
+      }
+      out[0] = static_cast<char>(0xf0 | (codePoint >> 18));
+      out[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3f));
+      out[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3f));
+      out[3] = static_cast<char>(0x80 | (codePoint & 0x3f));
+      return 4;
+    }
+
+    std::array<uint8_t, 256> MakeXmlEscapeClass()
+    {
+      std::array<uint8_t, 256> table{};
+      for (char c : {'\0', '&', '<', '>', '\r', '"', '\n', '\t'})
+      {
+        table[static_cast<unsigned char>(c)] = 1;
+      }
+      return table;
+    }
+
+    // Non-zero for the characters that may have to be escaped when writing a document.
+    const std::array<uint8_t, 256> c_xmlEscapeClass = MakeXmlEscapeClass();
+  } // namespace
+
+  XmlReader::XmlReader(const char* data, std::size_t length) : m_buffer(data, length)
   {
-    XmlGlobalInitializer() { xmlInitParser(); }
-    ~XmlGlobalInitializer() { xmlCleanupParser(); }
-  };
+    // Skip the UTF-8 byte order mark.
+    if (m_buffer.compare(0, 3, "\xef\xbb\xbf") == 0)
+    {
+      m_pos = 3;
+    }
+  }
 
-  static void XmlGlobalInitialize() { static XmlGlobalInitializer globalInitializer; }
+  XmlReader::XmlReader(const Azure::Core::Context& context, Azure::Core::Http::BodyStream& stream)
+      : m_context(context), m_stream(&stream), m_streamEnded(false)
+  {
+    while (m_buffer.length() < 3 && FillBuffer())
+    {
+    }
+    if (m_buffer.compare(0, 3, "\xef\xbb\xbf") == 0)
+    {
+      m_pos = 3;
+    }
+  }
+
+  XmlReader::~XmlReader() {}
+
+  void XmlReader::ThrowParseError() const { throw std::runtime_error("failed to parse xml"); }
 
-  XmlReader::XmlReader(const char* data, std::size_t length)
+  void XmlReader::ThrowUnexpectedEnd() const
   {
-    XmlGlobalInitialize();
+    if (!m_streamEnded)
+    {
+      throw NeedMoreData();
+    }
+    ThrowParseError();
+  }
 
-    if (length > static_cast<std::size_t>(std::numeric_limits<int>::max()))
+  bool XmlReader::FillBuffer()
+  {
+    if (m_streamEnded)
     {
-      throw std::runtime_error("xml data too big");
+      return false;
     }
+    // Everything before the token being parsed has been returned already.
+    m_buffer.erase(0, m_pos);
+    m_pos = 0;
 
-    m_reader = xmlReaderForMemory(data, static_cast<int>(length), nullptr, nullptr, 0);
-    if (!m_reader)
+    constexpr std::size_t c_readSize = 64 * 1024;
+    const std::size_t oldLength = m_buffer.length();
+    m_buffer.resize(oldLength + c_readSize);
+    const int64_t bytesRead = m_stream->Read(
+        m_context, reinterpret_cast<uint8_t*>(&m_buffer[oldLength]), c_readSize);
+    m_buffer.resize(oldLength + static_cast<std::size_t>(bytesRead));
+    if (bytesRead == 0)
     {
-      throw std::runtime_error("failed to parse xml");
+      m_streamEnded = true;
+      return false;
     }
+    return true;
   }
 
-  XmlReader::~XmlReader() { xmlFreeTextReader(m_reader); }
+  void XmlReader::SkipWhitespace()
+  {
+    while (m_pos < m_buffer.length() && IsXmlWhitespace(m_buffer[m_pos]))
+    {
+      ++m_pos;
+    }
+  }
 
-  XmlNode XmlReader::Read()
+  std::size_t XmlReader::ParseName()
+  {
+    const std::size_t begin = m_pos;
+    while (m_pos < m_buffer.length() && !IsNameTerminator(m_buffer[m_pos]))
+    {
+      ++m_pos;
+    }
+    if (m_pos == m_buffer.length())
+    {
+      ThrowUnexpectedEnd();
+    }
+    if (m_pos == begin)
+    {
+      ThrowParseError();
+    }
+    return m_pos;
+  }
+
+  std::size_t XmlReader::DecodeInPlace(std::size_t begin, std::size_t end)
   {
-    if (m_readingAttributes)
+    char* buffer = &m_buffer[0];
+    std::size_t read = begin;
+    while (read < end && buffer[read] != '&' && buffer[read] != '\r')
     {
-      int ret = xmlTextReaderMoveToNextAttribute(m_reader);
-      if (ret == 1)
+      ++read;
+    }
+    // The decoded text is never longer than the original, so it's written over it.
+    std::size_t write = read;
+    while (read < end)
+    {
+      const char c = buffer[read];
+      if (c == '\r')
+      {
+        // Line endings are normalized to \n.
+        buffer[write++] = '\n';
+        read += (read + 1 < end && buffer[read + 1] == '\n') ? 2 : 1;
+        continue;
+      }
+      if (c != '&')
+      {
+        buffer[write++] = c;
+        ++read;
+        continue;
+      }
+
+      const char* entityEnd = static_cast<const char*>(
+          std::memchr(buffer + read, ';', std::min<std::size_t>(end - read, 12)));
+      if (entityEnd == nullptr)
+      {
+        ThrowParseError();
+      }
+      const char* entityBegin = buffer + read + 1;
+      const std::string entity(entityBegin, entityEnd);
+      read = static_cast<std::size_t>(entityEnd - buffer) + 1;
+      if (entity == "lt")
+      {
+        buffer[write++] = '<';
+      }
+      else if (entity == "gt")
       {
-        const char* name = reinterpret_cast<const char*>(xmlTextReaderName(m_reader));
-        const char* value = reinterpret_cast<const char*>(xmlTextReaderValue(m_reader));
-        return XmlNode{XmlNodeType::Attribute, name, value};
+        buffer[write++] = '>';
       }
-      else if (ret == 0)
+      else if (entity == "amp")
       {
-        m_readingAttributes = false;
+        buffer[write++] = '&';
+      }
+      else if (entity == "quot")
+      {
+        buffer[write++] = '"';
+      }
+      else if (entity == "apos")
+      {
+        buffer[write++] = '\'';
+      }
+      else if (entity.length() > 1 && entity[0] == '#')
+      {
+        const bool hex = entity[1] == 'x';
+        const std::size_t digitsBegin = hex ? 2 : 1;
+        if (digitsBegin == entity.length())
+        {
+          ThrowParseError();
+        }
+        uint32_t codePoint = 0;
+        for (std::size_t i = digitsBegin; i < entity.length(); ++i)
+        {
+          const char d = entity[i];
+          uint32_t digit;
+          if (d >= '0' && d <= '9')
+          {
+            digit = static_cast<uint32_t>(d - '0');
+          }
+          else if (hex && d >= 'a' && d <= 'f')
+          {
+            digit = static_cast<uint32_t>(d - 'a' + 10);
+          }
+          else if (hex && d >= 'A' && d <= 'F')
+          {
+            digit = static_cast<uint32_t>(d - 'A' + 10);
+          }
+          else
+          {
+            ThrowParseError();
+          }
+          codePoint = codePoint * (hex ? 16 : 10) + digit;
+          if (codePoint > 0x10ffff)
+          {
+            ThrowParseError();
+          }
+        }
+        write += EncodeUtf8(codePoint, buffer + write);
       }
       else
       {
-        throw std::runtime_error("failed to parse xml");
+        ThrowParseError();
       }
     }
+    return write;
+  }
 
-    int ret = xmlTextReaderRead(m_reader);
-    if (ret == 0)
-    {
-      return XmlNode{XmlNodeType::End};
-    }
-    if (ret != 1)
+  XmlNode XmlReader::ParseStartTag()
+  {
+    // Nothing is written to the buffer until the whole tag has been scanned, so that parsing can
+    // restart from the beginning of the tag once more data has been read.
+    const std::size_t nameBegin = m_pos;
+    const std::size_t nameEnd = ParseName();
+    bool selfClosing = false;
+    while (true)
     {
-      throw std::runtime_error("failed to parse xml");
-    }
-
-    int type = xmlTextReaderNodeType(m_reader);
-    bool is_empty = xmlTextReaderIsEmptyElement(m_reader) == 1;
-    bool has_value = xmlTextReaderHasValue(m_reader) == 1;
-    bool has_attributes = xmlTextReaderHasAttributes(m_reader) == 1;
+      SkipWhitespace();
+      if (m_pos + 1 >= m_buffer.length())
+      {
+        ThrowUnexpectedEnd();
+      }
+      if (m_buffer[m_pos] == '>')
+      {
+        ++m_pos;
+        break;
+      }
+      if (m_buffer[m_pos] == '/' && m_buffer[m_pos + 1] == '>')
+      {
+        m_pos += 2;
+        selfClosing = true;
+        break;
+      }
 
-    const char* name = reinterpret_cast<const char*>(xmlTextReaderName(m_reader));
-    const char* value = reinterpret_cast<const char*>(xmlTextReaderValue(m_reader));
+      AttributeRange attribute;
+      attribute.NameBegin = m_pos;
+      attribute.NameEnd = ParseName();
+      SkipWhitespace();
+      if (m_pos >= m_buffer.length())
+      {
+        ThrowUnexpectedEnd();
+      }
+      if (m_buffer[m_pos] != '=')
+      {
+        ThrowParseError();
+      }
+      ++m_pos;
+      SkipWhitespace();
+      if (m_pos >= m_buffer.length())
+      {
+        ThrowUnexpectedEnd();
+      }
+      if (m_buffer[m_pos] != '"' && m_buffer[m_pos] != '\'')
+      {
+        ThrowParseError();
+      }
+      const char quote = m_buffer[m_pos++];
+      attribute.ValueBegin = m_pos;
+      attribute.ValueEnd = m_buffer.find(quote, m_pos);
+      if (attribute.ValueEnd == std::string::npos)
+      {
+        ThrowUnexpectedEnd();
+      }
+      m_pos = attribute.ValueEnd + 1;
+      m_attributes.push_back(attribute);
+    }
 
-    if (has_attributes)
+    char* buffer = &m_buffer[0];
+    for (const auto& attribute : m_attributes)
     {
-      m_readingAttributes = true;
+      buffer[attribute.NameEnd] = '\0';
+      buffer[DecodeInPlace(attribute.ValueBegin, attribute.ValueEnd)] = '\0';
     }
+    // The terminator may overwrite the '>' or '/' that ended the name, which was consumed above.
+    buffer[nameEnd] = '\0';
 
-    if (type == XML_READER_TYPE_ELEMENT && is_empty)
+    if (selfClosing)
     {
-      return XmlNode{XmlNodeType::SelfClosingTag, name};
+      m_lastWasStartTag = false;
+      return XmlNode{XmlNodeType::SelfClosingTag, buffer + nameBegin};
     }
-    else if (type == XML_READER_TYPE_ELEMENT)
+    if (m_depth == m_openTags.size())
     {
-      return XmlNode{XmlNodeType::StartTag, name};
+      m_openTags.emplace_back();
     }
-    else if (type == XML_READER_TYPE_END_ELEMENT)
+    m_openTags[m_depth++].assign(buffer + nameBegin, nameEnd - nameBegin);
+    m_lastWasStartTag = true;
+    return XmlNode{XmlNodeType::StartTag, buffer + nameBegin};
+  }
+
+  XmlNode XmlReader::Read()
+  {
+    if (m_nextAttribute < m_attributes.size())
     {
-      return XmlNode{XmlNodeType::EndTag, name};
+      const auto& attribute = m_attributes[m_nextAttribute++];
+      return XmlNode{
+          XmlNodeType::Attribute, &m_buffer[attribute.NameBegin], &m_buffer[attribute.ValueBegin]};
     }
-    else if (type == XML_READER_TYPE_TEXT)
+
+    while (true)
     {
-      if (has_value)
+      m_attributes.clear();
+      m_nextAttribute = 0;
+      const std::size_t pos = m_pos;
+      const bool tagOpened = m_tagOpened;
+      try
       {
-        return XmlNode{XmlNodeType::Text, nullptr, value};
+        return ReadNode();
+      }
+      catch (NeedMoreData&)
+      {
+        // Parse the incomplete token again once more data is available.
+        m_pos = pos;
+        m_tagOpened = tagOpened;
+        FillBuffer();
       }
     }
-    else if (type == XML_READER_TYPE_SIGNIFICANT_WHITESPACE)
-    {
-      // silently ignore
-    }
-    else
+  }
+
+  XmlNode XmlReader::ReadNode()
+  {
+    while (true)
     {
-      throw std::runtime_error("unknown type " + std::to_string(type) + " while parsing xml");
+      const std::size_t length = m_buffer.length();
+      if (!m_tagOpened)
+      {
+        if (m_pos >= length)
+        {
+          if (!m_streamEnded)
+          {
+            throw NeedMoreData();
+          }
+          if (m_depth != 0)
+          {
+            ThrowParseError();
+          }
+          return XmlNode{XmlNodeType::End};
+        }
+        if (m_buffer[m_pos] == '<')
+        {
+          ++m_pos;
+        }
+        else
+        {
+          const std::size_t textBegin = m_pos;
+          std::size_t textEnd = m_buffer.find('<', m_pos);
+          if (textEnd == std::string::npos)
+          {
+            if (m_depth != 0)
+            {
+              ThrowUnexpectedEnd();
+            }
+            textEnd = length;
+          }
+          const bool whitespaceOnly
+              = std::all_of(m_buffer.begin() + textBegin, m_buffer.begin() + textEnd, [](char c) {
+                  return IsXmlWhitespace(c);
+                });
+          if (m_depth == 0)
+          {
+            // Only whitespace may appear outside of the root element.
+            if (!whitespaceOnly)
+            {
+              ThrowParseError();
+            }
+            m_pos = textEnd;
+            continue;
+          }
+          if (textEnd + 1 >= length)
+          {
+            ThrowUnexpectedEnd();
+          }
+          m_pos = textEnd + 1;
+          m_tagOpened = true;
+          // Whitespace between tags is indentation, unless it's the whole content of an element.
+          if (whitespaceOnly && !(m_lastWasStartTag && m_buffer[m_pos] == '/'))
+          {
+            continue;
+          }
+          char* buffer = &m_buffer[0];
+          buffer[DecodeInPlace(textBegin, textEnd)] = '\0';
+          m_lastWasStartTag = false;
+          return XmlNode{XmlNodeType::Text, nullptr, buffer + textBegin};
+        }
+      }
+      m_tagOpened = false;
+
+      // m_pos is just past a '<'.
+      if (m_pos >= length)
+      {
+        ThrowUnexpectedEnd();
+      }
+      const char c = m_buffer[m_pos];
+      if (c == '!' && length - m_pos < 8 && !m_streamEnded)
+      {
+        throw NeedMoreData();
+      }
+      if (c == '/')
+      {
+        ++m_pos;
+        const std::size_t nameBegin = m_pos;
+        const std::size_t nameEnd = ParseName();
+        SkipWhitespace();
+        if (m_pos >= length)
+        {
+          ThrowUnexpectedEnd();
+        }
+        if (m_buffer[m_pos] != '>' || m_depth == 0
+            || m_openTags[m_depth - 1].compare(
+                   0, std::string::npos, m_buffer.data() + nameBegin, nameEnd - nameBegin)
+                != 0)
+        {
+          ThrowParseError();
+        }
+        ++m_pos;
+        --m_depth;
+        char* buffer = &m_buffer[0];
+        buffer[nameEnd] = '\0';
+        m_lastWasStartTag = false;
+        return XmlNode{XmlNodeType::EndTag, buffer + nameBegin};
+      }
+      else if (c == '?')
+      {
+        // Processing instructions, including the XML declaration, are skipped.
+        const std::size_t end = m_buffer.find("?>", m_pos);
+        if (end == std::string::npos)
+        {
+          ThrowUnexpectedEnd();
+        }
+        m_pos = end + 2;
+      }
+      else if (m_buffer.compare(m_pos, 3, "!--") == 0)
+      {
+        const std::size_t end = m_buffer.find("-->", m_pos + 3);
+        if (end == std::string::npos)
+        {
+          ThrowUnexpectedEnd();
+        }
+        m_pos = end + 3;
+      }
+      else if (m_buffer.compare(m_pos, 8, "![CDATA[") == 0)
+      {
+        if (m_depth == 0)
+        {
+          ThrowParseError();
+        }
+        const std::size_t end = m_buffer.find("]]>", m_pos + 8);
+        if (end == std::string::npos)
+        {
+          ThrowUnexpectedEnd();
+        }
+        const std::size_t textBegin = m_pos + 8;
+        m_pos = end + 3;
+        char* buffer = &m_buffer[0];
+        buffer[end] = '\0';
+        m_lastWasStartTag = false;
+        return XmlNode{XmlNodeType::Text, nullptr, buffer + textBegin};
+      }
+      else if (c == '!')
+      {
+        // Document type declarations aren't supported.
+        ThrowParseError();
+      }
+      else
+      {
+        return ParseStartTag();
+      }
     }
+  }
 
-    return Read();
+  XmlWriter::XmlWriter(std::size_t sizeHint)
+  {
+    static constexpr char c_declaration[] = "<?xml version=\"1.0\"?>\n";
+    m_buffer.reserve(std::max(sizeHint, sizeof(c_declaration)));
+    m_buffer.append(c_declaration, sizeof(c_declaration) - 1);
   }
 
-  XmlWriter::XmlWriter()
+  void XmlWriter::CloseStartTag()
   {
-    XmlGlobalInitialize();
-    m_buffer = xmlBufferCreate();
-    m_writer = xmlNewTextWriterMemory(m_buffer, 0);
-    xmlTextWriterStartDocument(m_writer, nullptr, nullptr, nullptr);
+    if (m_startTagOpen)
+    {
+      m_buffer += '>';
+      m_startTagOpen = false;
+    }
   }
 
-  XmlWriter::~XmlWriter()
+  void XmlWriter::WriteEscaped(const char* text, bool isAttribute)
   {
-    xmlFreeTextWriter(m_writer);
-    xmlBufferFree(m_buffer);
+    const char* runBegin = text;
+    for (const char* p = text;; ++p)
+    {
+      // Skip ahead over the characters that don't need escaping, which is nearly all of them.
+      while (c_xmlEscapeClass[static_cast<unsigned char>(*p)] == 0)
+      {
+        ++p;
+      }
+      const char* entity = nullptr;
+      switch (*p)
+      {
+        case '\0':
+          m_buffer.append(runBegin, p - runBegin);
+          return;
+        case '&':
+          entity = "&amp;";
+          break;
+        case '<':
+          entity = "&lt;";
+          break;
+        case '>':
+          entity = "&gt;";
+          break;
+        case '\r':
+          entity = "&#13;";
+          break;
+        case '"':
+          entity = isAttribute ? "&quot;" : nullptr;
+          break;
+        case '\n':
+          entity = isAttribute ? "&#10;" : nullptr;
+          break;
+        case '\t':
+          entity = isAttribute ? "&#9;" : nullptr;
+          break;
+        default:
+          break;
+      }
+      if (entity)
+      {
+        m_buffer.append(runBegin, p - runBegin);
+        m_buffer.append(entity);
+        runBegin = p + 1;
+      }
+    }
   }
 
   void XmlWriter::Write(XmlNode node)
   {
-    if (node.Type == XmlNodeType::StartTag)
+    if (node.Type == XmlNodeType::StartTag && node.Value)
     {
-      if (!node.Value)
+      // An element with text content, such as one block of a block list.
+      CloseStartTag();
+      const char* valueEnd = node.Value;
+      while (c_xmlEscapeClass[static_cast<unsigned char>(*valueEnd)] == 0)
       {
-        xmlTextWriterStartElement(m_writer, BAD_CAST(node.Name));
+        ++valueEnd;
+      }
+      if (*valueEnd == '\0')
+      {
+        // Nothing to escape, so the element is written in one go.
+        const std::size_t nameLength = std::strlen(node.Name);
+        const std::size_t valueLength = valueEnd - node.Value;
+        const std::size_t oldLength = m_buffer.length();
+        m_buffer.resize(oldLength + nameLength * 2 + valueLength + 5);
+        char* out = &m_buffer[oldLength];
+        *out++ = '<';
+        std::memcpy(out, node.Name, nameLength);
+        out += nameLength;
+        *out++ = '>';
+        std::memcpy(out, node.Value, valueLength);
+        out += valueLength;
+        *out++ = '<';
+        *out++ = '/';
+        std::memcpy(out, node.Name, nameLength);
+        out += nameLength;
+        *out = '>';
       }
       else
       {
-        xmlTextWriterWriteElement(m_writer, BAD_CAST(node.Name), BAD_CAST(node.Value));
+        m_buffer += '<';
+        m_buffer.append(node.Name);
+        m_buffer += '>';
+        WriteEscaped(node.Value, false);
+        m_buffer.append("</", 2);
+        m_buffer.append(node.Name);
+        m_buffer += '>';
+      }
+    }
+    else if (node.Type == XmlNodeType::StartTag)
+    {
+      CloseStartTag();
+      m_buffer += '<';
+      m_buffer.append(node.Name);
+      if (m_depth == m_openTags.size())
+      {
+        m_openTags.emplace_back();
       }
+      m_openTags[m_depth++].assign(node.Name);
+      m_startTagOpen = true;
     }
     else if (node.Type == XmlNodeType::EndTag)
     {
-      xmlTextWriterEndElement(m_writer);
+      if (m_depth == 0)
+      {
+        throw std::runtime_error("unbalanced xml end tag");
+      }
+      const std::string& name = m_openTags[--m_depth];
+      if (m_startTagOpen)
+      {
+        m_buffer.append("/>", 2);
+        m_startTagOpen = false;
+      }
+      else
+      {
+        m_buffer.append("</", 2);
+        m_buffer.append(name);
+        m_buffer += '>';
+      }
     }
     else if (node.Type == XmlNodeType::SelfClosingTag)
     {
-      xmlTextWriterStartElement(m_writer, BAD_CAST(node.Name));
-      xmlTextWriterEndElement(m_writer);
+      CloseStartTag();
+      m_buffer += '<';
+      m_buffer.append(node.Name);
+      m_buffer.append("/>", 2);
     }
     else if (node.Type == XmlNodeType::Text)
     {
-      xmlTextWriterWriteString(m_writer, BAD_CAST(node.Value));
+      CloseStartTag();
+      if (node.Value)
+      {
+        WriteEscaped(node.Value, false);
+      }
     }
     else if (node.Type == XmlNodeType::Attribute)
     {
-      xmlTextWriterWriteAttribute(m_writer, BAD_CAST(node.Name), BAD_CAST(node.Value));
+      if (!m_startTagOpen)
+      {
+        throw std::runtime_error("xml attribute must follow a start tag");
+      }
+      m_buffer += ' ';
+      m_buffer.append(node.Name);
+      m_buffer.append("=\"", 2);
+      WriteEscaped(node.Value, true);
+      m_buffer += '"';
     }
     else if (node.Type == XmlNodeType::End)
     {
-      xmlTextWriterEndDocument(m_writer);
+      while (m_depth != 0)
+      {
+        Write(XmlNode{XmlNodeType::EndTag});
+      }
     }
     else
     {
@@ -170,8 +689,67 @@ namespace Azure { namespace Storage { namespace Details {
 
   std::string XmlWriter::GetDocument()
   {
-    xmlTextWriterFlush(m_writer);
-    return std::string(reinterpret_cast<const char*>(m_buffer->content), m_buffer->use);
+    std::string document = std::move(m_buffer);
+    m_buffer.clear();
+    return document;
+  }
+
+  XmlBodyStream::XmlBodyStream(std::function<bool(XmlWriter&, std::size_t)> writePart)
+      : m_writePart(std::move(writePart))
+  {
+    constexpr std::size_t c_maxBufferedLength = 64 * 1024;
+
+    XmlWriter writer;
+    bool morePartsFollow = true;
+    std::size_t part = 0;
+    while (morePartsFollow && writer.m_buffer.length() < c_maxBufferedLength)
+    {
+      morePartsFollow = m_writePart(writer, part++);
+    }
+    m_bufferedDocument = std::move(writer.m_buffer);
+    writer.m_buffer = std::string();
+    m_bufferedWriter = writer;
+    m_numBufferedParts = part;
+    m_allPartsBuffered = !morePartsFollow;
+    m_length = static_cast<int64_t>(m_bufferedDocument.length());
+
+    while (morePartsFollow)
+    {
+      writer.m_buffer.clear();
+      morePartsFollow = m_writePart(writer, part++);
+      m_length += static_cast<int64_t>(writer.m_buffer.length());
+    }
+    Rewind();
+  }
+
+  void XmlBodyStream::Rewind()
+  {
+    m_writer = m_bufferedWriter;
+    m_writer.m_buffer = m_bufferedDocument;
+    m_offset = 0;
+    m_nextPart = m_numBufferedParts;
+    m_lastPartWritten = m_allPartsBuffered;
+  }
+
+  int64_t XmlBodyStream::Read(const Azure::Core::Context&, uint8_t* buffer, int64_t count)
+  {
+    std::string& document = m_writer.m_buffer;
+    while (m_offset == document.length())
+    {
+      if (m_lastPartWritten)
+      {
+        return 0;
+      }
+      // The buffer keeps its capacity, so it's only allocated for the largest part.
+      document.clear();
+      m_offset = 0;
+      m_lastPartWritten = !m_writePart(m_writer, m_nextPart++);
+    }
+    const std::size_t bytesRead
+        = std::min(static_cast<std::size_t>(count), document.length() - m_offset);
+    std::memcpy(buffer, document.data() + m_offset, bytesRead);
+    m_offset += bytesRead;
+    return static_cast<int64_t>(bytesRead);
   }
 
 }}} // namespace Azure::Storage::Details
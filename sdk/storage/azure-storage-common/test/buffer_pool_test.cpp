@@ -0,0 +1,112 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/buffer_pool.hpp"
+#include "test_base.hpp"
+
+#include <chrono>
+#include <cstring>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(BufferPoolTest, Reuse)
+  {
+    Details::BufferPool pool(1024 * 1024);
+    uint8_t* data = nullptr;
+    {
+      auto buffer = pool.Acquire(5000);
+      EXPECT_EQ(buffer.Size(), 5000U);
+      data = buffer.Data();
+      std::memset(data, 0xab, buffer.Size());
+      auto statistics = pool.GetStatistics();
+      EXPECT_EQ(statistics.Misses, 1);
+      EXPECT_EQ(statistics.BytesInUse, 8192);
+    }
+    auto statistics = pool.GetStatistics();
+    EXPECT_EQ(statistics.BytesInUse, 0);
+    EXPECT_EQ(statistics.CachedBytes, 8192);
+
+    // Same size class.
+    auto buffer = pool.Acquire(8000);
+    EXPECT_EQ(buffer.Data(), data);
+    statistics = pool.GetStatistics();
+    EXPECT_EQ(statistics.Hits, 1);
+    EXPECT_EQ(statistics.CachedBytes, 0);
+
+    // Different size class.
+    auto otherBuffer = pool.Acquire(9000);
+    EXPECT_NE(otherBuffer.Data(), data);
+    statistics = pool.GetStatistics();
+    EXPECT_EQ(statistics.Misses, 2);
+    EXPECT_EQ(statistics.PeakBytes, 8192 + 16384);
+
+    // Moving hands over ownership.
+    Details::PooledBuffer movedBuffer(std::move(buffer));
+    EXPECT_EQ(buffer.Data(), nullptr);
+    EXPECT_EQ(movedBuffer.Data(), data);
+    movedBuffer = std::move(otherBuffer);
+    statistics = pool.GetStatistics();
+    EXPECT_EQ(statistics.BytesInUse, 16384);
+    EXPECT_EQ(statistics.CachedBytes, 8192);
+
+    pool.Trim();
+    EXPECT_EQ(pool.GetStatistics().CachedBytes, 0);
+  }
+
+  TEST(BufferPoolTest, Limits)
+  {
+    constexpr std::size_t maxCachedBytes = 4 * 1024 * 1024;
+    Details::BufferPool pool(maxCachedBytes);
+    {
+      std::vector<Details::PooledBuffer> buffers;
+      for (int i = 0; i < 3; ++i)
+      {
+        buffers.push_back(pool.Acquire(2 * 1024 * 1024));
+        std::memset(buffers.back().Data(), i, buffers.back().Size());
+      }
+      // Larger than the biggest size class.
+      buffers.push_back(pool.Acquire(100 * 1024 * 1024 + 1));
+      EXPECT_EQ(
+          pool.GetStatistics().PeakBytes,
+          static_cast<int64_t>(3 * 2 * 1024 * 1024 + 100 * 1024 * 1024 + 1));
+    }
+    auto statistics = pool.GetStatistics();
+    EXPECT_EQ(statistics.BytesInUse, 0);
+    EXPECT_EQ(statistics.CachedBytes, static_cast<int64_t>(maxCachedBytes));
+
+    Details::PooledBuffer buffer = pool.Acquire(0);
+    EXPECT_NE(buffer.Data(), nullptr);
+    buffer.Release();
+    EXPECT_EQ(buffer.Data(), nullptr);
+  }
+
+  TEST(BufferPoolTest, DISABLED_Throughput)
+  {
+    constexpr std::size_t bufferSize = 4 * 1024 * 1024;
+    constexpr int numIterations = 1000;
+
+    auto timer_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numIterations; ++i)
+    {
+      std::vector<uint8_t> buffer(bufferSize);
+      buffer[i % bufferSize] = 1;
+    }
+    auto timer_end = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(timer_end - timer_start);
+    std::cout << "std::vector: " << elapsed.count() / numIterations << "us per buffer"
+              << std::endl;
+
+    Details::BufferPool pool(64 * 1024 * 1024);
+    timer_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numIterations; ++i)
+    {
+      auto buffer = pool.Acquire(bufferSize);
+      buffer.Data()[i % bufferSize] = 1;
+    }
+    timer_end = std::chrono::steady_clock::now();
+    elapsed = std::chrono::duration_cast<std::chrono::microseconds>(timer_end - timer_start);
+    std::cout << "BufferPool: " << elapsed.count() / numIterations << "us per buffer" << std::endl;
+    EXPECT_EQ(pool.GetStatistics().Misses, 1);
+  }
+
+}}} // namespace Azure::Storage::Test
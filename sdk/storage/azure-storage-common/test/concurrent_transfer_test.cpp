@@ -0,0 +1,201 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/concurrent_transfer.hpp"
+#include "azure/storage/common/thread_pool.hpp"
+#include "test_base.hpp"
+
+#include <atomic>
+#include <future>
+#include <mutex>
+#include <set>
+#include <thread>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(ConcurrentTransferTest, AllChunksTransferred)
+  {
+    for (int concurrency : {1, 2, 5, 32})
+    {
+      for (int64_t length : {0, 1, 1000, 4096, 100000})
+      {
+        constexpr int64_t chunkSize = 1000;
+        std::mutex mutex;
+        std::set<int64_t> chunkIds;
+        int64_t bytesTransferred = 0;
+        Details::ConcurrentTransfer(
+            10,
+            length,
+            chunkSize,
+            concurrency,
+            [&](int64_t offset, int64_t chunkLength, int64_t chunkId, int64_t numChunks) {
+              EXPECT_EQ(numChunks, (length + chunkSize - 1) / chunkSize);
+              EXPECT_EQ(offset, 10 + chunkId * chunkSize);
+              std::lock_guard<std::mutex> guard(mutex);
+              EXPECT_TRUE(chunkIds.insert(chunkId).second);
+              bytesTransferred += chunkLength;
+            });
+        EXPECT_EQ(bytesTransferred, length);
+        EXPECT_EQ(static_cast<int64_t>(chunkIds.size()), (length + chunkSize - 1) / chunkSize);
+      }
+    }
+  }
+
+  TEST(ConcurrentTransferTest, FirstFailureCancels)
+  {
+    std::atomic<int> numChunksStarted{0};
+    EXPECT_THROW(
+        Details::ConcurrentTransfer(
+            0,
+            1000000,
+            10,
+            8,
+            [&](int64_t, int64_t, int64_t chunkId, int64_t) {
+              ++numChunksStarted;
+              if (chunkId == 5)
+              {
+                throw std::runtime_error("chunk failed");
+              }
+            }),
+        std::runtime_error);
+    EXPECT_LT(numChunksStarted.load(), 100000);
+  }
+
+  TEST(ConcurrentTransferTest, ManyTransfersShareThreadPool)
+  {
+    std::vector<std::future<int64_t>> futures;
+    for (int i = 0; i < 50; ++i)
+    {
+      futures.emplace_back(std::async(std::launch::async, []() {
+        std::atomic<int64_t> bytesTransferred{0};
+        Details::ConcurrentTransfer(
+            0, 100000, 100, 16, [&](int64_t, int64_t chunkLength, int64_t, int64_t) {
+              bytesTransferred += chunkLength;
+            });
+        return bytesTransferred.load();
+      }));
+    }
+    for (auto& f : futures)
+    {
+      EXPECT_EQ(f.get(), 100000);
+    }
+  }
+
+  TEST(ConcurrentTransferTest, CompletesWhenThreadPoolIsBlocked)
+  {
+    auto& threadPool = Details::ThreadPool::GetTransferThreadPool();
+    const std::size_t maxThreads = threadPool.GetMaxThreads();
+    threadPool.SetMaxThreads(1);
+    std::promise<void> blocked;
+    std::promise<void> unblock;
+    auto unblockFuture = unblock.get_future().share();
+    threadPool.Submit([&blocked, unblockFuture]() {
+      blocked.set_value();
+      unblockFuture.wait();
+    });
+    blocked.get_future().wait();
+
+    // The calling thread transfers every chunk itself, the queued tasks aren't waited for.
+    std::atomic<int64_t> bytesTransferred{0};
+    Details::ConcurrentTransfer(
+        0, 100000, 1000, 8, [&](int64_t, int64_t chunkLength, int64_t, int64_t) {
+          bytesTransferred += chunkLength;
+        });
+    EXPECT_EQ(bytesTransferred.load(), 100000);
+
+    unblock.set_value();
+    threadPool.SetMaxThreads(maxThreads);
+  }
+
+  TEST(ConcurrentTransferTest, SplitSlowChunks)
+  {
+    constexpr int64_t offset = 4096;
+    constexpr int64_t length = 4 * 256 * 1024;
+    constexpr int64_t chunkSize = 256 * 1024;
+    constexpr int64_t partSize = 4096;
+    std::mutex mutex;
+    std::vector<int> timesTransferred(static_cast<std::size_t>(length / partSize));
+    int64_t firstChunkLength = 0;
+    int numSplitOffRanges = 0;
+    Details::ConcurrentTransfer(
+        offset,
+        length,
+        chunkSize,
+        4,
+        [&](Details::ChunkRange& range) {
+          EXPECT_EQ(range.Offset() % partSize, 0);
+          int64_t partOffset = range.Offset();
+          while (int64_t partLength = range.Claim(partSize))
+          {
+            if (range.ChunkId() == 0 && !range.IsSplitOff())
+            {
+              // A straggler.
+              std::this_thread::sleep_for(std::chrono::milliseconds(2));
+            }
+            std::lock_guard<std::mutex> guard(mutex);
+            EXPECT_EQ(partLength, partSize);
+            ++timesTransferred[static_cast<std::size_t>((partOffset - offset) / partSize)];
+            partOffset += partLength;
+          }
+          std::lock_guard<std::mutex> guard(mutex);
+          if (range.IsSplitOff())
+          {
+            EXPECT_LE(range.ChunkId(), 3);
+            ++numSplitOffRanges;
+          }
+          else if (range.ChunkId() == 0)
+          {
+            firstChunkLength = range.ClaimedLength();
+          }
+        },
+        8 * 1024);
+    for (int count : timesTransferred)
+    {
+      ASSERT_EQ(count, 1);
+    }
+    EXPECT_GT(numSplitOffRanges, 0);
+    EXPECT_LT(firstChunkLength, chunkSize);
+
+    // Nothing is split off without a minimum split length.
+    numSplitOffRanges = 0;
+    Details::ConcurrentTransfer(
+        offset,
+        length,
+        chunkSize,
+        4,
+        [&](Details::ChunkRange& range) {
+          while (range.Claim(partSize))
+          {
+            if (range.ChunkId() == 0)
+            {
+              std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
+          }
+          std::lock_guard<std::mutex> guard(mutex);
+          numSplitOffRanges += range.IsSplitOff() ? 1 : 0;
+        },
+        0);
+    EXPECT_EQ(numSplitOffRanges, 0);
+  }
+
+  TEST(ConcurrentTransferTest, ThreadPoolRunsAllTasks)
+  {
+    std::atomic<int> counter{0};
+    std::promise<void> done;
+    Details::ThreadPool threadPool(4);
+    constexpr int numTasks = 10000;
+    for (int i = 0; i < numTasks; ++i)
+    {
+      threadPool.Submit([&]() {
+        if (++counter == numTasks)
+        {
+          done.set_value();
+        }
+      });
+    }
+    done.get_future().wait();
+    threadPool.SetMaxThreads(1);
+    EXPECT_EQ(counter.load(), numTasks);
+  }
+
+}}} // namespace Azure::Storage::Test
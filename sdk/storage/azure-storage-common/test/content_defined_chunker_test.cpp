@@ -0,0 +1,74 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/content_defined_chunker.hpp"
+#include "test_base.hpp"
+
+#include <set>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    std::vector<std::string> Chunk(const std::vector<uint8_t>& data, int64_t pieceSize)
+    {
+      Details::ContentDefinedChunker chunker(1024, 4096, 16384);
+      std::vector<std::string> chunks;
+      std::string chunk;
+      for (std::size_t offset = 0; offset < data.size();)
+      {
+        const int64_t length
+            = std::min(pieceSize, static_cast<int64_t>(data.size() - offset));
+        int64_t boundary = chunker.FindBoundary(data.data() + offset, length);
+        const int64_t chunkLength = boundary < 0 ? length : boundary;
+        chunk.append(data.begin() + offset, data.begin() + offset + chunkLength);
+        offset += static_cast<std::size_t>(chunkLength);
+        if (boundary >= 0)
+        {
+          chunks.push_back(std::move(chunk));
+          chunk.clear();
+        }
+      }
+      if (!chunk.empty())
+      {
+        chunks.push_back(std::move(chunk));
+      }
+      return chunks;
+    }
+  } // namespace
+
+  TEST(ContentDefinedChunkerTest, Boundaries)
+  {
+    auto data = RandomBuffer(1024 * 1024);
+    auto chunks = Chunk(data, 1024 * 1024);
+    EXPECT_GT(chunks.size(), 1024 * 1024 / 16384);
+    EXPECT_LT(chunks.size(), 1024 * 1024 / 1024);
+    for (std::size_t i = 0; i + 1 < chunks.size(); ++i)
+    {
+      EXPECT_GE(chunks[i].size(), 1024U);
+      EXPECT_LE(chunks[i].size(), 16384U);
+    }
+    // The boundaries don't depend on how the data is passed in.
+    EXPECT_EQ(Chunk(data, 1000), chunks);
+    EXPECT_EQ(Chunk(data, 1), chunks);
+
+    // Only the chunks around an edit change.
+    data.insert(data.begin() + 500000, 10, 'x');
+    data.erase(data.begin() + 800000, data.begin() + 800100);
+    auto editedChunks = Chunk(data, 4096);
+    std::set<std::string> chunkSet(chunks.begin(), chunks.end());
+    std::size_t numShared = 0;
+    for (const auto& chunk : editedChunks)
+    {
+      numShared += chunkSet.count(chunk);
+    }
+    EXPECT_GE(numShared + 6, chunks.size());
+
+    // Content without any boundary is cut at the maximum size.
+    std::vector<uint8_t> zeros(100000);
+    for (const auto& chunk : Chunk(zeros, 100000))
+    {
+      EXPECT_TRUE(chunk.size() == 16384U || chunk.size() == 100000U % 16384U);
+    }
+  }
+
+}}} // namespace Azure::Storage::Test
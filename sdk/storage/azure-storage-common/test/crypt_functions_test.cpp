@@ -4,6 +4,10 @@
 #include "azure/storage/common/crypt.hpp"
 #include "test_base.hpp"
 
+#include <algorithm>
+#include <chrono>
+#include <stdexcept>
+
 namespace Azure { namespace Storage { namespace Test {
 
   TEST(CryptFunctionsTest, Base64)
@@ -17,6 +21,113 @@ namespace Azure { namespace Storage { namespace Test {
     }
   }
 
+  TEST(CryptFunctionsTest, Base64Rfc4648Vectors)
+  {
+    const std::vector<std::pair<std::string, std::string>> vectors = {
+        {"", ""},
+        {"f", "Zg=="},
+        {"fo", "Zm8="},
+        {"foo", "Zm9v"},
+        {"foob", "Zm9vYg=="},
+        {"fooba", "Zm9vYmE="},
+        {"foobar", "Zm9vYmFy"},
+    };
+    for (const auto& v : vectors)
+    {
+      EXPECT_EQ(Base64Encode(v.first), v.second);
+      EXPECT_EQ(Base64Decode(v.second), v.first);
+    }
+    // Padding may be omitted.
+    EXPECT_EQ(Base64Decode("Zm9vYg"), "foob");
+    EXPECT_EQ(Base64Decode("Zm9vYmE"), "fooba");
+  }
+
+  TEST(CryptFunctionsTest, Base64MatchesReference)
+  {
+    const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+    auto referenceEncode = [alphabet](const std::string& data) {
+      std::string encoded;
+      for (std::size_t i = 0; i < data.length(); i += 3)
+      {
+        uint32_t v = 0;
+        std::size_t n = std::min<std::size_t>(3, data.length() - i);
+        for (std::size_t j = 0; j < 3; ++j)
+        {
+          v = (v << 8) | (j < n ? static_cast<uint8_t>(data[i + j]) : 0);
+        }
+        for (std::size_t j = 0; j < 4; ++j)
+        {
+          encoded += j <= n ? alphabet[(v >> (18 - 6 * j)) & 0x3f] : '=';
+        }
+      }
+      return encoded;
+    };
+
+    for (std::size_t length = 0; length < 300; ++length)
+    {
+      std::string data(length, '\0');
+      RandomBuffer(&data[0], data.length());
+      const std::string encoded = Base64Encode(data);
+      ASSERT_EQ(encoded, referenceEncode(data));
+      ASSERT_EQ(encoded.length(), Base64EncodedLength(length));
+      ASSERT_EQ(Base64Decode(encoded), data);
+
+      std::string appended = "prefix";
+      Base64EncodeTo(reinterpret_cast<const uint8_t*>(data.data()), data.length(), appended);
+      ASSERT_EQ(appended, "prefix" + encoded);
+    }
+  }
+
+  TEST(CryptFunctionsTest, Base64DecodeInvalid)
+  {
+    EXPECT_THROW(Base64Decode("Zm9v!mFy"), std::runtime_error);
+    EXPECT_THROW(Base64Decode("Z"), std::runtime_error);
+    EXPECT_THROW(Base64Decode("Zm=v"), std::runtime_error);
+    EXPECT_THROW(Base64Decode("===="), std::runtime_error);
+
+    // Invalid characters in the part decoded with SIMD instructions.
+    std::string longText = Base64Encode(std::string(300, 'a'));
+    longText[17] = '-';
+    EXPECT_THROW(Base64Decode(longText), std::runtime_error);
+    longText[17] = '\x80';
+    EXPECT_THROW(Base64Decode(longText), std::runtime_error);
+  }
+
+  TEST(CryptFunctionsTest, DISABLED_Base64Throughput)
+  {
+    constexpr std::size_t numStrings = 100000;
+    // The size of a 64-character block ID.
+    const std::string data(64, '0');
+    auto timer_start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < numStrings; ++i)
+    {
+      EXPECT_EQ(Base64Decode(Base64Encode(data)).length(), data.length());
+    }
+    auto timer_end = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_end - timer_start);
+    std::cout << "Base64 block ID round trip: " << elapsed.count() / numStrings << "ns"
+              << std::endl;
+
+    constexpr std::size_t bufferSize = static_cast<std::size_t>(64_MB);
+    std::string buffer(bufferSize, '\0');
+    RandomBuffer(&buffer[0], buffer.length());
+    timer_start = std::chrono::steady_clock::now();
+    std::string encoded = Base64Encode(buffer);
+    timer_end = std::chrono::steady_clock::now();
+    double speed = static_cast<double>(bufferSize) / 1_MB
+        / std::chrono::duration_cast<std::chrono::milliseconds>(timer_end - timer_start).count()
+        * 1000;
+    std::cout << "Base64 encode speed: " << speed << "MiB/s" << std::endl;
+
+    timer_start = std::chrono::steady_clock::now();
+    EXPECT_EQ(Base64Decode(encoded), buffer);
+    timer_end = std::chrono::steady_clock::now();
+    speed = static_cast<double>(bufferSize) / 1_MB
+        / std::chrono::duration_cast<std::chrono::milliseconds>(timer_end - timer_start).count()
+        * 1000;
+    std::cout << "Base64 decode speed: " << speed << "MiB/s" << std::endl;
+  }
+
   TEST(CryptFunctionsTest, Sha256)
   {
     EXPECT_EQ(Base64Encode(Details::Sha256("")), "47DEQpj8HBSa+/TImW+5JCeuQeRkm5NMpJWZG3hSuFU=");
@@ -35,6 +146,22 @@ namespace Azure { namespace Storage { namespace Test {
         "+SBESxQVhI53mSEdZJcCBpdBkaqwzfPaVYZMAf5LP3c=");
   }
 
+  TEST(CryptFunctionsTest, HmacSha256Context)
+  {
+    for (std::size_t keyLength : {0, 1, 32, 63, 64, 65, 200})
+    {
+      std::string key(keyLength, '\0');
+      RandomBuffer(&key[0], key.length());
+      Details::HmacSha256Context context(key);
+      for (std::size_t textLength : {0, 1, 55, 64, 1000})
+      {
+        std::string text(textLength, '\0');
+        RandomBuffer(&text[0], text.length());
+        EXPECT_EQ(context.Sign(text), Details::HmacSha256(text, key));
+      }
+    }
+  }
+
   TEST(CryptFunctionsTest, Md5)
   {
     EXPECT_EQ(Base64Encode(Md5::Hash("")), "1B2M2Y8AsgTpgAmY7PhCfg==");
@@ -124,4 +251,112 @@ namespace Azure { namespace Storage { namespace Test {
         Crc64::Hash(reinterpret_cast<const uint8_t*>(allData.data()), allData.size()));
   }
 
+  TEST(CryptFunctionsTest, Crc64MatchesBitwiseReference)
+  {
+    auto referenceCrc64 = [](const uint8_t* data, std::size_t length) {
+      uint64_t crc = ~0ULL;
+      for (std::size_t i = 0; i < length; ++i)
+      {
+        crc ^= data[i];
+        for (int j = 0; j < 8; ++j)
+        {
+          crc = (crc >> 1) ^ (0x9A6C9329AC4BC9B5ULL & (0 - (crc & 1)));
+        }
+      }
+      crc ^= ~0ULL;
+      std::string digest(sizeof(crc), '\0');
+      for (std::size_t i = 0; i < sizeof(crc); ++i)
+      {
+        digest[i] = static_cast<char>((crc >> (8 * i)) & 0xff);
+      }
+      return digest;
+    };
+
+    auto data = RandomBuffer(static_cast<std::size_t>(64_KB));
+    // Cover every unaligned start and all the tail lengths around the 16 and 128 byte strides.
+    for (std::size_t offset = 0; offset < 16; ++offset)
+    {
+      for (std::size_t length = 0; length < 600; ++length)
+      {
+        ASSERT_EQ(
+            Crc64::Hash(data.data() + offset, length),
+            referenceCrc64(data.data() + offset, length));
+      }
+    }
+    EXPECT_EQ(Crc64::Hash(data.data(), data.size()), referenceCrc64(data.data(), data.size()));
+  }
+
+  TEST(CryptFunctionsTest, DISABLED_Crc64Throughput)
+  {
+    constexpr std::size_t bufferSize = static_cast<std::size_t>(256_MB);
+    std::vector<uint8_t> buffer = RandomBuffer(bufferSize);
+
+    auto timer_start = std::chrono::steady_clock::now();
+    auto digest = Crc64::Hash(buffer.data(), buffer.size());
+    auto timer_end = std::chrono::steady_clock::now();
+    EXPECT_FALSE(digest.empty());
+
+    double speed = static_cast<double>(bufferSize) / 1_MB
+        / std::chrono::duration_cast<std::chrono::milliseconds>(timer_end - timer_start).count()
+        * 1000;
+    std::cout << "CRC64 speed: " << speed << "MiB/s" << std::endl;
+  }
+
+  TEST(CryptFunctionsTest, Md5HashBatch)
+  {
+    std::vector<std::vector<uint8_t>> data;
+    for (std::size_t length = 0; length < 200; ++length)
+    {
+      data.push_back(RandomBuffer(length));
+    }
+    data.push_back(RandomBuffer(static_cast<std::size_t>(1_MB)));
+    data.push_back(RandomBuffer(static_cast<std::size_t>(4_MB) + 55));
+
+    std::vector<std::pair<const uint8_t*, std::size_t>> buffers;
+    for (const auto& d : data)
+    {
+      buffers.emplace_back(d.data(), d.size());
+    }
+    auto hashes = Md5::HashBatch(buffers);
+    ASSERT_EQ(hashes.size(), data.size());
+    for (std::size_t i = 0; i < data.size(); ++i)
+    {
+      EXPECT_EQ(hashes[i], Md5::Hash(data[i].data(), data[i].size()));
+    }
+
+    EXPECT_TRUE(Md5::HashBatch({}).empty());
+    EXPECT_EQ(Base64Encode(Md5::HashBatch({{nullptr, 0}})[0]), "1B2M2Y8AsgTpgAmY7PhCfg==");
+  }
+
+  TEST(CryptFunctionsTest, DISABLED_Md5BatchThroughput)
+  {
+    constexpr std::size_t numBuffers = 32;
+    constexpr std::size_t bufferSize = static_cast<std::size_t>(8_MB);
+    std::vector<uint8_t> buffer = RandomBuffer(numBuffers * bufferSize);
+    std::vector<std::pair<const uint8_t*, std::size_t>> buffers;
+    for (std::size_t i = 0; i < numBuffers; ++i)
+    {
+      buffers.emplace_back(buffer.data() + i * bufferSize, bufferSize);
+    }
+
+    auto timer_start = std::chrono::steady_clock::now();
+    for (const auto& b : buffers)
+    {
+      EXPECT_FALSE(Md5::Hash(b.first, b.second).empty());
+    }
+    auto timer_end = std::chrono::steady_clock::now();
+    double speed = static_cast<double>(buffer.size()) / 1_MB
+        / std::chrono::duration_cast<std::chrono::milliseconds>(timer_end - timer_start).count()
+        * 1000;
+    std::cout << "MD5 speed: " << speed << "MiB/s" << std::endl;
+
+    timer_start = std::chrono::steady_clock::now();
+    EXPECT_EQ(Md5::HashBatch(buffers).size(), numBuffers);
+    timer_end = std::chrono::steady_clock::now();
+    speed = static_cast<double>(buffer.size()) / 1_MB
+        / std::chrono::duration_cast<std::chrono::milliseconds>(timer_end - timer_start).count()
+        * 1000;
+    std::cout << "MD5 batch speed: " << speed << "MiB/s" << std::endl;
+  }
+
 }}} // namespace Azure::Storage::Test
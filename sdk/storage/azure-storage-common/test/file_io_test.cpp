@@ -0,0 +1,158 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/file_io.hpp"
+#include "test_base.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <thread>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(FileIoTest, WriteAsync)
+  {
+    const std::string filename = RandomString();
+    constexpr std::size_t bufferSize = 1000;
+    constexpr std::size_t numBuffers = 16;
+    {
+      Details::FileWriter writer(filename);
+      writer.Preallocate(bufferSize * numBuffers);
+      // Out of order, and more buffers than can be queued at once.
+      for (std::size_t i = numBuffers; i > 0; --i)
+      {
+        auto buffer = writer.AcquireBuffer(bufferSize);
+        EXPECT_EQ(buffer.Size(), bufferSize);
+        std::fill(buffer.Data(), buffer.Data() + buffer.Size(), static_cast<uint8_t>(i - 1));
+        writer.WriteAsync(std::move(buffer), static_cast<int64_t>((i - 1) * bufferSize));
+      }
+      writer.Flush();
+    }
+
+    std::ifstream file(filename, std::ios::binary);
+    std::vector<char> content(
+        (std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+    std::remove(filename.data());
+    ASSERT_EQ(content.size(), bufferSize * numBuffers);
+    for (std::size_t i = 0; i < content.size(); ++i)
+    {
+      ASSERT_EQ(static_cast<std::size_t>(content[i]), i / bufferSize);
+    }
+  }
+
+  TEST(FileIoTest, MemoryMappedFile)
+  {
+    const std::string filename = RandomString();
+    constexpr int64_t fileSize = 3 * 4096 + 100;
+    {
+      Details::FileWriter writer(filename);
+      Details::MemoryMappedFile mappedFile(writer, fileSize);
+      ASSERT_EQ(mappedFile.Size(), fileSize);
+      for (int64_t i = 0; i < fileSize; ++i)
+      {
+        mappedFile.Data()[i] = static_cast<uint8_t>(i % 251);
+      }
+    }
+    {
+      Details::FileReader reader(filename);
+      ASSERT_EQ(reader.GetFileSize(), fileSize);
+      Details::MemoryMappedFile mappedFile(reader);
+      ASSERT_EQ(mappedFile.Size(), fileSize);
+      for (int64_t i = 0; i < fileSize; ++i)
+      {
+        ASSERT_EQ(mappedFile.Data()[i], static_cast<uint8_t>(i % 251));
+      }
+    }
+    std::remove(filename.data());
+
+    // Empty files can't be mapped.
+    {
+      Details::FileWriter writer(filename);
+      EXPECT_THROW(Details::MemoryMappedFile(writer, 0), std::runtime_error);
+    }
+    {
+      Details::FileReader reader(filename);
+      EXPECT_THROW(Details::MemoryMappedFile mappedFile(reader), std::runtime_error);
+    }
+    std::remove(filename.data());
+  }
+
+  TEST(FileIoTest, SeekData)
+  {
+    const std::string filename = RandomString();
+    constexpr int64_t c_mb = 1024 * 1024;
+    {
+      Details::FileWriter writer(filename);
+      writer.SetSparse();
+      writer.Truncate(16 * c_mb);
+      std::vector<uint8_t> data(4096, 'a');
+      writer.Write(data.data(), 4096, 0);
+      writer.Write(data.data(), 4096, 8 * c_mb);
+    }
+    {
+      Details::FileReader reader(filename);
+      EXPECT_EQ(reader.SeekData(0), 0);
+      EXPECT_EQ(reader.SeekData(100), 100);
+      // Depends on whether the file system supports sparse files.
+      int64_t dataOffset = reader.SeekData(c_mb);
+      EXPECT_TRUE(dataOffset == c_mb || dataOffset == 8 * c_mb);
+      dataOffset = reader.SeekData(12 * c_mb);
+      EXPECT_TRUE(dataOffset == 12 * c_mb || dataOffset == 16 * c_mb);
+      EXPECT_EQ(reader.SeekData(16 * c_mb), 16 * c_mb);
+    }
+    std::remove(filename.data());
+  }
+
+  TEST(FileIoTest, ZeroRange)
+  {
+    const std::string filename = RandomString();
+    const auto data = RandomBuffer(3 * 1024 * 1024);
+    {
+      Details::FileWriter writer(filename);
+      writer.Write(data.data(), static_cast<int64_t>(data.size()), 0);
+      // Neither aligned to file system blocks nor to the fallback's buffer size.
+      writer.ZeroRange(1000, 2 * 1024 * 1024 + 500);
+    }
+    auto expected = data;
+    std::fill(expected.begin() + 1000, expected.begin() + 2 * 1024 * 1024 + 1500, uint8_t(0));
+    EXPECT_EQ(ReadFile(filename), expected);
+    std::remove(filename.data());
+  }
+
+  TEST(FileIoTest, FileSizeAndWriteTime)
+  {
+    const std::string filename = RandomString();
+    const auto data = RandomBuffer(1000);
+    int64_t lastWriteTime = 0;
+    {
+      Details::FileWriter writer(filename);
+      EXPECT_EQ(writer.GetFileSize(), 0);
+      writer.Write(data.data(), static_cast<int64_t>(data.size()), 0);
+      EXPECT_EQ(writer.GetFileSize(), 1000);
+      lastWriteTime = Details::FileReader(filename).GetLastWriteTime();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    {
+      Details::FileWriter writer(filename, false);
+      EXPECT_EQ(writer.GetFileSize(), 1000);
+      EXPECT_EQ(Details::FileReader(filename).GetLastWriteTime(), lastWriteTime);
+      writer.Write(data.data(), 1, 0);
+    }
+    EXPECT_NE(Details::FileReader(filename).GetLastWriteTime(), lastWriteTime);
+    std::remove(filename.data());
+  }
+
+#if defined(__linux__)
+  TEST(FileIoTest, WriteAsyncError)
+  {
+    Details::FileWriter writer("/dev/full");
+    writer.WriteAsync(writer.AcquireBuffer(100), 0);
+    EXPECT_THROW(writer.Flush(), std::runtime_error);
+    EXPECT_THROW(writer.WriteAsync(writer.AcquireBuffer(100), 100), std::runtime_error);
+  }
+#endif
+
+}}} // namespace Azure::Storage::Test
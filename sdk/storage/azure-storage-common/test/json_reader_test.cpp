@@ -0,0 +1,208 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/json.hpp"
+#include "azure/storage/common/json_reader.hpp"
+#include "test_base.hpp"
+
+#include <chrono>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    std::string ReadAll(const std::string& json)
+    {
+      Details::JsonReader reader(json.data(), json.length());
+      std::string tokens;
+      for (auto token = reader.Read(); token.Type != Details::JsonTokenType::End;
+           token = reader.Read())
+      {
+        switch (token.Type)
+        {
+          case Details::JsonTokenType::StartObject:
+            tokens += "{";
+            break;
+          case Details::JsonTokenType::EndObject:
+            tokens += "}";
+            break;
+          case Details::JsonTokenType::StartArray:
+            tokens += "[";
+            break;
+          case Details::JsonTokenType::EndArray:
+            tokens += "]";
+            break;
+          case Details::JsonTokenType::PropertyName:
+            tokens += "<" + token.ToString() + ">";
+            break;
+          case Details::JsonTokenType::String:
+            tokens += "'" + token.ToString() + "'";
+            break;
+          case Details::JsonTokenType::Number:
+            tokens += "#" + token.ToString();
+            break;
+          case Details::JsonTokenType::True:
+            tokens += "T";
+            break;
+          case Details::JsonTokenType::False:
+            tokens += "F";
+            break;
+          case Details::JsonTokenType::Null:
+            tokens += "N";
+            break;
+          default:
+            break;
+        }
+        tokens += " ";
+      }
+      return tokens;
+    }
+
+    std::string MakePathList(int numPaths)
+    {
+      std::string json = "{\"paths\":[";
+      for (int i = 0; i < numPaths; ++i)
+      {
+        if (i != 0)
+        {
+          json += ",";
+        }
+        json += "{\"contentLength\":\"" + std::to_string(i * 1024)
+            + "\",\"creationTime\":\"132471916476640000\",\"etag\":\"0x8D8A1B2C3D4E5F"
+            + std::to_string(i) + "\",\"group\":\"$superuser\",\"isDirectory\":\""
+            + (i % 10 == 0 ? "true" : "false") + "\",\"lastModified\":\"Thu, 03 Dec 2020 08:14:07 GMT\",\"name\":\"dir/subdir/file-"
+            + std::to_string(i) + ".dat\",\"owner\":\"$superuser\",\"permissions\":\"rw-r-----\"}";
+      }
+      json += "]}";
+      return json;
+    }
+  } // namespace
+
+  TEST(JsonReaderTest, Read)
+  {
+    EXPECT_EQ(
+        ReadAll(" { \"a\" : [1, -2.5e+3, 0.25, true, false, null, \"x\", {}, []],"
+                " \"b\":{\"c\":\"\"} }\r\n"),
+        "{ <a> [ #1 #-2.5e+3 #0.25 T F N 'x' { } [ ] ] <b> { <c> '' } } ");
+    EXPECT_EQ(ReadAll("42"), "#42 ");
+    EXPECT_EQ(ReadAll("\"top\""), "'top' ");
+
+    // Escaped names and values are decoded.
+    EXPECT_EQ(
+        ReadAll("{\"a\\\"b\":\"\\\\\\/\\b\\f\\n\\r\\t\\u0041\\u00e9\\u20ac\\ud83d\\ude00\"}"),
+        "{ <a\"b> '\\/\b\f\n\r\t\x41\xc3\xa9\xe2\x82\xac\xf0\x9f\x98\x80' } ");
+  }
+
+  TEST(JsonReaderTest, TypedValues)
+  {
+    const std::string json = "{\"a\":\"123\",\"b\":-9223372036854775808,\"c\":\"true\",\"d\":false,"
+                             "\"e\":{\"f\":[1,{\"g\":null}]},\"h\":\"text\"}";
+    Details::JsonReader reader(json.data(), json.length());
+    reader.Read(Details::JsonTokenType::StartObject);
+    EXPECT_TRUE(reader.Read(Details::JsonTokenType::PropertyName).Equals("a"));
+    EXPECT_EQ(reader.ReadInt64(), 123);
+    reader.Read();
+    EXPECT_EQ(reader.ReadInt64(), INT64_MIN);
+    reader.Read();
+    EXPECT_TRUE(reader.ReadBoolean());
+    reader.Read();
+    EXPECT_FALSE(reader.ReadBoolean());
+    reader.Read();
+    EXPECT_EQ(reader.PeekType(), Details::JsonTokenType::StartObject);
+    reader.SkipValue();
+    EXPECT_EQ(reader.PeekType(), Details::JsonTokenType::PropertyName);
+    EXPECT_TRUE(reader.Read().Equals("h"));
+    EXPECT_THROW(reader.ReadInt64(), std::runtime_error);
+
+    for (const std::string value : {"\"12a\"", "\"\"", "\"-\"", "1.5", "9223372036854775808"})
+    {
+      Details::JsonReader valueReader(value.data(), value.length());
+      EXPECT_THROW(valueReader.ReadInt64(), std::runtime_error) << value;
+    }
+  }
+
+  TEST(JsonReaderTest, Malformed)
+  {
+    for (const std::string json :
+         {"",
+          "{",
+          "{\"a\"}",
+          "{\"a\":1,}",
+          "[1,]",
+          "[1 2]",
+          "{1:2}",
+          "{\"a\":1]",
+          "[\"abc]",
+          "[\"\\x\"]",
+          "[\"\\u12\"]",
+          "[\"\\ud83d\"]",
+          "[\"\\ude00\"]",
+          "[\"a\nb\"]",
+          "[tru]",
+          "[-]",
+          "[1.]",
+          "[1e]",
+          "{} {}",
+          "[]]"})
+    {
+      EXPECT_THROW(ReadAll(json), std::runtime_error) << json;
+    }
+  }
+
+  TEST(JsonReaderTest, DISABLED_ListPathsThroughput)
+  {
+    const std::string json = MakePathList(5000);
+    constexpr int numIterations = 20;
+
+    auto timer_start = std::chrono::steady_clock::now();
+    std::size_t numPaths = 0;
+    for (int i = 0; i < numIterations; ++i)
+    {
+      auto document = nlohmann::json::parse(json);
+      for (const auto& path : document["paths"])
+      {
+        numPaths += path["name"].get<std::string>().empty() ? 0 : 1;
+        numPaths += std::stoll(path["contentLength"].get<std::string>()) < 0 ? 1 : 0;
+      }
+    }
+    auto timer_end = std::chrono::steady_clock::now();
+    EXPECT_EQ(numPaths, static_cast<std::size_t>(5000 * numIterations));
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(timer_end - timer_start);
+    std::cout << "nlohmann::json parsed 5000 paths in: " << elapsed.count() / numIterations << "us"
+              << std::endl;
+
+    timer_start = std::chrono::steady_clock::now();
+    numPaths = 0;
+    for (int i = 0; i < numIterations; ++i)
+    {
+      Details::JsonReader reader(json.data(), json.length());
+      reader.Read(Details::JsonTokenType::StartObject);
+      reader.Read(Details::JsonTokenType::PropertyName);
+      reader.Read(Details::JsonTokenType::StartArray);
+      while (reader.Read().Type == Details::JsonTokenType::StartObject)
+      {
+        for (auto token = reader.Read(); token.Type != Details::JsonTokenType::EndObject;
+             token = reader.Read())
+        {
+          if (token.Equals("name"))
+          {
+            numPaths += reader.ReadString().empty() ? 0 : 1;
+          }
+          else if (token.Equals("contentLength"))
+          {
+            numPaths += reader.ReadInt64() < 0 ? 1 : 0;
+          }
+          else
+          {
+            reader.SkipValue();
+          }
+        }
+      }
+    }
+    timer_end = std::chrono::steady_clock::now();
+    EXPECT_EQ(numPaths, static_cast<std::size_t>(5000 * numIterations));
+    elapsed = std::chrono::duration_cast<std::chrono::microseconds>(timer_end - timer_start);
+    std::cout << "JsonReader parsed 5000 paths in: " << elapsed.count() / numIterations << "us"
+              << std::endl;
+  }
+
+}}} // namespace Azure::Storage::Test
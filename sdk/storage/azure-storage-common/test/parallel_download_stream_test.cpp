@@ -0,0 +1,110 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/parallel_download_stream.hpp"
+#include "test_base.hpp"
+
+#include <atomic>
+#include <thread>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(ParallelDownloadStreamTest, ReadInOrder)
+  {
+    const auto data = RandomBuffer(100000);
+    std::atomic<int> numRunning{0};
+    std::atomic<int> maxRunning{0};
+    std::atomic<int> numGets{0};
+    auto getter = [&](Azure::Core::Context const&, int64_t offset, int64_t length) {
+      ++numGets;
+      int running = ++numRunning;
+      int max = maxRunning;
+      while (running > max && !maxRunning.compare_exchange_weak(max, running))
+      {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(5));
+      --numRunning;
+      return std::make_unique<Azure::Core::Http::MemoryBodyStream>(
+          data.data() + offset, static_cast<std::size_t>(length));
+    };
+
+    ParallelDownloadStreamOptions options;
+    options.ChunkSize = 3000;
+    options.Concurrency = 4;
+    // The first 1000 bytes come from an already opened stream, the range starts at offset 10.
+    ParallelDownloadStream stream(
+        std::make_unique<Azure::Core::Http::MemoryBodyStream>(data.data() + 10, 1000),
+        10,
+        90000,
+        getter,
+        Azure::Core::Context(),
+        options);
+    EXPECT_EQ(stream.Length(), 90000);
+
+    std::vector<uint8_t> content(90000);
+    // Reads that aren't aligned to chunks.
+    int64_t position = 0;
+    while (position < 90000)
+    {
+      int64_t readBytes = stream.Read(
+          Azure::Core::Context(),
+          content.data() + position,
+          std::min<int64_t>(1234, 90000 - position));
+      ASSERT_GT(readBytes, 0);
+      position += readBytes;
+    }
+    EXPECT_EQ(stream.Read(Azure::Core::Context(), content.data(), 1), 0);
+    EXPECT_EQ(content, std::vector<uint8_t>(data.begin() + 10, data.begin() + 90010));
+    EXPECT_EQ(numGets, 30);
+    EXPECT_LE(maxRunning, 4);
+
+    stream.Rewind();
+    EXPECT_EQ(
+        Azure::Core::Http::BodyStream::ReadToCount(
+            Azure::Core::Context(), stream, content.data(), 90000),
+        90000);
+    EXPECT_EQ(content, std::vector<uint8_t>(data.begin() + 10, data.begin() + 90010));
+  }
+
+  TEST(ParallelDownloadStreamTest, Errors)
+  {
+    const auto data = RandomBuffer(10000);
+    auto getter = [&](Azure::Core::Context const&, int64_t offset, int64_t length)
+        -> std::unique_ptr<Azure::Core::Http::BodyStream> {
+      if (offset >= 5000)
+      {
+        throw std::runtime_error("failed range");
+      }
+      return std::make_unique<Azure::Core::Http::MemoryBodyStream>(
+          data.data() + offset, static_cast<std::size_t>(length));
+    };
+
+    ParallelDownloadStreamOptions options;
+    options.ChunkSize = 1000;
+    ParallelDownloadStream stream(nullptr, 0, 10000, getter, Azure::Core::Context(), options);
+    std::vector<uint8_t> content(10000);
+    EXPECT_EQ(
+        Azure::Core::Http::BodyStream::ReadToCount(
+            Azure::Core::Context(), stream, content.data(), 5000),
+        5000);
+    EXPECT_THROW(stream.Read(Azure::Core::Context(), content.data(), 1000), std::runtime_error);
+
+    // A reader waiting for a chunk gives up when its context is canceled.
+    auto slowGetter = [&](Azure::Core::Context const& context, int64_t offset, int64_t length) {
+      while (true)
+      {
+        context.ThrowIfCanceled();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+      }
+      return std::make_unique<Azure::Core::Http::MemoryBodyStream>(
+          data.data() + offset, static_cast<std::size_t>(length));
+    };
+    ParallelDownloadStream slowStream(
+        nullptr, 0, 10000, slowGetter, Azure::Core::Context(), options);
+    Azure::Core::Context context;
+    context.Cancel();
+    EXPECT_THROW(
+        slowStream.Read(context, content.data(), 1000), Azure::Core::OperationCanceledException);
+  }
+
+}}} // namespace Azure::Storage::Test
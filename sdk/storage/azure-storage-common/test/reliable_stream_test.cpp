@@ -0,0 +1,212 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/reliable_stream.hpp"
+#include "test_base.hpp"
+
+#include <cstring>
+#include <thread>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    // Serves data from an offset, at most bytesPerRead bytes per read and after a delay that can
+    // be interrupted by canceling the context.
+    class SlowBodyStream : public Azure::Core::Http::BodyStream {
+    public:
+      SlowBodyStream(
+          const std::vector<uint8_t>& data,
+          int64_t offset,
+          int64_t bytesPerRead,
+          std::chrono::milliseconds delay)
+          : m_data(data), m_offset(offset), m_bytesPerRead(bytesPerRead), m_delay(delay)
+      {
+      }
+
+      int64_t Length() const override { return static_cast<int64_t>(m_data.size()) - m_offset; }
+
+      void Rewind() override {}
+
+      int64_t Read(Azure::Core::Context const& context, uint8_t* buffer, int64_t count) override
+      {
+        const auto readyAt = std::chrono::steady_clock::now() + m_delay;
+        while (std::chrono::steady_clock::now() < readyAt)
+        {
+          context.ThrowIfCanceled();
+          std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        count = std::min(
+            {count, m_bytesPerRead, static_cast<int64_t>(m_data.size()) - m_offset});
+        std::memcpy(buffer, m_data.data() + m_offset, static_cast<std::size_t>(count));
+        m_offset += count;
+        return count;
+      }
+
+    private:
+      const std::vector<uint8_t>& m_data;
+      int64_t m_offset;
+      int64_t m_bytesPerRead;
+      std::chrono::milliseconds m_delay;
+    };
+  } // namespace
+
+  TEST(ReliableStreamTest, MinimumThroughput)
+  {
+    const auto data = RandomBuffer(1000);
+    int numGets = 0;
+    auto getter = [&](Azure::Core::Context const&, HttpGetterInfo const& info) {
+      ++numGets;
+      return std::make_unique<SlowBodyStream>(
+          data, info.Offset, 1000, std::chrono::milliseconds(0));
+    };
+    ReliableStreamOptions options;
+    options.MaxRetryRequests = 3;
+    options.MinimumThroughput = 10000;
+    options.ThroughputWindow = std::chrono::milliseconds(80);
+
+    // About 2KB/s.
+    ReliableStream stream(
+        std::make_unique<SlowBodyStream>(data, 0, 10, std::chrono::milliseconds(5)),
+        options,
+        getter);
+    EXPECT_EQ(stream.Length(), 1000);
+    std::vector<uint8_t> content(data.size());
+    EXPECT_EQ(
+        Azure::Core::Http::BodyStream::ReadToCount(
+            Azure::Core::Context(), stream, content.data(), 1000),
+        1000);
+    EXPECT_EQ(content, data);
+    EXPECT_EQ(numGets, 1);
+  }
+
+  TEST(ReliableStreamTest, StallReconnectionsAreLimited)
+  {
+    const auto data = RandomBuffer(300);
+    int numGets = 0;
+    auto getter = [&](Azure::Core::Context const&, HttpGetterInfo const& info) {
+      ++numGets;
+      return std::make_unique<SlowBodyStream>(
+          data, info.Offset, 10, std::chrono::milliseconds(5));
+    };
+    ReliableStreamOptions options;
+    options.MaxRetryRequests = 2;
+    options.MinimumThroughput = 10000;
+    options.ThroughputWindow = std::chrono::milliseconds(40);
+
+    ReliableStream stream(getter(Azure::Core::Context(), HttpGetterInfo()), options, getter);
+    std::vector<uint8_t> content(data.size());
+    EXPECT_EQ(
+        Azure::Core::Http::BodyStream::ReadToCount(
+            Azure::Core::Context(), stream, content.data(), 300),
+        300);
+    EXPECT_EQ(content, data);
+    // The initial stream and two reconnections.
+    EXPECT_EQ(numGets, 3);
+  }
+
+  TEST(ReliableStreamTest, SlowConsumerIsNotStalled)
+  {
+    const auto data = RandomBuffer(100);
+    int numGets = 0;
+    auto getter = [&](Azure::Core::Context const&, HttpGetterInfo const& info) {
+      ++numGets;
+      return std::make_unique<SlowBodyStream>(data, info.Offset, 10, std::chrono::milliseconds(0));
+    };
+    ReliableStreamOptions options;
+    options.MaxRetryRequests = 3;
+    options.MinimumThroughput = 10000;
+    options.ThroughputWindow = std::chrono::milliseconds(40);
+
+    // The connection delivers right away, the caller takes its time between reads.
+    ReliableStream stream(getter(Azure::Core::Context(), HttpGetterInfo()), options, getter);
+    std::vector<uint8_t> content(data.size());
+    for (int64_t offset = 0; offset < 100;)
+    {
+      offset += stream.Read(Azure::Core::Context(), content.data() + offset, 100 - offset);
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    }
+    EXPECT_EQ(content, data);
+    EXPECT_EQ(numGets, 1);
+  }
+
+  TEST(ReliableStreamTest, RewindAfterStallReconnection)
+  {
+    // Counts the connections that are open.
+    class CountedBodyStream : public SlowBodyStream {
+    public:
+      CountedBodyStream(int& numOpen, const std::vector<uint8_t>& data, int64_t offset)
+          : SlowBodyStream(data, offset, 10, std::chrono::milliseconds(5)), m_numOpen(numOpen)
+      {
+        ++m_numOpen;
+      }
+      ~CountedBodyStream() override { --m_numOpen; }
+
+    private:
+      int& m_numOpen;
+    };
+
+    const auto data = RandomBuffer(300);
+    int numOpen = 0;
+    auto getter = [&](Azure::Core::Context const&, HttpGetterInfo const& info) {
+      return std::make_unique<CountedBodyStream>(numOpen, data, info.Offset);
+    };
+    ReliableStreamOptions options;
+    options.MaxRetryRequests = 1;
+    options.MinimumThroughput = 10000;
+    options.ThroughputWindow = std::chrono::milliseconds(40);
+
+    // Reads until the stalled connection is dropped, which leaves no connection until the next
+    // read.
+    ReliableStream stream(getter(Azure::Core::Context(), HttpGetterInfo()), options, getter);
+    std::vector<uint8_t> content(data.size());
+    int64_t offset = 0;
+    while (numOpen == 1)
+    {
+      ASSERT_LT(offset, 300);
+      offset += stream.Read(Azure::Core::Context(), content.data() + offset, 10);
+    }
+
+    stream.Rewind();
+    std::fill(content.begin(), content.end(), uint8_t(0));
+    EXPECT_EQ(
+        Azure::Core::Http::BodyStream::ReadToCount(
+            Azure::Core::Context(), stream, content.data(), 300),
+        300);
+    EXPECT_EQ(content, data);
+  }
+
+  TEST(ReliableStreamTest, MaximumIdleGap)
+  {
+    const auto data = RandomBuffer(100);
+    int numGets = 0;
+    auto getter = [&](Azure::Core::Context const&, HttpGetterInfo const& info) {
+      ++numGets;
+      return std::make_unique<SlowBodyStream>(data, info.Offset, 100, std::chrono::milliseconds(0));
+    };
+    ReliableStreamOptions options;
+    options.MaxRetryRequests = 3;
+    options.MaximumIdleGap = std::chrono::milliseconds(50);
+
+    ReliableStream stream(
+        std::make_unique<SlowBodyStream>(data, 0, 100, std::chrono::seconds(60)), options, getter);
+    std::vector<uint8_t> content(data.size());
+    auto start = std::chrono::steady_clock::now();
+    EXPECT_EQ(
+        Azure::Core::Http::BodyStream::ReadToCount(
+            Azure::Core::Context(), stream, content.data(), 100),
+        100);
+    EXPECT_LT(std::chrono::steady_clock::now() - start, std::chrono::seconds(10));
+    EXPECT_EQ(content, data);
+    EXPECT_EQ(numGets, 1);
+
+    // Canceling the caller's context isn't retried.
+    Azure::Core::Context context;
+    context.Cancel();
+    ReliableStream canceledStream(
+        std::make_unique<SlowBodyStream>(data, 0, 100, std::chrono::seconds(60)), options, getter);
+    EXPECT_THROW(
+        canceledStream.Read(context, content.data(), 100), Azure::Core::OperationCanceledException);
+    EXPECT_EQ(numGets, 1);
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,116 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/core/http/pipeline.hpp"
+#include "azure/storage/common/crypt.hpp"
+#include "azure/storage/common/shared_key_policy.hpp"
+#include "test_base.hpp"
+
+#include <chrono>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    class CaptureAuthorizationPolicy : public Core::Http::HttpPolicy {
+    public:
+      explicit CaptureAuthorizationPolicy(std::string* authorization)
+          : m_authorization(authorization)
+      {
+      }
+
+      std::unique_ptr<HttpPolicy> Clone() const override
+      {
+        return std::make_unique<CaptureAuthorizationPolicy>(m_authorization);
+      }
+
+      std::unique_ptr<Core::Http::RawResponse> Send(
+          Core::Context const&,
+          Core::Http::Request& request,
+          Core::Http::NextHttpPolicy) const override
+      {
+        *m_authorization = request.GetHeaders().at("authorization");
+        return std::make_unique<Core::Http::RawResponse>(
+            1, 1, Core::Http::HttpStatusCode::Ok, "OK");
+      }
+
+    private:
+      std::string* m_authorization;
+    };
+
+    std::string SignRequest(
+        const std::shared_ptr<SharedKeyCredential>& credential,
+        Core::Http::Request& request)
+    {
+      std::string authorization;
+      std::vector<std::unique_ptr<Core::Http::HttpPolicy>> policies;
+      policies.emplace_back(std::make_unique<SharedKeyPolicy>(credential));
+      policies.emplace_back(std::make_unique<CaptureAuthorizationPolicy>(&authorization));
+      Core::Http::HttpPipeline pipeline(policies);
+      pipeline.Send(Core::Context(), request);
+      return authorization;
+    }
+
+    Core::Http::Request CreateRequest()
+    {
+      Core::Http::Request request(
+          Core::Http::HttpMethod::Put,
+          Core::Http::Url("https://account.blob.core.windows.net/container/blob%20name?"
+                          "comp=block&blockid=AAAA%3D&Timeout=30"));
+      request.AddHeader("Content-Length", "1024");
+      request.AddHeader("Content-MD5", "1B2M2Y8AsgTpgAmY7PhCfg==");
+      request.AddHeader("x-ms-version", "2020-02-10");
+      request.AddHeader("x-ms-date", "Mon, 19 Oct 2020 00:00:00 GMT");
+      request.AddHeader("X-MS-Meta-Key", "value");
+      return request;
+    }
+  } // namespace
+
+  TEST(SharedKeyPolicyTest, Signature)
+  {
+    const std::string accountKey = Base64Encode(std::string(64, 'k'));
+    auto credential = std::make_shared<SharedKeyCredential>("account", accountKey);
+
+    auto request = CreateRequest();
+    const std::string stringToSign = "PUT\n\n\n1024\n1B2M2Y8AsgTpgAmY7PhCfg==\n\n\n\n\n\n\n\n"
+                                     "x-ms-date:Mon, 19 Oct 2020 00:00:00 GMT\n"
+                                     "x-ms-meta-key:value\n"
+                                     "x-ms-version:2020-02-10\n"
+                                     "/account/container/blob%20name\n"
+                                     "blockid:AAAA=\n"
+                                     "comp:block\n"
+                                     "timeout:30";
+    EXPECT_EQ(
+        SignRequest(credential, request),
+        "SharedKey account:"
+            + Base64Encode(Details::HmacSha256(stringToSign, Base64Decode(accountKey))));
+
+    // The cached signing key is dropped when the account key is rotated.
+    const std::string newAccountKey = Base64Encode(std::string(64, 'n'));
+    credential->UpdateAccountKey(newAccountKey);
+    request = CreateRequest();
+    EXPECT_EQ(
+        SignRequest(credential, request),
+        "SharedKey account:"
+            + Base64Encode(Details::HmacSha256(stringToSign, Base64Decode(newAccountKey))));
+  }
+
+  TEST(SharedKeyPolicyTest, DISABLED_SigningThroughput)
+  {
+    auto credential = std::make_shared<SharedKeyCredential>(
+        "account", Base64Encode(std::string(64, 'k')));
+    auto request = CreateRequest();
+
+    constexpr int numRequests = 100000;
+    auto timer_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numRequests; ++i)
+    {
+      request.RemoveHeader("authorization");
+      SignRequest(credential, request);
+    }
+    auto timer_end = std::chrono::steady_clock::now();
+    auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(timer_end - timer_start);
+    auto cost = elapsed.count() / numRequests;
+    std::cout << "SharedKey signing cost: " << cost << "ns/request" << std::endl;
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/storage_common.hpp"
+#include "test_base.hpp"
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(StorageCommonTest, IsAllZeros)
+  {
+    std::vector<uint8_t> data(1000);
+    EXPECT_TRUE(Details::IsAllZeros(data.data(), 0));
+    for (std::size_t length : {1, 7, 64, 100, 1000})
+    {
+      EXPECT_TRUE(Details::IsAllZeros(data.data() + 1, length - 1));
+      for (std::size_t i : {std::size_t(0), length / 2, length - 1})
+      {
+        data[i] = 1;
+        EXPECT_FALSE(Details::IsAllZeros(data.data(), length));
+        data[i] = 0;
+      }
+    }
+  }
+
+}}} // namespace Azure::Storage::Test
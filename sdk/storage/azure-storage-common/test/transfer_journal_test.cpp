@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/transfer_journal.hpp"
+#include "test_base.hpp"
+
+#include <fstream>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(TransferJournalTest, Resume)
+  {
+    const std::string fileName = RandomString();
+    {
+      Details::TransferJournal journal(fileName, "\"etag1\"", 1000, 100);
+      EXPECT_FALSE(journal.IsResumed());
+      journal.SetChunkDone(3);
+      journal.SetChunkDone(0);
+      journal.SetChunkDone(9);
+    }
+    {
+      // A partly written line is ignored.
+      std::ofstream stream(fileName, std::ios::app);
+      stream << "5";
+    }
+    {
+      Details::TransferJournal journal(fileName, "\"etag1\"", 1000, 100);
+      EXPECT_TRUE(journal.IsResumed());
+      for (int64_t i = 0; i < 10; ++i)
+      {
+        EXPECT_EQ(journal.IsChunkDone(i), i == 0 || i == 3 || i == 9);
+      }
+      EXPECT_FALSE(journal.IsChunkDone(10));
+      journal.SetChunkDone(4);
+    }
+    {
+      Details::TransferJournal journal(fileName, "\"etag1\"", 1000, 100);
+      EXPECT_TRUE(journal.IsChunkDone(4));
+      EXPECT_FALSE(journal.IsChunkDone(5));
+    }
+
+    // A different transfer starts over.
+    {
+      Details::TransferJournal journal(fileName, "\"etag2\"", 1000, 100);
+      EXPECT_FALSE(journal.IsResumed());
+      EXPECT_FALSE(journal.IsChunkDone(0));
+    }
+    {
+      Details::TransferJournal journal(fileName, "\"etag2\"", 1000, 200);
+      EXPECT_FALSE(journal.IsResumed());
+      journal.Remove();
+    }
+    EXPECT_FALSE(std::ifstream(fileName).good());
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,194 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/concurrent_transfer.hpp"
+#include "azure/storage/common/transfer_manager.hpp"
+#include "test_base.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <thread>
+#include <vector>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(TransferManagerTest, RequestBudgetIsShared)
+  {
+    TransferManagerOptions options;
+    options.MaxConcurrentRequests = 3;
+    TransferManager manager(options);
+
+    std::atomic<int> numInFlight{0};
+    std::atomic<int> maxInFlight{0};
+    auto transferFunc = [&](int64_t, int64_t, int64_t, int64_t) {
+      int current = ++numInFlight;
+      int observed = maxInFlight;
+      while (current > observed && !maxInFlight.compare_exchange_weak(observed, current))
+      {
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds(2));
+      --numInFlight;
+    };
+
+    std::vector<std::shared_ptr<TransferHandle>> handles;
+    std::vector<std::thread> threads;
+    for (int i = 0; i < 4; ++i)
+    {
+      handles.push_back(manager.CreateTransfer());
+      threads.emplace_back([&, handle = handles.back()]() {
+        Details::ConcurrentTransfer(0, 100, 5, 8, transferFunc, handle);
+      });
+    }
+    for (auto& t : threads)
+    {
+      t.join();
+    }
+
+    EXPECT_LE(maxInFlight.load(), 3);
+    for (const auto& handle : handles)
+    {
+      EXPECT_EQ(handle->GetBytesTransferred(), 100);
+    }
+  }
+
+  TEST(TransferManagerTest, InteractiveGoesFirst)
+  {
+    TransferManagerOptions options;
+    options.MaxConcurrentRequests = 1;
+    TransferManager manager(options);
+    auto bulk = manager.CreateTransfer(TransferPriority::Bulk);
+    auto interactive = manager.CreateTransfer(TransferPriority::Interactive);
+
+    std::atomic<bool> interactiveDone{false};
+    std::atomic<int> bulkChunksAfterInteractiveQueued{0};
+    std::atomic<bool> interactiveQueued{false};
+
+    std::thread bulkThread([&]() {
+      Details::ConcurrentTransfer(
+          0,
+          200,
+          1,
+          1,
+          [&](int64_t, int64_t, int64_t, int64_t) {
+            if (interactiveQueued && !interactiveDone)
+            {
+              ++bulkChunksAfterInteractiveQueued;
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+          },
+          bulk);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+    interactiveQueued = true;
+    Details::ConcurrentTransfer(
+        0, 10, 1, 1, [&](int64_t, int64_t, int64_t, int64_t) {}, interactive);
+    interactiveDone = true;
+    bulkThread.join();
+
+    // Only the bulk requests racing with the interactive transfer being queued may slip in.
+    EXPECT_LE(bulkChunksAfterInteractiveQueued.load(), 2);
+    EXPECT_EQ(interactive->GetBytesTransferred(), 10);
+    EXPECT_EQ(bulk->GetBytesTransferred(), 200);
+  }
+
+  TEST(TransferManagerTest, PausedInteractiveDoesNotBlockBulk)
+  {
+    TransferManagerOptions options;
+    options.MaxConcurrentRequests = 1;
+    TransferManager manager(options);
+    auto bulk = manager.CreateTransfer(TransferPriority::Bulk);
+    auto interactive = manager.CreateTransfer(TransferPriority::Interactive);
+
+    interactive->Pause();
+    std::thread interactiveThread([&]() {
+      Details::ConcurrentTransfer(
+          0, 100, 1, 4, [](int64_t, int64_t, int64_t, int64_t) {}, interactive);
+    });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    Details::ConcurrentTransfer(0, 100, 1, 4, [](int64_t, int64_t, int64_t, int64_t) {}, bulk);
+    EXPECT_EQ(bulk->GetBytesTransferred(), 100);
+    EXPECT_EQ(interactive->GetBytesTransferred(), 0);
+
+    interactive->Resume();
+    interactiveThread.join();
+    EXPECT_EQ(interactive->GetBytesTransferred(), 100);
+  }
+
+  TEST(TransferManagerTest, PauseResumeCancel)
+  {
+    TransferManager manager;
+    auto handle = manager.CreateTransfer();
+
+    handle->Pause();
+    std::atomic<int> numChunks{0};
+    std::thread transferThread([&]() {
+      EXPECT_THROW(
+          Details::ConcurrentTransfer(
+              0,
+              1000000,
+              1,
+              2,
+              [&](int64_t, int64_t, int64_t, int64_t) {
+                ++numChunks;
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+              },
+              handle),
+          Azure::Core::OperationCanceledException);
+    });
+
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    EXPECT_EQ(numChunks.load(), 0);
+    EXPECT_EQ(handle->GetBytesTransferred(), 0);
+
+    handle->Resume();
+    while (numChunks.load() < 10)
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    handle->Cancel();
+    transferThread.join();
+    EXPECT_TRUE(handle->IsCancelled());
+    EXPECT_LT(handle->GetBytesTransferred(), 1000000);
+  }
+
+  TEST(TransferManagerTest, CancelCancelsBoundContext)
+  {
+    TransferManager manager;
+    auto handle = manager.CreateTransfer();
+    Azure::Core::Context parent;
+    auto context = Details::BindTransferContext(handle, parent);
+    EXPECT_NO_THROW(context.ThrowIfCanceled());
+    handle->Cancel();
+    EXPECT_THROW(context.ThrowIfCanceled(), Azure::Core::OperationCanceledException);
+    EXPECT_NO_THROW(parent.ThrowIfCanceled());
+
+    // Contexts derived from a bound context are cancelled with it.
+    auto secondHandle = manager.CreateTransfer();
+    auto derivedContext = Details::BindTransferContext(secondHandle, parent)
+                              .WithDeadline(Azure::Core::Context::time_point::max());
+    secondHandle->Cancel();
+    EXPECT_THROW(derivedContext.ThrowIfCanceled(), Azure::Core::OperationCanceledException);
+
+    // Contexts bound after cancellation are cancelled right away.
+    auto lateContext = Details::BindTransferContext(handle, parent);
+    EXPECT_THROW(lateContext.ThrowIfCanceled(), Azure::Core::OperationCanceledException);
+  }
+
+  TEST(TransferManagerTest, BandwidthCap)
+  {
+    TransferManagerOptions options;
+    options.MaxBytesPerSecond = 1000;
+    TransferManager manager(options);
+    auto handle = manager.CreateTransfer();
+
+    auto start = std::chrono::steady_clock::now();
+    // The first second worth of bytes is available right away, the rest is throttled.
+    Details::ConcurrentTransfer(
+        0, 1500, 100, 4, [](int64_t, int64_t, int64_t, int64_t) {}, handle);
+    auto elapsed = std::chrono::steady_clock::now() - start;
+    EXPECT_GE(elapsed, std::chrono::milliseconds(300));
+    EXPECT_EQ(handle->GetBytesTransferred(), 1500);
+  }
+
+}}} // namespace Azure::Storage::Test
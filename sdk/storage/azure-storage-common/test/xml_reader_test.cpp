@@ -0,0 +1,203 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/xml_wrapper.hpp"
+#include "test_base.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  namespace {
+    struct Node
+    {
+      Details::XmlNodeType Type;
+      std::string Name;
+      std::string Value;
+
+      bool operator==(const Node& other) const
+      {
+        return Type == other.Type && Name == other.Name && Value == other.Value;
+      }
+    };
+
+    // Returns the body in chunks of at most the given sizes, in turn, to split tokens at every
+    // possible position.
+    class TrickleBodyStream : public Azure::Core::Http::BodyStream {
+    public:
+      explicit TrickleBodyStream(const std::string& data, std::vector<int64_t> chunkSizes)
+          : m_data(data), m_chunkSizes(std::move(chunkSizes))
+      {
+      }
+
+      int64_t Length() const override { return static_cast<int64_t>(m_data.length()); }
+
+      int64_t Read(const Azure::Core::Context&, uint8_t* buffer, int64_t count) override
+      {
+        const int64_t available = static_cast<int64_t>(m_data.length() - m_offset);
+        const int64_t chunkSize = m_chunkSizes[m_numReads++ % m_chunkSizes.size()];
+        const int64_t bytesRead = std::min(std::min(count, chunkSize), available);
+        std::memcpy(buffer, m_data.data() + m_offset, static_cast<std::size_t>(bytesRead));
+        m_offset += static_cast<std::size_t>(bytesRead);
+        return bytesRead;
+      }
+
+    private:
+      std::string m_data;
+      std::vector<int64_t> m_chunkSizes;
+      std::size_t m_offset = 0;
+      std::size_t m_numReads = 0;
+    };
+
+    std::vector<Node> ReadAll(Details::XmlReader& reader)
+    {
+      std::vector<Node> nodes;
+      while (true)
+      {
+        auto node = reader.Read();
+        nodes.push_back(
+            Node{node.Type, node.Name ? node.Name : "", node.Value ? node.Value : ""});
+        if (node.Type == Details::XmlNodeType::End)
+        {
+          break;
+        }
+      }
+      return nodes;
+    }
+
+    std::vector<Node> ReadAll(const std::string& xml)
+    {
+      Details::XmlReader reader(xml.data(), xml.length());
+      return ReadAll(reader);
+    }
+
+    std::vector<Node> ReadAll(const std::string& xml, std::vector<int64_t> chunkSizes)
+    {
+      TrickleBodyStream stream(xml, std::move(chunkSizes));
+      Details::XmlReader reader(Azure::Core::Context(), stream);
+      return ReadAll(reader);
+    }
+
+  } // namespace
+
+  TEST(XmlReaderTest, Read)
+  {
+    using Details::XmlNodeType;
+    const std::string xml = "\xef\xbb\xbf<?xml version=\"1.0\" encoding=\"utf-8\"?>\r\n"
+                            "<!-- comment -->\r\n"
+                            "<EnumerationResults ServiceEndpoint=\"https://a.b/\" "
+                            "ContainerName='c&amp;d'>\r\n"
+                            "  <Prefix />\r\n"
+                            "  <Blobs>\r\n"
+                            "    <Blob><Name>a &lt;b&gt; &#x4e2d;&#25991; &quot;&apos;</Name>"
+                            "<Space> </Space><Empty></Empty>"
+                            "<Data><![CDATA[<raw> & data]]></Data>"
+                            "<Lines>1\r\n2\r3</Lines></Blob>\r\n"
+                            "  </Blobs>\r\n"
+                            "</EnumerationResults>\r\n";
+    const std::vector<Node> expected = {
+        {XmlNodeType::StartTag, "EnumerationResults", ""},
+        {XmlNodeType::Attribute, "ServiceEndpoint", "https://a.b/"},
+        {XmlNodeType::Attribute, "ContainerName", "c&d"},
+        {XmlNodeType::SelfClosingTag, "Prefix", ""},
+        {XmlNodeType::StartTag, "Blobs", ""},
+        {XmlNodeType::StartTag, "Blob", ""},
+        {XmlNodeType::StartTag, "Name", ""},
+        {XmlNodeType::Text, "", "a <b> \xe4\xb8\xad\xe6\x96\x87 \"'"},
+        {XmlNodeType::EndTag, "Name", ""},
+        {XmlNodeType::StartTag, "Space", ""},
+        {XmlNodeType::Text, "", " "},
+        {XmlNodeType::EndTag, "Space", ""},
+        {XmlNodeType::StartTag, "Empty", ""},
+        {XmlNodeType::EndTag, "Empty", ""},
+        {XmlNodeType::StartTag, "Data", ""},
+        {XmlNodeType::Text, "", "<raw> & data"},
+        {XmlNodeType::EndTag, "Data", ""},
+        {XmlNodeType::StartTag, "Lines", ""},
+        {XmlNodeType::Text, "", "1\n2\n3"},
+        {XmlNodeType::EndTag, "Lines", ""},
+        {XmlNodeType::EndTag, "Blob", ""},
+        {XmlNodeType::EndTag, "Blobs", ""},
+        {XmlNodeType::EndTag, "EnumerationResults", ""},
+        {XmlNodeType::End, "", ""},
+    };
+    EXPECT_EQ(ReadAll(xml), expected);
+    for (int64_t chunkSize : {1, 2, 3, 7, 64})
+    {
+      EXPECT_EQ(ReadAll(xml, {chunkSize}), expected) << chunkSize;
+    }
+    EXPECT_EQ(ReadAll(xml, {5, 1, 11, 2}), expected);
+
+    // Nodes stay valid after the reader moves on.
+    Details::XmlReader reader(xml.data(), xml.length());
+    auto root = reader.Read();
+    auto attribute = reader.Read();
+    reader.Read();
+    reader.Read();
+    EXPECT_STREQ(root.Name, "EnumerationResults");
+    EXPECT_STREQ(attribute.Value, "https://a.b/");
+  }
+
+  TEST(XmlReaderTest, Malformed)
+  {
+    for (const std::string xml :
+         {"<a><b></a></b>",
+          "<a><b></b>",
+          "<a>text",
+          "<a b></a>",
+          "<a b=\"c></a>",
+          "<a>&unknown;</a>",
+          "<a>&#xzz;</a>",
+          "</a>",
+          "text<a/>",
+          "<!DOCTYPE a><a/>",
+          "<a><!-- unterminated </a>"})
+    {
+      EXPECT_THROW(ReadAll(xml), std::runtime_error) << xml;
+      EXPECT_THROW(ReadAll(xml, {1}), std::runtime_error) << xml;
+    }
+  }
+
+  TEST(XmlReaderTest, DISABLED_ListBlobsThroughput)
+  {
+    constexpr int numBlobs = 5000;
+    std::string xml = "\xef\xbb\xbf<?xml version=\"1.0\" encoding=\"utf-8\"?><EnumerationResults "
+                      "ServiceEndpoint=\"https://account.blob.core.windows.net/\" "
+                      "ContainerName=\"container\"><Blobs>";
+    for (int i = 0; i < numBlobs; ++i)
+    {
+      xml += "<Blob><Name>directory/subdirectory/blob" + std::to_string(i)
+          + ".dat</Name><Properties><Creation-Time>Mon, 19 Oct 2020 00:00:00 GMT</Creation-Time>"
+            "<Last-Modified>Mon, 19 Oct 2020 00:00:00 GMT</Last-Modified>"
+            "<Etag>0x8D87401E0D9C9E4</Etag><Content-Length>1048576</Content-Length>"
+            "<Content-Type>application/octet-stream</Content-Type><Content-Encoding />"
+            "<Content-Language /><Content-CRC64 />"
+            "<Content-MD5>1B2M2Y8AsgTpgAmY7PhCfg==</Content-MD5><Cache-Control />"
+            "<Content-Disposition /><BlobType>BlockBlob</BlobType>"
+            "<AccessTier>Hot</AccessTier><AccessTierInferred>true</AccessTierInferred>"
+            "<LeaseStatus>unlocked</LeaseStatus><LeaseState>available</LeaseState>"
+            "<ServerEncrypted>true</ServerEncrypted></Properties><OrMetadata /></Blob>";
+    }
+    xml += "</Blobs><NextMarker /></EnumerationResults>";
+
+    constexpr int numIterations = 20;
+    std::size_t numNodes = 0;
+    auto timer_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numIterations; ++i)
+    {
+      Details::XmlReader reader(xml.data(), xml.length());
+      while (reader.Read().Type != Details::XmlNodeType::End)
+      {
+        ++numNodes;
+      }
+    }
+    auto timer_end = std::chrono::steady_clock::now();
+    EXPECT_GT(numNodes, static_cast<std::size_t>(numBlobs * numIterations));
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(timer_end - timer_start);
+    std::cout << "ListBlobs page of " << numBlobs
+              << " blobs parsed in: " << elapsed.count() / numIterations << "us" << std::endl;
+  }
+
+}}} // namespace Azure::Storage::Test
@@ -0,0 +1,153 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "azure/storage/common/crypt.hpp"
+#include "azure/storage/common/xml_wrapper.hpp"
+#include "test_base.hpp"
+
+#include <chrono>
+
+namespace Azure { namespace Storage { namespace Test {
+
+  TEST(XmlWriterTest, Write)
+  {
+    using Details::XmlNode;
+    using Details::XmlNodeType;
+    Details::XmlWriter writer;
+    writer.Write(XmlNode{XmlNodeType::StartTag, "Tags"});
+    writer.Write(XmlNode{XmlNodeType::Attribute, "a", "\"<&>\"\t\r\n"});
+    writer.Write(XmlNode{XmlNodeType::StartTag, "Empty"});
+    writer.Write(XmlNode{XmlNodeType::EndTag});
+    writer.Write(XmlNode{XmlNodeType::SelfClosingTag, "Self"});
+    writer.Write(XmlNode{XmlNodeType::StartTag, "Key", std::string("k&v").data()});
+    writer.Write(XmlNode{XmlNodeType::StartTag, "Value"});
+    writer.Write(XmlNode{XmlNodeType::Text, nullptr, "a<b>\"c\"\r\n"});
+    writer.Write(XmlNode{XmlNodeType::EndTag});
+    writer.Write(XmlNode{XmlNodeType::StartTag, "Open"});
+    writer.Write(XmlNode{XmlNodeType::Text, nullptr, "text"});
+    writer.Write(XmlNode{XmlNodeType::End});
+    EXPECT_EQ(
+        writer.GetDocument(),
+        "<?xml version=\"1.0\"?>\n"
+        "<Tags a=\"&quot;&lt;&amp;&gt;&quot;&#9;&#13;&#10;\"><Empty/><Self/><Key>k&amp;v</Key>"
+        "<Value>a&lt;b&gt;\"c\"&#13;\n</Value><Open>text</Open></Tags>");
+    EXPECT_TRUE(writer.GetDocument().empty());
+
+    EXPECT_THROW(writer.Write(XmlNode{XmlNodeType::EndTag}), std::runtime_error);
+    EXPECT_THROW(writer.Write(XmlNode{XmlNodeType::Attribute, "a", "b"}), std::runtime_error);
+  }
+
+  TEST(XmlWriterTest, BodyStream)
+  {
+    constexpr std::size_t numParts = 50;
+    std::size_t numPartsWritten = 0;
+    auto writePart = [&numPartsWritten](Details::XmlWriter& writer, std::size_t part) {
+      ++numPartsWritten;
+      if (part == 0)
+      {
+        writer.Write(Details::XmlNode{Details::XmlNodeType::StartTag, "BlockList"});
+      }
+      for (int i = 0; i < 100; ++i)
+      {
+        const std::string blockId = std::to_string(part * 100 + i);
+        writer.Write(
+            Details::XmlNode{Details::XmlNodeType::StartTag, "Latest", blockId.data()});
+      }
+      if (part == numParts - 1)
+      {
+        writer.Write(Details::XmlNode{Details::XmlNodeType::EndTag});
+        return false;
+      }
+      return true;
+    };
+
+    Details::XmlWriter writer;
+    for (std::size_t part = 0; writePart(writer, part); ++part)
+    {
+    }
+    const std::string expected = writer.GetDocument();
+
+    numPartsWritten = 0;
+    Details::XmlBodyStream stream(writePart);
+    EXPECT_EQ(stream.Length(), static_cast<int64_t>(expected.length()));
+    EXPECT_EQ(numPartsWritten, numParts);
+    for (int64_t chunkSize : {1, 7, 1000, 1000000})
+    {
+      stream.Rewind();
+      std::string actual;
+      std::vector<uint8_t> buffer(static_cast<std::size_t>(chunkSize));
+      while (true)
+      {
+        auto bytesRead = stream.Read(Azure::Core::Context(), buffer.data(), chunkSize);
+        if (bytesRead == 0)
+        {
+          break;
+        }
+        actual.append(buffer.begin(), buffer.begin() + static_cast<std::size_t>(bytesRead));
+      }
+      EXPECT_EQ(actual, expected) << chunkSize;
+    }
+
+    // Only the parts beyond the start of the document kept in memory are written again.
+    const std::size_t numPartsRead = numPartsWritten - numParts;
+    EXPECT_GT(numPartsRead, 0U);
+    EXPECT_LT(numPartsRead, 4 * numParts);
+
+    // A small document is only serialized once.
+    numPartsWritten = 0;
+    auto writeSmallDocument = [&](Details::XmlWriter& writer, std::size_t part) {
+      writePart(writer, part == 0 ? 0 : numParts - 1);
+      return part == 0;
+    };
+    Details::XmlBodyStream smallStream(writeSmallDocument);
+    std::vector<uint8_t> buffer(static_cast<std::size_t>(smallStream.Length()) + 1);
+    EXPECT_EQ(
+        smallStream.Read(Azure::Core::Context(), buffer.data(), smallStream.Length() + 1),
+        smallStream.Length());
+    EXPECT_EQ(smallStream.Read(Azure::Core::Context(), buffer.data(), 1), 0);
+    EXPECT_EQ(numPartsWritten, 2U);
+
+    // Parts can be parsed back.
+    Details::XmlReader reader(expected.data(), expected.length());
+    std::size_t numBlocks = 0;
+    for (auto node = reader.Read(); node.Type != Details::XmlNodeType::End; node = reader.Read())
+    {
+      if (node.Type == Details::XmlNodeType::Text)
+      {
+        EXPECT_EQ(std::to_string(numBlocks++), node.Value);
+      }
+    }
+    EXPECT_EQ(numBlocks, numParts * 100);
+  }
+
+  TEST(XmlWriterTest, DISABLED_CommitBlockListThroughput)
+  {
+    constexpr int numBlocks = 50000;
+    std::vector<std::string> blockIds;
+    for (int i = 0; i < numBlocks; ++i)
+    {
+      blockIds.push_back(Base64Encode("block-" + std::to_string(1000000 + i)));
+    }
+
+    constexpr int numIterations = 20;
+    std::size_t documentLength = 0;
+    auto timer_start = std::chrono::steady_clock::now();
+    for (int i = 0; i < numIterations; ++i)
+    {
+      Details::XmlWriter writer;
+      writer.Write(Details::XmlNode{Details::XmlNodeType::StartTag, "BlockList"});
+      for (const auto& blockId : blockIds)
+      {
+        writer.Write(Details::XmlNode{Details::XmlNodeType::StartTag, "Latest", blockId.data()});
+      }
+      writer.Write(Details::XmlNode{Details::XmlNodeType::EndTag});
+      documentLength += writer.GetDocument().length();
+    }
+    auto timer_end = std::chrono::steady_clock::now();
+    EXPECT_GT(documentLength, static_cast<std::size_t>(numBlocks * numIterations));
+    auto elapsed = std::chrono::duration_cast<std::chrono::microseconds>(timer_end - timer_start);
+    std::cout << "CommitBlockList body of " << numBlocks
+              << " blocks serialized in: " << elapsed.count() / numIterations << "us" << std::endl;
+  }
+
+}}} // namespace Azure::Storage::Test
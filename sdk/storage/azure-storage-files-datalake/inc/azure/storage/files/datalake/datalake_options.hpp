@@ -6,6 +6,7 @@
 #include "azure/core/nullable.hpp"
 #include "azure/storage/blobs/blob_options.hpp"
 #include "azure/storage/common/access_conditions.hpp"
+#include "azure/storage/common/transfer_manager.hpp"
 #include "azure/storage/files/datalake/protocol/datalake_rest_client.hpp"
 
 #include <map>
@@ -745,6 +746,24 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
      * @brief The maximum number of threads that may be used in a parallel transfer.
      */
     int Concurrency = 5;
+
+    /**
+     * @brief If true, a CRC64 is computed for every block and sent to the service to validate it.
+     */
+    bool UseTransactionalCrc64 = false;
+
+    /**
+     * @brief If true, the file is memory-mapped and every chunk is sent straight from the mapping
+     * instead of being read into a transfer buffer. Files that can't be mapped are read as usual.
+     * The file must not be truncated during the upload.
+     */
+    bool UseMemoryMappedFile = false;
+
+    /**
+     * @brief Schedules this transfer with a TransferManager, which can also pause, resume, cancel
+     * and report the progress of it. Null means the transfer is not managed.
+     */
+    std::shared_ptr<Storage::TransferHandle> TransferHandle;
   };
 
   using ScheduleFileExpiryOriginType = Blobs::Models::ScheduleBlobExpiryOriginType;
@@ -9,7 +9,7 @@
 #include "azure/core/nullable.hpp"
 #include "azure/core/response.hpp"
 #include "azure/storage/common/crypt.hpp"
-#include "azure/storage/common/json.hpp"
+#include "azure/storage/common/json_reader.hpp"
 #include "azure/storage/common/storage_common.hpp"
 #include "azure/storage/common/storage_exception.hpp"
 
@@ -759,7 +759,8 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
             ServiceListFileSystemsResult result = bodyBuffer.empty()
                 ? ServiceListFileSystemsResult()
                 : ServiceListFileSystemsResultFromFileSystemList(
-                    FileSystemListFromJson(nlohmann::json::parse(bodyBuffer)));
+                    FileSystemListFromJson(Storage::Details::JsonReader(
+                        reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size())));
             if (response.GetHeaders().find(Details::c_HeaderXMsContinuation)
                 != response.GetHeaders().end())
             {
@@ -775,22 +776,55 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
           }
         }
 
-        static Storage::Files::DataLake::FileSystem FileSystemFromJson(const nlohmann::json& node)
+        static Storage::Files::DataLake::FileSystem FileSystemFromJson(
+            Storage::Details::JsonReader& reader)
         {
           Storage::Files::DataLake::FileSystem result;
-          result.Name = node["name"].get<std::string>();
-          result.LastModified = node["lastModified"].get<std::string>();
-          result.ETag = node["etag"].get<std::string>();
+          reader.Read(Storage::Details::JsonTokenType::StartObject);
+          for (auto token = reader.Read(); token.Type != Storage::Details::JsonTokenType::EndObject;
+               token = reader.Read())
+          {
+            if (token.Equals("name"))
+            {
+              result.Name = reader.ReadString();
+            }
+            else if (token.Equals("lastModified"))
+            {
+              result.LastModified = reader.ReadString();
+            }
+            else if (token.Equals("etag"))
+            {
+              result.ETag = reader.ReadString();
+            }
+            else
+            {
+              reader.SkipValue();
+            }
+          }
           return result;
         }
 
         static Storage::Files::DataLake::FileSystemList FileSystemListFromJson(
-            const nlohmann::json& node)
+            Storage::Details::JsonReader&& reader)
         {
           Storage::Files::DataLake::FileSystemList result;
-          for (const auto& element : node["filesystems"])
+          reader.Read(Storage::Details::JsonTokenType::StartObject);
+          for (auto token = reader.Read(); token.Type != Storage::Details::JsonTokenType::EndObject;
+               token = reader.Read())
           {
-            result.Filesystems.emplace_back(FileSystemFromJson(element));
+            if (token.Equals("filesystems"))
+            {
+              reader.Read(Storage::Details::JsonTokenType::StartArray);
+              while (reader.PeekType() != Storage::Details::JsonTokenType::EndArray)
+              {
+                result.Filesystems.emplace_back(FileSystemFromJson(reader));
+              }
+              reader.Read();
+            }
+            else
+            {
+              reader.SkipValue();
+            }
           }
           return result;
         }
@@ -1240,7 +1274,8 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
             FileSystemListPathsResult result = bodyBuffer.empty()
                 ? FileSystemListPathsResult()
                 : FileSystemListPathsResultFromPathList(
-                    PathListFromJson(nlohmann::json::parse(bodyBuffer)));
+                    PathListFromJson(Storage::Details::JsonReader(
+                        reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size())));
             if (response.GetHeaders().find(Details::c_HeaderXMsContinuation)
                 != response.GetHeaders().end())
             {
@@ -1256,32 +1291,74 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
           }
         }
 
-        static Storage::Files::DataLake::Path PathFromJson(const nlohmann::json& node)
+        static Storage::Files::DataLake::Path PathFromJson(Storage::Details::JsonReader& reader)
         {
           Storage::Files::DataLake::Path result;
-          result.Name = node["name"].get<std::string>();
-          if (node.contains("isDirectory"))
+          reader.Read(Storage::Details::JsonTokenType::StartObject);
+          for (auto token = reader.Read(); token.Type != Storage::Details::JsonTokenType::EndObject;
+               token = reader.Read())
           {
-            result.IsDirectory = (node["isDirectory"].get<std::string>() == "true");
-          }
-          result.LastModified = node["lastModified"].get<std::string>();
-          result.ETag = node["etag"].get<std::string>();
-          if (node.contains("contentLength"))
-          {
-            result.ContentLength = std::stoll(node["contentLength"].get<std::string>());
+            if (token.Equals("name"))
+            {
+              result.Name = reader.ReadString();
+            }
+            else if (token.Equals("isDirectory"))
+            {
+              result.IsDirectory = reader.ReadBoolean();
+            }
+            else if (token.Equals("lastModified"))
+            {
+              result.LastModified = reader.ReadString();
+            }
+            else if (token.Equals("etag"))
+            {
+              result.ETag = reader.ReadString();
+            }
+            else if (token.Equals("contentLength"))
+            {
+              result.ContentLength = reader.ReadInt64();
+            }
+            else if (token.Equals("owner"))
+            {
+              result.Owner = reader.ReadString();
+            }
+            else if (token.Equals("group"))
+            {
+              result.Group = reader.ReadString();
+            }
+            else if (token.Equals("permissions"))
+            {
+              result.Permissions = reader.ReadString();
+            }
+            else
+            {
+              reader.SkipValue();
+            }
           }
-          result.Owner = node["owner"].get<std::string>();
-          result.Group = node["group"].get<std::string>();
-          result.Permissions = node["permissions"].get<std::string>();
           return result;
         }
 
-        static Storage::Files::DataLake::PathList PathListFromJson(const nlohmann::json& node)
+        static Storage::Files::DataLake::PathList PathListFromJson(
+            Storage::Details::JsonReader&& reader)
         {
           Storage::Files::DataLake::PathList result;
-          for (const auto& element : node["paths"])
+          reader.Read(Storage::Details::JsonTokenType::StartObject);
+          for (auto token = reader.Read(); token.Type != Storage::Details::JsonTokenType::EndObject;
+               token = reader.Read())
           {
-            result.Paths.emplace_back(PathFromJson(element));
+            if (token.Equals("paths"))
+            {
+              reader.Read(Storage::Details::JsonTokenType::StartArray);
+              while (reader.PeekType() != Storage::Details::JsonTokenType::EndArray)
+              {
+                result.Paths.emplace_back(PathFromJson(reader));
+              }
+              reader.Read();
+            }
+            else
+            {
+              reader.SkipValue();
+            }
           }
           return result;
         }
@@ -2909,7 +2986,8 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
             PathSetAccessControlRecursiveResult result = bodyBuffer.empty()
                 ? PathSetAccessControlRecursiveResult()
                 : PathSetAccessControlRecursiveResultFromSetAccessControlRecursiveResponse(
-                    SetAccessControlRecursiveResponseFromJson(nlohmann::json::parse(bodyBuffer)));
+                    SetAccessControlRecursiveResponseFromJson(Storage::Details::JsonReader(
+                        reinterpret_cast<const char*>(bodyBuffer.data()), bodyBuffer.size())));
             if (response.GetHeaders().find(Details::c_HeaderXMsContinuation)
                 != response.GetHeaders().end())
             {
@@ -2926,25 +3004,66 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
         }
 
         static Storage::Files::DataLake::AclFailedEntry AclFailedEntryFromJson(
-            const nlohmann::json& node)
+            Storage::Details::JsonReader& reader)
         {
           Storage::Files::DataLake::AclFailedEntry result;
-          result.Name = node["name"].get<std::string>();
-          result.Type = node["type"].get<std::string>();
-          result.ErrorMessage = node["errorMessage"].get<std::string>();
+          reader.Read(Storage::Details::JsonTokenType::StartObject);
+          for (auto token = reader.Read(); token.Type != Storage::Details::JsonTokenType::EndObject;
+               token = reader.Read())
+          {
+            if (token.Equals("name"))
+            {
+              result.Name = reader.ReadString();
+            }
+            else if (token.Equals("type"))
+            {
+              result.Type = reader.ReadString();
+            }
+            else if (token.Equals("errorMessage"))
+            {
+              result.ErrorMessage = reader.ReadString();
+            }
+            else
+            {
+              reader.SkipValue();
+            }
+          }
           return result;
         }
 
         static Storage::Files::DataLake::SetAccessControlRecursiveResponse
-        SetAccessControlRecursiveResponseFromJson(const nlohmann::json& node)
+        SetAccessControlRecursiveResponseFromJson(Storage::Details::JsonReader&& reader)
         {
           Storage::Files::DataLake::SetAccessControlRecursiveResponse result;
-          result.DirectoriesSuccessful = node["directoriesSuccessful"].get<int32_t>();
-          result.FilesSuccessful = node["filesSuccessful"].get<int32_t>();
-          result.FailureCount = node["failureCount"].get<int32_t>();
-          for (const auto& element : node["failedEntries"])
+          reader.Read(Storage::Details::JsonTokenType::StartObject);
+          for (auto token = reader.Read(); token.Type != Storage::Details::JsonTokenType::EndObject;
+               token = reader.Read())
           {
-            result.FailedEntries.emplace_back(AclFailedEntryFromJson(element));
+            if (token.Equals("directoriesSuccessful"))
+            {
+              result.DirectoriesSuccessful = static_cast<int32_t>(reader.ReadInt64());
+            }
+            else if (token.Equals("filesSuccessful"))
+            {
+              result.FilesSuccessful = static_cast<int32_t>(reader.ReadInt64());
+            }
+            else if (token.Equals("failureCount"))
+            {
+              result.FailureCount = static_cast<int32_t>(reader.ReadInt64());
+            }
+            else if (token.Equals("failedEntries"))
+            {
+              reader.Read(Storage::Details::JsonTokenType::StartArray);
+              while (reader.PeekType() != Storage::Details::JsonTokenType::EndArray)
+              {
+                result.FailedEntries.emplace_back(AclFailedEntryFromJson(reader));
+              }
+              reader.Read();
+            }
+            else
+            {
+              reader.SkipValue();
+            }
           }
           return result;
         }
@@ -346,6 +346,9 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     blobOptions.HttpHeaders = FromDataLakeHttpHeaders(options.HttpHeaders);
     blobOptions.Metadata = options.Metadata;
     blobOptions.Concurrency = options.Concurrency;
+    blobOptions.TransferHandle = options.TransferHandle;
+    blobOptions.UseTransactionalCrc64 = options.UseTransactionalCrc64;
+    blobOptions.UseMemoryMappedFile = options.UseMemoryMappedFile;
     return m_blockBlobClient.UploadFrom(fileName, blobOptions);
   }
 
@@ -360,6 +363,8 @@ namespace Azure { namespace Storage { namespace Files { namespace DataLake {
     blobOptions.HttpHeaders = FromDataLakeHttpHeaders(options.HttpHeaders);
     blobOptions.Metadata = options.Metadata;
     blobOptions.Concurrency = options.Concurrency;
+    blobOptions.TransferHandle = options.TransferHandle;
+    blobOptions.UseTransactionalCrc64 = options.UseTransactionalCrc64;
     return m_blockBlobClient.UploadFrom(buffer, bufferSize, blobOptions);
   }
 
@@ -1285,6 +1285,9 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           std::string ApiVersionParameter
               = Details::c_DefaultServiceApiVersion; // Specifies the version of the operation to
                                                      // use for this request.
+          std::function<void(ShareItem)>
+              OnShareItem; // If set, the response is parsed as it's received and shares are
+                           // passed to this function instead of being added to the result.
         };
 
         static Azure::Core::Response<ServiceListSharesSegmentResult> ListSharesSegment(
@@ -1293,7 +1296,10 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             Azure::Core::Context context,
             const ListSharesSegmentOptions& listSharesSegmentOptions)
         {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+          Azure::Core::Http::Request request(
+              Azure::Core::Http::HttpMethod::Get,
+              url,
+              static_cast<bool>(listSharesSegmentOptions.OnShareItem));
           request.GetUrl().AppendQueryParameter(Details::c_QueryComp, "list");
           if (listSharesSegmentOptions.Prefix.HasValue())
           {
@@ -1331,7 +1337,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
                     std::to_string(listSharesSegmentOptions.Timeout.GetValue())));
           }
           request.AddHeader(Details::c_HeaderVersion, listSharesSegmentOptions.ApiVersionParameter);
-          return ListSharesSegmentParseResult(context, pipeline.Send(context, request));
+          return ListSharesSegmentParseResult(
+              context, pipeline.Send(context, request), listSharesSegmentOptions.OnShareItem);
         }
 
       private:
@@ -1617,26 +1624,37 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
 
-              if (std::strcmp(node.Name, "Enabled") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Enabled);
-              }
-              else if (std::strcmp(node.Name, "IncludeAPIs") == 0)
-              {
-                path.emplace_back(XmlTagName::c_IncludeAPIs);
-              }
-              else if (std::strcmp(node.Name, "RetentionPolicy") == 0)
-              {
-                path.emplace_back(XmlTagName::c_RetentionPolicy);
-              }
-              else if (std::strcmp(node.Name, "Version") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Version);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::c_Unknown);
-              }
+              XmlTagName tag = XmlTagName::c_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Enabled"):
+                  if (std::strcmp(node.Name, "Enabled") == 0)
+                  {
+                    tag = XmlTagName::c_Enabled;
+                  }
+                  break;
+                case Storage::Details::StaticHash("IncludeAPIs"):
+                  if (std::strcmp(node.Name, "IncludeAPIs") == 0)
+                  {
+                    tag = XmlTagName::c_IncludeAPIs;
+                  }
+                  break;
+                case Storage::Details::StaticHash("RetentionPolicy"):
+                  if (std::strcmp(node.Name, "RetentionPolicy") == 0)
+                  {
+                    tag = XmlTagName::c_RetentionPolicy;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Version"):
+                  if (std::strcmp(node.Name, "Version") == 0)
+                  {
+                    tag = XmlTagName::c_Version;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
 
               if (path.size() == 1 && path[0] == XmlTagName::c_RetentionPolicy)
               {
@@ -1698,30 +1716,43 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
 
-              if (std::strcmp(node.Name, "AllowedHeaders") == 0)
-              {
-                path.emplace_back(XmlTagName::c_AllowedHeaders);
-              }
-              else if (std::strcmp(node.Name, "AllowedMethods") == 0)
-              {
-                path.emplace_back(XmlTagName::c_AllowedMethods);
-              }
-              else if (std::strcmp(node.Name, "AllowedOrigins") == 0)
-              {
-                path.emplace_back(XmlTagName::c_AllowedOrigins);
-              }
-              else if (std::strcmp(node.Name, "ExposedHeaders") == 0)
-              {
-                path.emplace_back(XmlTagName::c_ExposedHeaders);
-              }
-              else if (std::strcmp(node.Name, "MaxAgeInSeconds") == 0)
-              {
-                path.emplace_back(XmlTagName::c_MaxAgeInSeconds);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::c_Unknown);
-              }
+              XmlTagName tag = XmlTagName::c_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("AllowedHeaders"):
+                  if (std::strcmp(node.Name, "AllowedHeaders") == 0)
+                  {
+                    tag = XmlTagName::c_AllowedHeaders;
+                  }
+                  break;
+                case Storage::Details::StaticHash("AllowedMethods"):
+                  if (std::strcmp(node.Name, "AllowedMethods") == 0)
+                  {
+                    tag = XmlTagName::c_AllowedMethods;
+                  }
+                  break;
+                case Storage::Details::StaticHash("AllowedOrigins"):
+                  if (std::strcmp(node.Name, "AllowedOrigins") == 0)
+                  {
+                    tag = XmlTagName::c_AllowedOrigins;
+                  }
+                  break;
+                case Storage::Details::StaticHash("ExposedHeaders"):
+                  if (std::strcmp(node.Name, "ExposedHeaders") == 0)
+                  {
+                    tag = XmlTagName::c_ExposedHeaders;
+                  }
+                  break;
+                case Storage::Details::StaticHash("MaxAgeInSeconds"):
+                  if (std::strcmp(node.Name, "MaxAgeInSeconds") == 0)
+                  {
+                    tag = XmlTagName::c_MaxAgeInSeconds;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
             }
             else if (node.Type == Storage::Details::XmlNodeType::Text)
             {
@@ -1945,34 +1976,49 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
 
-              if (std::strcmp(node.Name, "Cors") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Cors);
-              }
-              else if (std::strcmp(node.Name, "CorsRule") == 0)
-              {
-                path.emplace_back(XmlTagName::c_CorsRule);
-              }
-              else if (std::strcmp(node.Name, "HourMetrics") == 0)
-              {
-                path.emplace_back(XmlTagName::c_HourMetrics);
-              }
-              else if (std::strcmp(node.Name, "MinuteMetrics") == 0)
-              {
-                path.emplace_back(XmlTagName::c_MinuteMetrics);
-              }
-              else if (std::strcmp(node.Name, "ProtocolSettings") == 0)
-              {
-                path.emplace_back(XmlTagName::c_ProtocolSettings);
-              }
-              else if (std::strcmp(node.Name, "StorageServiceProperties") == 0)
-              {
-                path.emplace_back(XmlTagName::c_StorageServiceProperties);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::c_Unknown);
-              }
+              XmlTagName tag = XmlTagName::c_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Cors"):
+                  if (std::strcmp(node.Name, "Cors") == 0)
+                  {
+                    tag = XmlTagName::c_Cors;
+                  }
+                  break;
+                case Storage::Details::StaticHash("CorsRule"):
+                  if (std::strcmp(node.Name, "CorsRule") == 0)
+                  {
+                    tag = XmlTagName::c_CorsRule;
+                  }
+                  break;
+                case Storage::Details::StaticHash("HourMetrics"):
+                  if (std::strcmp(node.Name, "HourMetrics") == 0)
+                  {
+                    tag = XmlTagName::c_HourMetrics;
+                  }
+                  break;
+                case Storage::Details::StaticHash("MinuteMetrics"):
+                  if (std::strcmp(node.Name, "MinuteMetrics") == 0)
+                  {
+                    tag = XmlTagName::c_MinuteMetrics;
+                  }
+                  break;
+                case Storage::Details::StaticHash("ProtocolSettings"):
+                  if (std::strcmp(node.Name, "ProtocolSettings") == 0)
+                  {
+                    tag = XmlTagName::c_ProtocolSettings;
+                  }
+                  break;
+                case Storage::Details::StaticHash("StorageServiceProperties"):
+                  if (std::strcmp(node.Name, "StorageServiceProperties") == 0)
+                  {
+                    tag = XmlTagName::c_StorageServiceProperties;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
 
               if (path.size() == 2 && path[0] == XmlTagName::c_StorageServiceProperties
                   && path[1] == XmlTagName::c_HourMetrics)
@@ -2022,10 +2068,22 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         }
         static Azure::Core::Response<ServiceListSharesSegmentResult> ListSharesSegmentParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr,
+            const std::function<void(ShareItem)>& onShareItem)
         {
           auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
+          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok && onShareItem)
+          {
+            // Success, shares are passed to the callback as they're received.
+            auto bodyStream = response.GetBodyStream();
+            Storage::Details::XmlReader reader(context, *bodyStream);
+            ServiceListSharesSegmentResult result
+                = ServiceListSharesSegmentResultFromListSharesResponse(
+                    ListSharesResponseFromXml(reader, onShareItem));
+            return Azure::Core::Response<ServiceListSharesSegmentResult>(
+                std::move(result), std::move(responsePtr));
+          }
+          else if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
           {
             // Success.
             const auto& bodyBuffer = response.GetBody();
@@ -2034,7 +2092,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             ServiceListSharesSegmentResult result = bodyBuffer.empty()
                 ? ServiceListSharesSegmentResult()
                 : ServiceListSharesSegmentResultFromListSharesResponse(
-                    ListSharesResponseFromXml(reader));
+                    ListSharesResponseFromXml(reader, onShareItem));
             return Azure::Core::Response<ServiceListSharesSegmentResult>(
                 std::move(result), std::move(responsePtr));
           }
@@ -2240,58 +2298,85 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
 
-              if (std::strcmp(node.Name, "DeletedTime") == 0)
-              {
-                path.emplace_back(XmlTagName::c_DeletedTime);
-              }
-              else if (std::strcmp(node.Name, "Etag") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Etag);
-              }
-              else if (std::strcmp(node.Name, "Last-Modified") == 0)
-              {
-                path.emplace_back(XmlTagName::c_LastModified);
-              }
-              else if (std::strcmp(node.Name, "LeaseDuration") == 0)
-              {
-                path.emplace_back(XmlTagName::c_LeaseDuration);
-              }
-              else if (std::strcmp(node.Name, "LeaseState") == 0)
-              {
-                path.emplace_back(XmlTagName::c_LeaseState);
-              }
-              else if (std::strcmp(node.Name, "LeaseStatus") == 0)
-              {
-                path.emplace_back(XmlTagName::c_LeaseStatus);
-              }
-              else if (std::strcmp(node.Name, "NextAllowedQuotaDowngradeTime") == 0)
-              {
-                path.emplace_back(XmlTagName::c_NextAllowedQuotaDowngradeTime);
-              }
-              else if (std::strcmp(node.Name, "ProvisionedEgressMBps") == 0)
-              {
-                path.emplace_back(XmlTagName::c_ProvisionedEgressMBps);
-              }
-              else if (std::strcmp(node.Name, "ProvisionedIngressMBps") == 0)
-              {
-                path.emplace_back(XmlTagName::c_ProvisionedIngressMBps);
-              }
-              else if (std::strcmp(node.Name, "ProvisionedIops") == 0)
-              {
-                path.emplace_back(XmlTagName::c_ProvisionedIops);
-              }
-              else if (std::strcmp(node.Name, "Quota") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Quota);
-              }
-              else if (std::strcmp(node.Name, "RemainingRetentionDays") == 0)
-              {
-                path.emplace_back(XmlTagName::c_RemainingRetentionDays);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::c_Unknown);
-              }
+              XmlTagName tag = XmlTagName::c_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("DeletedTime"):
+                  if (std::strcmp(node.Name, "DeletedTime") == 0)
+                  {
+                    tag = XmlTagName::c_DeletedTime;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Etag"):
+                  if (std::strcmp(node.Name, "Etag") == 0)
+                  {
+                    tag = XmlTagName::c_Etag;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Last-Modified"):
+                  if (std::strcmp(node.Name, "Last-Modified") == 0)
+                  {
+                    tag = XmlTagName::c_LastModified;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LeaseDuration"):
+                  if (std::strcmp(node.Name, "LeaseDuration") == 0)
+                  {
+                    tag = XmlTagName::c_LeaseDuration;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LeaseState"):
+                  if (std::strcmp(node.Name, "LeaseState") == 0)
+                  {
+                    tag = XmlTagName::c_LeaseState;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LeaseStatus"):
+                  if (std::strcmp(node.Name, "LeaseStatus") == 0)
+                  {
+                    tag = XmlTagName::c_LeaseStatus;
+                  }
+                  break;
+                case Storage::Details::StaticHash("NextAllowedQuotaDowngradeTime"):
+                  if (std::strcmp(node.Name, "NextAllowedQuotaDowngradeTime") == 0)
+                  {
+                    tag = XmlTagName::c_NextAllowedQuotaDowngradeTime;
+                  }
+                  break;
+                case Storage::Details::StaticHash("ProvisionedEgressMBps"):
+                  if (std::strcmp(node.Name, "ProvisionedEgressMBps") == 0)
+                  {
+                    tag = XmlTagName::c_ProvisionedEgressMBps;
+                  }
+                  break;
+                case Storage::Details::StaticHash("ProvisionedIngressMBps"):
+                  if (std::strcmp(node.Name, "ProvisionedIngressMBps") == 0)
+                  {
+                    tag = XmlTagName::c_ProvisionedIngressMBps;
+                  }
+                  break;
+                case Storage::Details::StaticHash("ProvisionedIops"):
+                  if (std::strcmp(node.Name, "ProvisionedIops") == 0)
+                  {
+                    tag = XmlTagName::c_ProvisionedIops;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Quota"):
+                  if (std::strcmp(node.Name, "Quota") == 0)
+                  {
+                    tag = XmlTagName::c_Quota;
+                  }
+                  break;
+                case Storage::Details::StaticHash("RemainingRetentionDays"):
+                  if (std::strcmp(node.Name, "RemainingRetentionDays") == 0)
+                  {
+                    tag = XmlTagName::c_RemainingRetentionDays;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
 
               if (path.size() == 1 && path[0] == XmlTagName::c_LeaseStatus)
               {
@@ -2423,34 +2508,49 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
 
-              if (std::strcmp(node.Name, "Deleted") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Deleted);
-              }
-              else if (std::strcmp(node.Name, "Metadata") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Metadata);
-              }
-              else if (std::strcmp(node.Name, "Name") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Name);
-              }
-              else if (std::strcmp(node.Name, "Properties") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Properties);
-              }
-              else if (std::strcmp(node.Name, "Snapshot") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Snapshot);
-              }
-              else if (std::strcmp(node.Name, "Version") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Version);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::c_Unknown);
-              }
+              XmlTagName tag = XmlTagName::c_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Deleted"):
+                  if (std::strcmp(node.Name, "Deleted") == 0)
+                  {
+                    tag = XmlTagName::c_Deleted;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Metadata"):
+                  if (std::strcmp(node.Name, "Metadata") == 0)
+                  {
+                    tag = XmlTagName::c_Metadata;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Name"):
+                  if (std::strcmp(node.Name, "Name") == 0)
+                  {
+                    tag = XmlTagName::c_Name;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Properties"):
+                  if (std::strcmp(node.Name, "Properties") == 0)
+                  {
+                    tag = XmlTagName::c_Properties;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Snapshot"):
+                  if (std::strcmp(node.Name, "Snapshot") == 0)
+                  {
+                    tag = XmlTagName::c_Snapshot;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Version"):
+                  if (std::strcmp(node.Name, "Version") == 0)
+                  {
+                    tag = XmlTagName::c_Version;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
 
               if (path.size() == 1 && path[0] == XmlTagName::c_Properties)
               {
@@ -2486,7 +2586,9 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           return result;
         }
 
-        static ListSharesResponse ListSharesResponseFromXml(Storage::Details::XmlReader& reader)
+        static ListSharesResponse ListSharesResponseFromXml(
+            Storage::Details::XmlReader& reader,
+            const std::function<void(ShareItem)>& onShareItem)
         {
           auto result = ListSharesResponse();
           enum class XmlTagName
@@ -2523,42 +2625,66 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
 
-              if (std::strcmp(node.Name, "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::c_EnumerationResults);
-              }
-              else if (std::strcmp(node.Name, "Marker") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Marker);
-              }
-              else if (std::strcmp(node.Name, "MaxResults") == 0)
-              {
-                path.emplace_back(XmlTagName::c_MaxResults);
-              }
-              else if (std::strcmp(node.Name, "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::c_NextMarker);
-              }
-              else if (std::strcmp(node.Name, "Prefix") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Prefix);
-              }
-              else if (std::strcmp(node.Name, "Share") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Share);
-              }
-              else if (std::strcmp(node.Name, "Shares") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Shares);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::c_Unknown);
-              }
+              XmlTagName tag = XmlTagName::c_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("EnumerationResults"):
+                  if (std::strcmp(node.Name, "EnumerationResults") == 0)
+                  {
+                    tag = XmlTagName::c_EnumerationResults;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Marker"):
+                  if (std::strcmp(node.Name, "Marker") == 0)
+                  {
+                    tag = XmlTagName::c_Marker;
+                  }
+                  break;
+                case Storage::Details::StaticHash("MaxResults"):
+                  if (std::strcmp(node.Name, "MaxResults") == 0)
+                  {
+                    tag = XmlTagName::c_MaxResults;
+                  }
+                  break;
+                case Storage::Details::StaticHash("NextMarker"):
+                  if (std::strcmp(node.Name, "NextMarker") == 0)
+                  {
+                    tag = XmlTagName::c_NextMarker;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Prefix"):
+                  if (std::strcmp(node.Name, "Prefix") == 0)
+                  {
+                    tag = XmlTagName::c_Prefix;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Share"):
+                  if (std::strcmp(node.Name, "Share") == 0)
+                  {
+                    tag = XmlTagName::c_Share;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Shares"):
+                  if (std::strcmp(node.Name, "Shares") == 0)
+                  {
+                    tag = XmlTagName::c_Shares;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 3 && path[0] == XmlTagName::c_EnumerationResults
                   && path[1] == XmlTagName::c_Shares && path[2] == XmlTagName::c_Share)
               {
-                result.ShareItems.emplace_back(ShareItemFromXml(reader));
+                if (onShareItem)
+                {
+                  onShareItem(ShareItemFromXml(reader));
+                }
+                else
+                {
+                  result.ShareItems.emplace_back(ShareItemFromXml(reader));
+                }
                 path.pop_back();
               }
             }
@@ -4601,6 +4727,13 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           std::string ApiVersionParameter
               = Details::c_DefaultServiceApiVersion; // Specifies the version of the operation to
                                                      // use for this request.
+          std::function<void(DirectoryItem)>
+              OnDirectoryItem; // If set, the response is parsed as it's received and directories
+                               // are passed to this function instead of being added to the
+                               // result.
+          std::function<void(FileItem)>
+              OnFileItem; // If set, the response is parsed as it's received and files are passed
+                          // to this function instead of being added to the result.
         };
 
         static Azure::Core::Response<DirectoryListFilesAndDirectoriesSegmentResult>
@@ -4610,7 +4743,11 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             Azure::Core::Context context,
             const ListFilesAndDirectoriesSegmentOptions& listFilesAndDirectoriesSegmentOptions)
         {
-          Azure::Core::Http::Request request(Azure::Core::Http::HttpMethod::Get, url);
+          Azure::Core::Http::Request request(
+              Azure::Core::Http::HttpMethod::Get,
+              url,
+              listFilesAndDirectoriesSegmentOptions.OnDirectoryItem
+                  || listFilesAndDirectoriesSegmentOptions.OnFileItem);
           request.GetUrl().AppendQueryParameter(Details::c_QueryRestype, "directory");
           request.GetUrl().AppendQueryParameter(Details::c_QueryComp, "list");
           if (listFilesAndDirectoriesSegmentOptions.Prefix.HasValue())
@@ -4651,7 +4788,10 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
           request.AddHeader(
               Details::c_HeaderVersion, listFilesAndDirectoriesSegmentOptions.ApiVersionParameter);
           return ListFilesAndDirectoriesSegmentParseResult(
-              context, pipeline.Send(context, request));
+              context,
+              pipeline.Send(context, request),
+              listFilesAndDirectoriesSegmentOptions.OnDirectoryItem,
+              listFilesAndDirectoriesSegmentOptions.OnFileItem);
         }
 
         struct ListHandlesOptions
@@ -4940,10 +5080,26 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         static Azure::Core::Response<DirectoryListFilesAndDirectoriesSegmentResult>
         ListFilesAndDirectoriesSegmentParseResult(
             Azure::Core::Context context,
-            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr)
+            std::unique_ptr<Azure::Core::Http::RawResponse> responsePtr,
+            const std::function<void(DirectoryItem)>& onDirectoryItem,
+            const std::function<void(FileItem)>& onFileItem)
         {
           auto& response = *responsePtr;
-          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
+          if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok
+              && (onDirectoryItem || onFileItem))
+          {
+            // Success, entries are passed to the callbacks as they're received.
+            auto bodyStream = response.GetBodyStream();
+            Storage::Details::XmlReader reader(context, *bodyStream);
+            DirectoryListFilesAndDirectoriesSegmentResult result
+                = DirectoryListFilesAndDirectoriesSegmentResultFromListFilesAndDirectoriesSegmentResponse(
+                    ListFilesAndDirectoriesSegmentResponseFromXml(
+                        reader, onDirectoryItem, onFileItem));
+            result.HttpHeaders.ContentType = response.GetHeaders().at(Details::c_HeaderContentType);
+            return Azure::Core::Response<DirectoryListFilesAndDirectoriesSegmentResult>(
+                std::move(result), std::move(responsePtr));
+          }
+          else if (response.GetStatusCode() == Azure::Core::Http::HttpStatusCode::Ok)
           {
             // Success.
             const auto& bodyBuffer = response.GetBody();
@@ -4952,7 +5108,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             DirectoryListFilesAndDirectoriesSegmentResult result = bodyBuffer.empty()
                 ? DirectoryListFilesAndDirectoriesSegmentResult()
                 : DirectoryListFilesAndDirectoriesSegmentResultFromListFilesAndDirectoriesSegmentResponse(
-                    ListFilesAndDirectoriesSegmentResponseFromXml(reader));
+                    ListFilesAndDirectoriesSegmentResponseFromXml(
+                        reader, onDirectoryItem, onFileItem));
             result.HttpHeaders.ContentType = response.GetHeaders().at(Details::c_HeaderContentType);
             return Azure::Core::Response<DirectoryListFilesAndDirectoriesSegmentResult>(
                 std::move(result), std::move(responsePtr));
@@ -5129,7 +5286,9 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         }
 
         static FilesAndDirectoriesListSegment FilesAndDirectoriesListSegmentFromXml(
-            Storage::Details::XmlReader& reader)
+            Storage::Details::XmlReader& reader,
+            const std::function<void(DirectoryItem)>& onDirectoryItem,
+            const std::function<void(FileItem)>& onFileItem)
         {
           auto result = FilesAndDirectoriesListSegment();
           enum class XmlTagName
@@ -5175,12 +5334,26 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
               }
               if (path.size() == 1 && path[0] == XmlTagName::c_Directory)
               {
-                result.DirectoryItems.emplace_back(DirectoryItemFromXml(reader));
+                if (onDirectoryItem)
+                {
+                  onDirectoryItem(DirectoryItemFromXml(reader));
+                }
+                else
+                {
+                  result.DirectoryItems.emplace_back(DirectoryItemFromXml(reader));
+                }
                 path.pop_back();
               }
               else if (path.size() == 1 && path[0] == XmlTagName::c_File)
               {
-                result.FileItems.emplace_back(FileItemFromXml(reader));
+                if (onFileItem)
+                {
+                  onFileItem(FileItemFromXml(reader));
+                }
+                else
+                {
+                  result.FileItems.emplace_back(FileItemFromXml(reader));
+                }
                 path.pop_back();
               }
             }
@@ -5192,7 +5365,9 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         }
 
         static ListFilesAndDirectoriesSegmentResponse ListFilesAndDirectoriesSegmentResponseFromXml(
-            Storage::Details::XmlReader& reader)
+            Storage::Details::XmlReader& reader,
+            const std::function<void(DirectoryItem)>& onDirectoryItem,
+            const std::function<void(FileItem)>& onFileItem)
         {
           auto result = ListFilesAndDirectoriesSegmentResponse();
           enum class XmlTagName
@@ -5228,39 +5403,55 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
 
-              if (std::strcmp(node.Name, "Entries") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Entries);
-              }
-              else if (std::strcmp(node.Name, "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::c_EnumerationResults);
-              }
-              else if (std::strcmp(node.Name, "Marker") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Marker);
-              }
-              else if (std::strcmp(node.Name, "MaxResults") == 0)
-              {
-                path.emplace_back(XmlTagName::c_MaxResults);
-              }
-              else if (std::strcmp(node.Name, "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::c_NextMarker);
-              }
-              else if (std::strcmp(node.Name, "Prefix") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Prefix);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::c_Unknown);
-              }
+              XmlTagName tag = XmlTagName::c_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Entries"):
+                  if (std::strcmp(node.Name, "Entries") == 0)
+                  {
+                    tag = XmlTagName::c_Entries;
+                  }
+                  break;
+                case Storage::Details::StaticHash("EnumerationResults"):
+                  if (std::strcmp(node.Name, "EnumerationResults") == 0)
+                  {
+                    tag = XmlTagName::c_EnumerationResults;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Marker"):
+                  if (std::strcmp(node.Name, "Marker") == 0)
+                  {
+                    tag = XmlTagName::c_Marker;
+                  }
+                  break;
+                case Storage::Details::StaticHash("MaxResults"):
+                  if (std::strcmp(node.Name, "MaxResults") == 0)
+                  {
+                    tag = XmlTagName::c_MaxResults;
+                  }
+                  break;
+                case Storage::Details::StaticHash("NextMarker"):
+                  if (std::strcmp(node.Name, "NextMarker") == 0)
+                  {
+                    tag = XmlTagName::c_NextMarker;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Prefix"):
+                  if (std::strcmp(node.Name, "Prefix") == 0)
+                  {
+                    tag = XmlTagName::c_Prefix;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
 
               if (path.size() == 2 && path[0] == XmlTagName::c_EnumerationResults
                   && path[1] == XmlTagName::c_Entries)
               {
-                result.Segment = FilesAndDirectoriesListSegmentFromXml(reader);
+                result.Segment
+                    = FilesAndDirectoriesListSegmentFromXml(reader, onDirectoryItem, onFileItem);
                 path.pop_back();
               }
             }
@@ -5401,42 +5592,61 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
 
-              if (std::strcmp(node.Name, "ClientIp") == 0)
-              {
-                path.emplace_back(XmlTagName::c_ClientIp);
-              }
-              else if (std::strcmp(node.Name, "FileId") == 0)
-              {
-                path.emplace_back(XmlTagName::c_FileId);
-              }
-              else if (std::strcmp(node.Name, "HandleId") == 0)
-              {
-                path.emplace_back(XmlTagName::c_HandleId);
-              }
-              else if (std::strcmp(node.Name, "LastReconnectTime") == 0)
-              {
-                path.emplace_back(XmlTagName::c_LastReconnectTime);
-              }
-              else if (std::strcmp(node.Name, "OpenTime") == 0)
-              {
-                path.emplace_back(XmlTagName::c_OpenTime);
-              }
-              else if (std::strcmp(node.Name, "ParentId") == 0)
-              {
-                path.emplace_back(XmlTagName::c_ParentId);
-              }
-              else if (std::strcmp(node.Name, "Path") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Path);
-              }
-              else if (std::strcmp(node.Name, "SessionId") == 0)
-              {
-                path.emplace_back(XmlTagName::c_SessionId);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::c_Unknown);
-              }
+              XmlTagName tag = XmlTagName::c_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("ClientIp"):
+                  if (std::strcmp(node.Name, "ClientIp") == 0)
+                  {
+                    tag = XmlTagName::c_ClientIp;
+                  }
+                  break;
+                case Storage::Details::StaticHash("FileId"):
+                  if (std::strcmp(node.Name, "FileId") == 0)
+                  {
+                    tag = XmlTagName::c_FileId;
+                  }
+                  break;
+                case Storage::Details::StaticHash("HandleId"):
+                  if (std::strcmp(node.Name, "HandleId") == 0)
+                  {
+                    tag = XmlTagName::c_HandleId;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LastReconnectTime"):
+                  if (std::strcmp(node.Name, "LastReconnectTime") == 0)
+                  {
+                    tag = XmlTagName::c_LastReconnectTime;
+                  }
+                  break;
+                case Storage::Details::StaticHash("OpenTime"):
+                  if (std::strcmp(node.Name, "OpenTime") == 0)
+                  {
+                    tag = XmlTagName::c_OpenTime;
+                  }
+                  break;
+                case Storage::Details::StaticHash("ParentId"):
+                  if (std::strcmp(node.Name, "ParentId") == 0)
+                  {
+                    tag = XmlTagName::c_ParentId;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Path"):
+                  if (std::strcmp(node.Name, "Path") == 0)
+                  {
+                    tag = XmlTagName::c_Path;
+                  }
+                  break;
+                case Storage::Details::StaticHash("SessionId"):
+                  if (std::strcmp(node.Name, "SessionId") == 0)
+                  {
+                    tag = XmlTagName::c_SessionId;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
             }
             else if (node.Type == Storage::Details::XmlNodeType::Text)
             {
@@ -5511,26 +5721,37 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
 
-              if (std::strcmp(node.Name, "Entries") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Entries);
-              }
-              else if (std::strcmp(node.Name, "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::c_EnumerationResults);
-              }
-              else if (std::strcmp(node.Name, "Handle") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Handle);
-              }
-              else if (std::strcmp(node.Name, "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::c_NextMarker);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::c_Unknown);
-              }
+              XmlTagName tag = XmlTagName::c_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Entries"):
+                  if (std::strcmp(node.Name, "Entries") == 0)
+                  {
+                    tag = XmlTagName::c_Entries;
+                  }
+                  break;
+                case Storage::Details::StaticHash("EnumerationResults"):
+                  if (std::strcmp(node.Name, "EnumerationResults") == 0)
+                  {
+                    tag = XmlTagName::c_EnumerationResults;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Handle"):
+                  if (std::strcmp(node.Name, "Handle") == 0)
+                  {
+                    tag = XmlTagName::c_Handle;
+                  }
+                  break;
+                case Storage::Details::StaticHash("NextMarker"):
+                  if (std::strcmp(node.Name, "NextMarker") == 0)
+                  {
+                    tag = XmlTagName::c_NextMarker;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 3 && path[0] == XmlTagName::c_EnumerationResults
                   && path[1] == XmlTagName::c_Entries && path[2] == XmlTagName::c_Handle)
               {
@@ -7806,42 +8027,61 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
 
-              if (std::strcmp(node.Name, "ClientIp") == 0)
-              {
-                path.emplace_back(XmlTagName::c_ClientIp);
-              }
-              else if (std::strcmp(node.Name, "FileId") == 0)
-              {
-                path.emplace_back(XmlTagName::c_FileId);
-              }
-              else if (std::strcmp(node.Name, "HandleId") == 0)
-              {
-                path.emplace_back(XmlTagName::c_HandleId);
-              }
-              else if (std::strcmp(node.Name, "LastReconnectTime") == 0)
-              {
-                path.emplace_back(XmlTagName::c_LastReconnectTime);
-              }
-              else if (std::strcmp(node.Name, "OpenTime") == 0)
-              {
-                path.emplace_back(XmlTagName::c_OpenTime);
-              }
-              else if (std::strcmp(node.Name, "ParentId") == 0)
-              {
-                path.emplace_back(XmlTagName::c_ParentId);
-              }
-              else if (std::strcmp(node.Name, "Path") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Path);
-              }
-              else if (std::strcmp(node.Name, "SessionId") == 0)
-              {
-                path.emplace_back(XmlTagName::c_SessionId);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::c_Unknown);
-              }
+              XmlTagName tag = XmlTagName::c_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("ClientIp"):
+                  if (std::strcmp(node.Name, "ClientIp") == 0)
+                  {
+                    tag = XmlTagName::c_ClientIp;
+                  }
+                  break;
+                case Storage::Details::StaticHash("FileId"):
+                  if (std::strcmp(node.Name, "FileId") == 0)
+                  {
+                    tag = XmlTagName::c_FileId;
+                  }
+                  break;
+                case Storage::Details::StaticHash("HandleId"):
+                  if (std::strcmp(node.Name, "HandleId") == 0)
+                  {
+                    tag = XmlTagName::c_HandleId;
+                  }
+                  break;
+                case Storage::Details::StaticHash("LastReconnectTime"):
+                  if (std::strcmp(node.Name, "LastReconnectTime") == 0)
+                  {
+                    tag = XmlTagName::c_LastReconnectTime;
+                  }
+                  break;
+                case Storage::Details::StaticHash("OpenTime"):
+                  if (std::strcmp(node.Name, "OpenTime") == 0)
+                  {
+                    tag = XmlTagName::c_OpenTime;
+                  }
+                  break;
+                case Storage::Details::StaticHash("ParentId"):
+                  if (std::strcmp(node.Name, "ParentId") == 0)
+                  {
+                    tag = XmlTagName::c_ParentId;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Path"):
+                  if (std::strcmp(node.Name, "Path") == 0)
+                  {
+                    tag = XmlTagName::c_Path;
+                  }
+                  break;
+                case Storage::Details::StaticHash("SessionId"):
+                  if (std::strcmp(node.Name, "SessionId") == 0)
+                  {
+                    tag = XmlTagName::c_SessionId;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
             }
             else if (node.Type == Storage::Details::XmlNodeType::Text)
             {
@@ -7916,26 +8156,37 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
             else if (node.Type == Storage::Details::XmlNodeType::StartTag)
             {
 
-              if (std::strcmp(node.Name, "Entries") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Entries);
-              }
-              else if (std::strcmp(node.Name, "EnumerationResults") == 0)
-              {
-                path.emplace_back(XmlTagName::c_EnumerationResults);
-              }
-              else if (std::strcmp(node.Name, "Handle") == 0)
-              {
-                path.emplace_back(XmlTagName::c_Handle);
-              }
-              else if (std::strcmp(node.Name, "NextMarker") == 0)
-              {
-                path.emplace_back(XmlTagName::c_NextMarker);
-              }
-              else
-              {
-                path.emplace_back(XmlTagName::c_Unknown);
-              }
+              XmlTagName tag = XmlTagName::c_Unknown;
+              switch (Storage::Details::StaticHash(node.Name))
+              {
+                case Storage::Details::StaticHash("Entries"):
+                  if (std::strcmp(node.Name, "Entries") == 0)
+                  {
+                    tag = XmlTagName::c_Entries;
+                  }
+                  break;
+                case Storage::Details::StaticHash("EnumerationResults"):
+                  if (std::strcmp(node.Name, "EnumerationResults") == 0)
+                  {
+                    tag = XmlTagName::c_EnumerationResults;
+                  }
+                  break;
+                case Storage::Details::StaticHash("Handle"):
+                  if (std::strcmp(node.Name, "Handle") == 0)
+                  {
+                    tag = XmlTagName::c_Handle;
+                  }
+                  break;
+                case Storage::Details::StaticHash("NextMarker"):
+                  if (std::strcmp(node.Name, "NextMarker") == 0)
+                  {
+                    tag = XmlTagName::c_NextMarker;
+                  }
+                  break;
+                default:
+                  break;
+              }
+              path.emplace_back(tag);
               if (path.size() == 3 && path[0] == XmlTagName::c_EnumerationResults
                   && path[1] == XmlTagName::c_Entries && path[2] == XmlTagName::c_Handle)
               {
@@ -15,6 +15,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
   namespace Details {
     constexpr int64_t c_FileUploadDefaultChunkSize = 4 * 1024 * 1024;
     constexpr int64_t c_FileDownloadDefaultChunkSize = 4 * 1024 * 1024;
+    // Idle download workers don't split off less than this from a slow range.
+    constexpr int64_t c_FileDownloadMinSplitLength = 1 * 1024 * 1024;
     constexpr static const char* c_ShareSnapshotQueryParameter = "sharesnapshot";
   } // namespace Details
 
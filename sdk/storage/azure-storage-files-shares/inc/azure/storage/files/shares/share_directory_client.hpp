@@ -12,6 +12,7 @@
 #include "azure/storage/files/shares/share_options.hpp"
 #include "azure/storage/files/shares/share_responses.hpp"
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -162,6 +163,22 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         const ListFilesAndDirectoriesSegmentOptions& options
         = ListFilesAndDirectoriesSegmentOptions()) const;
 
+    /**
+     * @brief List files and directories under the directory, passing each entry to the callbacks
+     * as soon as it's received instead of waiting for the whole segment.
+     * @param onDirectoryItem Called with each directory, in order, on the calling thread.
+     * @param onFileItem Called with each file, in order, on the calling thread.
+     * @param options Optional parameters to list the files and directories under this directory.
+     * @return Azure::Core::Response<ListFilesAndDirectoriesSegmentResult> containing the
+     * information of the operation, directory and share. DirectoryItems and FileItems are left
+     * empty.
+     */
+    Azure::Core::Response<ListFilesAndDirectoriesSegmentResult> ListFilesAndDirectoriesSegment(
+        const std::function<void(DirectoryItem)>& onDirectoryItem,
+        const std::function<void(FileItem)>& onFileItem,
+        const ListFilesAndDirectoriesSegmentOptions& options
+        = ListFilesAndDirectoriesSegmentOptions()) const;
+
     /**
      * @brief List open handles on the directory.
      * @param options Optional parameters to list this directory's open handles.
@@ -6,6 +6,7 @@
 #include "azure/core/nullable.hpp"
 #include "azure/storage/common/access_conditions.hpp"
 #include "azure/storage/common/storage_retry_policy.hpp"
+#include "azure/storage/common/transfer_manager.hpp"
 #include "azure/storage/files/shares/protocol/share_rest_client.hpp"
 #include "azure/storage/files/shares/share_responses.hpp"
 
@@ -841,6 +842,20 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
      * @brief The maximum number of threads that may be used in a parallel transfer.
      */
     int Concurrency = 5;
+
+    /**
+     * @brief If true, the destination file is sized up front and memory-mapped, and every range is
+     * received straight into the mapping instead of going through a write buffer. Files that
+     * can't be mapped are written as usual. An interrupted download leaves a file of the full
+     * size.
+     */
+    bool UseMemoryMappedFile = false;
+
+    /**
+     * @brief Schedules this transfer with a TransferManager, which can also pause, resume, cancel
+     * and report the progress of it. Null means the transfer is not managed.
+     */
+    std::shared_ptr<Storage::TransferHandle> TransferHandle;
   };
 
   /**
@@ -929,5 +944,23 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
      * @brief The maximum number of threads that may be used in a parallel transfer.
      */
     int Concurrency = 5;
+
+    /**
+     * @brief If true, an MD5 is computed for every range and sent to the service to validate it.
+     */
+    bool UseTransactionalMd5 = false;
+
+    /**
+     * @brief If true, the file is memory-mapped and every chunk is sent straight from the mapping
+     * instead of being read into a transfer buffer. Files that can't be mapped are read as usual.
+     * The file must not be truncated during the upload.
+     */
+    bool UseMemoryMappedFile = false;
+
+    /**
+     * @brief Schedules this transfer with a TransferManager, which can also pause, resume, cancel
+     * and report the progress of it. Null means the transfer is not managed.
+     */
+    std::shared_ptr<Storage::TransferHandle> TransferHandle;
   };
 }}}} // namespace Azure::Storage::Files::Shares
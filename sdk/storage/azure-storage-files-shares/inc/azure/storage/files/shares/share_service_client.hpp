@@ -11,6 +11,7 @@
 #include "azure/storage/files/shares/share_options.hpp"
 #include "azure/storage/files/shares/share_responses.hpp"
 
+#include <functional>
 #include <memory>
 #include <string>
 
@@ -86,6 +87,18 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     Azure::Core::Response<ListSharesSegmentResult> ListSharesSegment(
         const ListSharesSegmentOptions& options = ListSharesSegmentOptions()) const;
 
+    /**
+     * @brief List the shares from the service, passing each share to \p onShareItem as soon as
+     * it's received instead of waiting for the whole segment.
+     * @param onShareItem Called with each share, in order, on the calling thread.
+     * @param options Optional parameters to list the shares.
+     * @return Azure::Core::Response<ListSharesSegmentResult> The results containing information
+     * used for future list operation on valid result not yet returned. ShareItems is left empty.
+     */
+    Azure::Core::Response<ListSharesSegmentResult> ListSharesSegment(
+        const std::function<void(ShareItem)>& onShareItem,
+        const ListSharesSegmentOptions& options = ListSharesSegmentOptions()) const;
+
     /**
      * @brief Set the service's properties.
      * @param properties The properties of the service that is to be set.
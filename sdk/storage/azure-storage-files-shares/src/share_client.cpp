@@ -274,6 +274,35 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         std::move(ret), result.ExtractRawResponse());
   }
 
+  Azure::Core::Response<ListFilesAndDirectoriesSegmentResult>
+  ShareClient::ListFilesAndDirectoriesSegment(
+      const std::function<void(DirectoryItem)>& onDirectoryItem,
+      const std::function<void(FileItem)>& onFileItem,
+      const ListFilesAndDirectoriesSegmentOptions& options) const
+  {
+    auto protocolLayerOptions
+        = Details::ShareRestClient::Directory::ListFilesAndDirectoriesSegmentOptions();
+    protocolLayerOptions.Prefix = options.Prefix;
+    protocolLayerOptions.ContinuationToken = options.ContinuationToken;
+    protocolLayerOptions.MaxResults = options.MaxResults;
+    protocolLayerOptions.OnDirectoryItem = onDirectoryItem;
+    protocolLayerOptions.OnFileItem = onFileItem;
+    auto result = Details::ShareRestClient::Directory::ListFilesAndDirectoriesSegment(
+        m_shareUri, *m_pipeline, options.Context, protocolLayerOptions);
+    ListFilesAndDirectoriesSegmentResult ret;
+    ret.ServiceEndpoint = std::move(result->ServiceEndpoint);
+    ret.ShareName = std::move(result->ShareName);
+    ret.ShareSnapshot = std::move(result->ShareSnapshot);
+    ret.DirectoryPath = std::move(result->DirectoryPath);
+    ret.Prefix = std::move(result->Prefix);
+    ret.PreviousContinuationToken = std::move(result->PreviousContinuationToken);
+    ret.MaxResults = result->MaxResults;
+    ret.ContinuationToken = std::move(result->ContinuationToken);
+
+    return Azure::Core::Response<ListFilesAndDirectoriesSegmentResult>(
+        std::move(ret), result.ExtractRawResponse());
+  }
+
   Azure::Core::Response<AcquireShareLeaseResult> ShareClient::AcquireLease(
       const std::string& proposedLeaseId,
       int32_t duration,
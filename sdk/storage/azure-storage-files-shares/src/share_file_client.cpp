@@ -5,6 +5,7 @@
 
 #include "azure/core/credentials.hpp"
 #include "azure/core/http/policy.hpp"
+#include "azure/storage/common/buffer_pool.hpp"
 #include "azure/storage/common/concurrent_transfer.hpp"
 #include "azure/storage/common/constants.hpp"
 #include "azure/storage/common/crypt.hpp"
@@ -14,6 +15,7 @@
 #include "azure/storage/common/storage_common.hpp"
 #include "azure/storage/common/storage_per_retry_policy.hpp"
 #include "azure/storage/common/storage_retry_policy.hpp"
+#include "azure/storage/common/transfer_manager.hpp"
 #include "azure/storage/files/shares/share_constants.hpp"
 #include "azure/storage/files/shares/version.hpp"
 
@@ -262,6 +264,12 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
 
       ReliableStreamOptions reliableStreamOptions;
       reliableStreamOptions.MaxRetryRequests = Storage::Details::c_reliableStreamRetryCount;
+      reliableStreamOptions.MinimumThroughput
+          = Storage::Details::c_reliableStreamMinimumThroughput;
+      reliableStreamOptions.ThroughputWindow
+          = std::chrono::seconds(Storage::Details::c_reliableStreamThroughputWindowSeconds);
+      reliableStreamOptions.MaximumIdleGap
+          = std::chrono::seconds(Storage::Details::c_reliableStreamMaximumIdleGapSeconds);
       downloadResponse->BodyStream = std::make_unique<ReliableStream>(
           std::move(downloadResponse->BodyStream), reliableStreamOptions, retryFunction);
     }
@@ -580,13 +588,15 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     }
 
     DownloadFileOptions firstChunkOptions;
-    firstChunkOptions.Context = options.Context;
+    firstChunkOptions.Context
+        = Storage::Details::BindTransferContext(options.TransferHandle, options.Context);
     firstChunkOptions.Offset = options.Offset;
     if (firstChunkOptions.Offset.HasValue())
     {
       firstChunkOptions.Length = firstChunkLength;
     }
 
+    Storage::Details::TransferSlot firstChunkSlot(options.TransferHandle, firstChunkLength);
     auto firstChunk = Download(firstChunkOptions);
 
     int64_t fileSize;
@@ -607,6 +617,10 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       fileRangeSize = fileSize;
     }
     firstChunkLength = std::min(firstChunkLength, fileRangeSize);
+    if (options.TransferHandle)
+    {
+      options.TransferHandle->SetTotalBytes(fileRangeSize);
+    }
 
     if (static_cast<std::size_t>(fileRangeSize) > bufferSize)
     {
@@ -621,6 +635,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       throw std::runtime_error("error when reading body stream");
     }
     firstChunk->BodyStream.reset();
+    firstChunkSlot.Complete(firstChunkLength);
 
     auto returnTypeConverter = [](Azure::Core::Response<DownloadFileResult>& response) {
       DownloadFileToResult ret;
@@ -636,28 +651,34 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     auto ret = returnTypeConverter(firstChunk);
 
     // Keep downloading the remaining in parallel
-    auto downloadChunkFunc
-        = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-            DownloadFileOptions chunkOptions;
-            chunkOptions.Context = options.Context;
-            chunkOptions.Offset = offset;
-            chunkOptions.Length = length;
-            auto chunk = Download(chunkOptions);
-            int64_t bytesRead = Azure::Core::Http::BodyStream::ReadToCount(
-                chunkOptions.Context,
-                *(chunk->BodyStream),
-                buffer + (offset - firstChunkOffset),
-                chunkOptions.Length.GetValue());
-            if (bytesRead != chunkOptions.Length.GetValue())
-            {
-              throw std::runtime_error("error when reading body stream");
-            }
-
-            if (chunkId == numChunks - 1)
-            {
-              ret = returnTypeConverter(chunk);
-            }
-          };
+    int64_t numChunks = 0;
+    auto downloadChunkFunc = [&](Storage::Details::ChunkRange& range) {
+      DownloadFileOptions chunkOptions;
+      chunkOptions.Context = firstChunkOptions.Context;
+      chunkOptions.Offset = range.Offset();
+      chunkOptions.Length = range.End() - range.Offset();
+      auto chunk = Download(chunkOptions);
+      // The end of the range may be split off while it's being read.
+      int64_t offset = range.Offset();
+      while (int64_t length = range.Claim(Details::c_FileDownloadMinSplitLength))
+      {
+        int64_t bytesRead = Azure::Core::Http::BodyStream::ReadToCount(
+            chunkOptions.Context,
+            *(chunk->BodyStream),
+            buffer + (offset - firstChunkOffset),
+            length);
+        if (bytesRead != length)
+        {
+          throw std::runtime_error("error when reading body stream");
+        }
+        offset += length;
+      }
+
+      if (!range.IsSplitOff() && range.ChunkId() == numChunks - 1)
+      {
+        ret = returnTypeConverter(chunk);
+      }
+    };
 
     int64_t remainingOffset = firstChunkOffset + firstChunkLength;
     int64_t remainingSize = fileRangeSize - firstChunkLength;
@@ -673,9 +694,16 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       chunkSize = (std::max(chunkSize, int64_t(1)) + c_grainSize - 1) / c_grainSize * c_grainSize;
       chunkSize = std::min(chunkSize, Details::c_FileDownloadDefaultChunkSize);
     }
+    numChunks = (remainingSize + chunkSize - 1) / chunkSize;
 
     Storage::Details::ConcurrentTransfer(
-        remainingOffset, remainingSize, chunkSize, options.Concurrency, downloadChunkFunc);
+        remainingOffset,
+        remainingSize,
+        chunkSize,
+        options.Concurrency,
+        downloadChunkFunc,
+        Details::c_FileDownloadMinSplitLength,
+        options.TransferHandle);
     ret->ContentLength = fileRangeSize;
     return ret;
   }
@@ -699,7 +727,8 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     }
 
     DownloadFileOptions firstChunkOptions;
-    firstChunkOptions.Context = options.Context;
+    firstChunkOptions.Context
+        = Storage::Details::BindTransferContext(options.TransferHandle, options.Context);
     firstChunkOptions.Offset = options.Offset;
     if (firstChunkOptions.Offset.HasValue())
     {
@@ -708,6 +737,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
 
     Storage::Details::FileWriter fileWriter(fileName);
 
+    Storage::Details::TransferSlot firstChunkSlot(options.TransferHandle, firstChunkLength);
     auto firstChunk = Download(firstChunkOptions);
 
     int64_t fileSize;
@@ -728,32 +758,79 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       fileRangeSize = fileSize;
     }
     firstChunkLength = std::min(firstChunkLength, fileRangeSize);
+    if (options.TransferHandle)
+    {
+      options.TransferHandle->SetTotalBytes(fileRangeSize);
+    }
+    fileWriter.Preallocate(fileRangeSize);
+    std::unique_ptr<Storage::Details::MemoryMappedFile> mappedFile;
+    if (options.UseMemoryMappedFile)
+    {
+      try
+      {
+        mappedFile
+            = std::make_unique<Storage::Details::MemoryMappedFile>(fileWriter, fileRangeSize);
+      }
+      catch (std::runtime_error&)
+      {
+        // Not every file can be mapped, those are written through the file writer.
+      }
+    }
 
+    // When range is set, the data is claimed from it part by part instead of reading length bytes,
+    // as the end of the range may be split off while it's being read.
     auto bodyStreamToFile = [](Azure::Core::Http::BodyStream& stream,
                                Storage::Details::FileWriter& fileWriter,
+                               Storage::Details::MemoryMappedFile* mappedFile,
                                int64_t offset,
                                int64_t length,
+                               Storage::Details::ChunkRange* range,
                                Azure::Core::Context& context) {
-      constexpr std::size_t bufferSize = 4 * 1024 * 1024;
-      std::vector<uint8_t> buffer(bufferSize);
-      while (length > 0)
+      constexpr int64_t bufferSize = 4 * 1024 * 1024;
+      const int64_t partSize = range ? Details::c_FileDownloadMinSplitLength : bufferSize;
+      while (true)
       {
-        int64_t readSize = std::min(static_cast<int64_t>(bufferSize), length);
+        int64_t readSize = range ? range->Claim(partSize) : std::min(partSize, length);
+        if (readSize == 0)
+        {
+          break;
+        }
+        if (mappedFile)
+        {
+          int64_t bytesRead = Azure::Core::Http::BodyStream::ReadToCount(
+              context, stream, mappedFile->Data() + offset, readSize);
+          if (bytesRead != readSize)
+          {
+            throw std::runtime_error("error when reading body stream");
+          }
+          length -= readSize;
+          offset += readSize;
+          continue;
+        }
+        auto buffer = fileWriter.AcquireBuffer(static_cast<std::size_t>(readSize));
         int64_t bytesRead
-            = Azure::Core::Http::BodyStream::ReadToCount(context, stream, buffer.data(), readSize);
+            = Azure::Core::Http::BodyStream::ReadToCount(context, stream, buffer.Data(), readSize);
         if (bytesRead != readSize)
         {
           throw std::runtime_error("error when reading body stream");
         }
-        fileWriter.Write(buffer.data(), bytesRead, offset);
+        // The buffer is written in the background while the next one is received.
+        fileWriter.WriteAsync(std::move(buffer), offset);
         length -= bytesRead;
         offset += bytesRead;
       }
     };
 
     bodyStreamToFile(
-        *(firstChunk->BodyStream), fileWriter, 0, firstChunkLength, firstChunkOptions.Context);
+        *(firstChunk->BodyStream),
+        fileWriter,
+        mappedFile.get(),
+        0,
+        firstChunkLength,
+        nullptr,
+        firstChunkOptions.Context);
     firstChunk->BodyStream.reset();
+    firstChunkSlot.Complete(firstChunkLength);
 
     auto returnTypeConverter = [](Azure::Core::Response<DownloadFileResult>& response) {
       DownloadFileToResult ret;
@@ -769,25 +846,27 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
     auto ret = returnTypeConverter(firstChunk);
 
     // Keep downloading the remaining in parallel
-    auto downloadChunkFunc
-        = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-            DownloadFileOptions chunkOptions;
-            chunkOptions.Context = options.Context;
-            chunkOptions.Offset = offset;
-            chunkOptions.Length = length;
-            auto chunk = Download(chunkOptions);
-            bodyStreamToFile(
-                *(chunk->BodyStream),
-                fileWriter,
-                offset - firstChunkOffset,
-                chunkOptions.Length.GetValue(),
-                chunkOptions.Context);
-
-            if (chunkId == numChunks - 1)
-            {
-              ret = returnTypeConverter(chunk);
-            }
-          };
+    int64_t numChunks = 0;
+    auto downloadChunkFunc = [&](Storage::Details::ChunkRange& range) {
+      DownloadFileOptions chunkOptions;
+      chunkOptions.Context = firstChunkOptions.Context;
+      chunkOptions.Offset = range.Offset();
+      chunkOptions.Length = range.End() - range.Offset();
+      auto chunk = Download(chunkOptions);
+      bodyStreamToFile(
+          *(chunk->BodyStream),
+          fileWriter,
+          mappedFile.get(),
+          range.Offset() - firstChunkOffset,
+          0,
+          &range,
+          chunkOptions.Context);
+
+      if (!range.IsSplitOff() && range.ChunkId() == numChunks - 1)
+      {
+        ret = returnTypeConverter(chunk);
+      }
+    };
 
     int64_t remainingOffset = firstChunkOffset + firstChunkLength;
     int64_t remainingSize = fileRangeSize - firstChunkLength;
@@ -803,9 +882,17 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       chunkSize = (std::max(chunkSize, int64_t(1)) + c_grainSize - 1) / c_grainSize * c_grainSize;
       chunkSize = std::min(chunkSize, Details::c_FileDownloadDefaultChunkSize);
     }
+    numChunks = (remainingSize + chunkSize - 1) / chunkSize;
 
     Storage::Details::ConcurrentTransfer(
-        remainingOffset, remainingSize, chunkSize, options.Concurrency, downloadChunkFunc);
+        remainingOffset,
+        remainingSize,
+        chunkSize,
+        options.Concurrency,
+        downloadChunkFunc,
+        Details::c_FileDownloadMinSplitLength,
+        options.TransferHandle);
+    fileWriter.Flush();
     ret->ContentLength = fileRangeSize;
     return ret;
   }
@@ -876,22 +963,46 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       protocolLayerOptions.FileContentMd5 = options.HttpHeaders.ContentMd5;
     }
     protocolLayerOptions.Metadata = options.Metadata;
+    auto context = Storage::Details::BindTransferContext(options.TransferHandle, options.Context);
+    if (options.TransferHandle)
+    {
+      options.TransferHandle->SetTotalBytes(static_cast<int64_t>(bufferSize));
+    }
     auto createResult = Details::ShareRestClient::File::Create(
-        m_shareFileUri, *m_pipeline, options.Context, protocolLayerOptions);
+        m_shareFileUri, *m_pipeline, context, protocolLayerOptions);
 
     int64_t chunkSize = options.ChunkSize.HasValue() ? options.ChunkSize.GetValue()
                                                      : Details::c_FileUploadDefaultChunkSize;
 
+    // The whole buffer is available up front, so the MD5s of all ranges are computed together,
+    // several ranges at a time where the CPU allows it.
+    std::vector<std::string> rangeMd5s;
+    if (options.UseTransactionalMd5)
+    {
+      std::vector<std::pair<const uint8_t*, std::size_t>> ranges;
+      const std::size_t rangeSize = static_cast<std::size_t>(chunkSize);
+      for (std::size_t offset = 0; offset < bufferSize; offset += rangeSize)
+      {
+        ranges.emplace_back(buffer + offset, std::min(rangeSize, bufferSize - offset));
+      }
+      rangeMd5s = Md5::HashBatch(ranges);
+    }
+
     auto uploadPageFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
-      unused(chunkId, numChunks);
+      unused(numChunks);
       Azure::Core::Http::MemoryBodyStream contentStream(buffer + offset, length);
       UploadFileRangeOptions uploadRangeOptions;
-      uploadRangeOptions.Context = options.Context;
+      uploadRangeOptions.Context = context;
+      if (options.UseTransactionalMd5)
+      {
+        uploadRangeOptions.TransactionalMd5
+            = Base64Encode(rangeMd5s[static_cast<std::size_t>(chunkId)]);
+      }
       UploadRange(offset, &contentStream, uploadRangeOptions);
     };
 
     Storage::Details::ConcurrentTransfer(
-        0, bufferSize, chunkSize, options.Concurrency, uploadPageFunc);
+        0, bufferSize, chunkSize, options.Concurrency, uploadPageFunc, options.TransferHandle);
 
     UploadFileFromResult result;
     result.IsServerEncrypted = createResult->IsServerEncrypted;
@@ -967,22 +1078,78 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
       protocolLayerOptions.FileContentMd5 = options.HttpHeaders.ContentMd5;
     }
     protocolLayerOptions.Metadata = options.Metadata;
+    auto context = Storage::Details::BindTransferContext(options.TransferHandle, options.Context);
+    if (options.TransferHandle)
+    {
+      options.TransferHandle->SetTotalBytes(fileReader.GetFileSize());
+    }
     auto createResult = Details::ShareRestClient::File::Create(
-        m_shareFileUri, *m_pipeline, options.Context, protocolLayerOptions);
+        m_shareFileUri, *m_pipeline, context, protocolLayerOptions);
 
     int64_t chunkSize = options.ChunkSize.HasValue() ? options.ChunkSize.GetValue()
                                                      : Details::c_FileUploadDefaultChunkSize;
 
+    std::unique_ptr<Storage::Details::MemoryMappedFile> mappedFile;
+    if (options.UseMemoryMappedFile)
+    {
+      try
+      {
+        mappedFile = std::make_unique<Storage::Details::MemoryMappedFile>(fileReader);
+      }
+      catch (std::runtime_error&)
+      {
+        // Fall back to reading the file.
+      }
+    }
+
     auto uploadPageFunc = [&](int64_t offset, int64_t length, int64_t chunkId, int64_t numChunks) {
       unused(chunkId, numChunks);
-      Azure::Core::Http::FileBodyStream contentStream(fileReader.GetHandle(), offset, length);
       UploadFileRangeOptions uploadRangeOptions;
-      uploadRangeOptions.Context = options.Context;
+      uploadRangeOptions.Context = context;
+      if (mappedFile)
+      {
+        const uint8_t* rangeContent = mappedFile->Data() + offset;
+        if (options.UseTransactionalMd5)
+        {
+          uploadRangeOptions.TransactionalMd5
+              = Base64Encode(Md5::Hash(rangeContent, static_cast<std::size_t>(length)));
+        }
+        Azure::Core::Http::MemoryBodyStream contentStream(rangeContent, length);
+        UploadRange(offset, &contentStream, uploadRangeOptions);
+        return;
+      }
+      // Have the OS read the range this worker is likely to pick up next while this one is sent.
+      fileReader.Prefetch(offset + options.Concurrency * chunkSize, chunkSize);
+      if (options.UseTransactionalMd5)
+      {
+        // The checksum header precedes the body, so read the range into memory once and send it
+        // from there.
+        Azure::Core::Http::FileBodyStream fileStream(fileReader.GetHandle(), offset, length);
+        auto rangeContent = Storage::Details::BufferPool::GetTransferBufferPool().Acquire(
+            static_cast<std::size_t>(length));
+        if (Azure::Core::Http::BodyStream::ReadToCount(
+                context, fileStream, rangeContent.Data(), length)
+            != length)
+        {
+          throw std::runtime_error("error when reading file");
+        }
+        uploadRangeOptions.TransactionalMd5
+            = Base64Encode(Md5::Hash(rangeContent.Data(), rangeContent.Size()));
+        Azure::Core::Http::MemoryBodyStream contentStream(rangeContent.Data(), length);
+        UploadRange(offset, &contentStream, uploadRangeOptions);
+        return;
+      }
+      Azure::Core::Http::FileBodyStream contentStream(fileReader.GetHandle(), offset, length);
       UploadRange(offset, &contentStream, uploadRangeOptions);
     };
 
     Storage::Details::ConcurrentTransfer(
-        0, fileReader.GetFileSize(), chunkSize, options.Concurrency, uploadPageFunc);
+        0,
+        fileReader.GetFileSize(),
+        chunkSize,
+        options.Concurrency,
+        uploadPageFunc,
+        options.TransferHandle);
 
     UploadFileFromResult result;
     result.IsServerEncrypted = createResult->IsServerEncrypted;
@@ -90,8 +90,7 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         + Details::c_defaultSasVersion + "\n" + CacheControl + "\n" + ContentDisposition + "\n"
         + ContentEncoding + "\n" + ContentLanguage + "\n" + ContentType;
 
-    std::string signature
-        = Base64Encode(Details::HmacSha256(stringToSign, Base64Decode(credential.GetAccountKey())));
+    std::string signature = Base64Encode(credential.GetSigningContext()->Sign(stringToSign));
 
     Azure::Core::Http::Url builder;
     builder.AppendQueryParameter(
@@ -129,6 +129,20 @@ namespace Azure { namespace Storage { namespace Files { namespace Shares {
         m_serviceUri, *m_pipeline, options.Context, protocolLayerOptions);
   }
 
+  Azure::Core::Response<ListSharesSegmentResult> ShareServiceClient::ListSharesSegment(
+      const std::function<void(ShareItem)>& onShareItem,
+      const ListSharesSegmentOptions& options) const
+  {
+    auto protocolLayerOptions = Details::ShareRestClient::Service::ListSharesSegmentOptions();
+    protocolLayerOptions.ListSharesInclude = options.ListSharesInclude;
+    protocolLayerOptions.ContinuationToken = options.ContinuationToken;
+    protocolLayerOptions.MaxResults = options.MaxResults;
+    protocolLayerOptions.Prefix = options.Prefix;
+    protocolLayerOptions.OnShareItem = onShareItem;
+    return Details::ShareRestClient::Service::ListSharesSegment(
+        m_serviceUri, *m_pipeline, options.Context, protocolLayerOptions);
+  }
+
   Azure::Core::Response<SetServicePropertiesResult> ShareServiceClient::SetProperties(
       StorageServiceProperties properties,
       const SetServicePropertiesOptions& options) const
@@ -343,6 +343,27 @@ namespace Azure { namespace Storage { namespace Test {
       auto response = directoryNameAClient.ListFilesAndDirectoriesSegment(options);
       EXPECT_LE(2U, response->DirectoryItems.size() + response->FileItems.size());
     }
+    {
+      // Streamed list.
+      auto directoryNameAClient = m_shareClient->GetDirectoryClient(directoryNameA);
+      std::vector<std::string> directoryNames;
+      std::vector<std::string> fileNames;
+      auto response = directoryNameAClient.ListFilesAndDirectoriesSegment(
+          [&](Files::Shares::DirectoryItem item) { directoryNames.push_back(item.Name); },
+          [&](Files::Shares::FileItem item) {
+            EXPECT_EQ(1024, item.Properties.ContentLength);
+            fileNames.push_back(item.Name);
+          });
+      EXPECT_TRUE(response->ContinuationToken.empty());
+      EXPECT_TRUE(response->DirectoryItems.empty());
+      EXPECT_TRUE(response->FileItems.empty());
+      std::sort(directoryNames.begin(), directoryNames.end());
+      std::sort(fileNames.begin(), fileNames.end());
+      std::sort(directoryNameSetA.begin(), directoryNameSetA.end());
+      std::sort(fileNameSetA.begin(), fileNameSetA.end());
+      EXPECT_EQ(directoryNames, directoryNameSetA);
+      EXPECT_EQ(fileNames, fileNameSetA);
+    }
   }
 
   TEST_F(FileShareDirectoryClientTest, HandlesFunctionalityWorks)